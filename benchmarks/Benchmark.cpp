@@ -0,0 +1,368 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Global.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+
+#ifdef SFML_SYSTEM_LINUX
+    #include <unistd.h>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace bench
+{
+    namespace
+    {
+        struct RegisteredBenchmark
+        {
+            std::string name;
+            Registrar::Function function;
+        };
+
+        const void* volatile escapedPointer = nullptr;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::vector<RegisteredBenchmark>& getRegistry()
+        {
+            static std::vector<RegisteredBenchmark> registry;
+            return registry;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string escapeJson(const std::string& str)
+        {
+            std::string result;
+            result.reserve(str.length());
+            for (const char c : str)
+            {
+                if (c == '"')
+                    result += "\\\"";
+                else if (c == '\\')
+                    result += "\\\\";
+                else if (c == '\n')
+                    result += "\\n";
+                else if (static_cast<unsigned char>(c) < 0x20)
+                    result += ' ';
+                else
+                    result += c;
+            }
+
+            return result;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeNumber(std::ostream& stream, double value)
+        {
+            if (std::isfinite(value))
+                stream << value;
+            else
+                stream << "null";
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    State::State(const Settings& settings, sf::RenderTarget* target, Result& result) :
+        m_settings{settings},
+        m_target  {target},
+        m_result  {result}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool State::keepRunning()
+    {
+        const auto now = Clock::now();
+        if (m_running)
+        {
+            const auto duration = now - m_iterationStartTime - m_pausedDuration;
+            m_result.samples.push_back(static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+        }
+        else
+        {
+            m_running = true;
+            m_startTime = now;
+        }
+
+        if (m_skipped)
+            return false;
+
+        // Stop when enough iterations were executed and enough time has passed
+        const std::size_t iterations = m_result.samples.size();
+        const double elapsedSeconds = std::chrono::duration<double>(now - m_startTime).count();
+        if (((iterations >= m_settings.minIterations) && (elapsedSeconds >= m_settings.minTime))
+         || (iterations >= m_settings.maxIterations))
+        {
+            return false;
+        }
+
+        m_pausedDuration = Clock::duration::zero();
+        m_iterationStartTime = Clock::now();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void State::pauseTiming()
+    {
+        m_pauseStartTime = Clock::now();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void State::resumeTiming()
+    {
+        m_pausedDuration += Clock::now() - m_pauseStartTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void State::skip(const std::string& reason)
+    {
+        m_skipped = true;
+        m_result.skipReason = reason;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void State::setItemsPerIteration(std::size_t items)
+    {
+        m_result.itemsPerIteration = items;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void State::setBytesPerIteration(std::size_t bytes)
+    {
+        m_result.bytesPerIteration = bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void State::setCounter(const std::string& name, double value)
+    {
+        m_result.counters[name] = value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Registrar::Registrar(const char* name, Function function)
+    {
+        getRegistry().push_back({name, function});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Result> runBenchmarks(const Settings& settings, sf::RenderTarget* target, std::ostream& log)
+    {
+        auto benchmarks = getRegistry();
+        std::stable_sort(benchmarks.begin(), benchmarks.end(),
+                         [](const RegisteredBenchmark& left, const RegisteredBenchmark& right){ return left.name < right.name; });
+
+        std::vector<Result> results;
+        for (const auto& benchmark : benchmarks)
+        {
+            if (!settings.filter.empty() && (benchmark.name.find(settings.filter) == std::string::npos))
+                continue;
+
+            log << benchmark.name << "... " << std::flush;
+
+            Result result;
+            result.name = benchmark.name;
+            State state{settings, target, result};
+            benchmark.function(state);
+
+            if (!result.skipReason.empty())
+            {
+                result.samples.clear();
+                log << "skipped (" << result.skipReason << ")" << std::endl;
+            }
+            else if (result.samples.empty())
+                log << "no iterations" << std::endl;
+            else
+            {
+                double total = 0;
+                for (const double sample : result.samples)
+                    total += sample;
+
+                log << static_cast<unsigned long long>(total / result.samples.size()) << " ns/iteration ("
+                    << result.samples.size() << " iterations)" << std::endl;
+            }
+
+            results.push_back(std::move(result));
+        }
+
+        return results;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::string> getBenchmarkNames()
+    {
+        std::vector<std::string> names;
+        for (const auto& benchmark : getRegistry())
+            names.push_back(benchmark.name);
+
+        std::sort(names.begin(), names.end());
+        return names;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void writeJson(std::ostream& stream, const Settings& settings, const std::vector<Result>& results)
+    {
+        stream << std::setprecision(10);
+        stream << "{\n";
+        stream << "  \"context\": {\n";
+        stream << "    \"library\": \"TGUI " << TGUI_VERSION_MAJOR << "." << TGUI_VERSION_MINOR << "." << TGUI_VERSION_PATCH << "\",\n";
+        stream << "    \"rendering\": " << (settings.render ? "true" : "false") << ",\n";
+        stream << "    \"min_time_s\": " << settings.minTime << ",\n";
+        stream << "    \"filter\": \"" << escapeJson(settings.filter) << "\"\n";
+        stream << "  },\n";
+        stream << "  \"benchmarks\": [";
+
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const Result& result = results[i];
+            stream << (i > 0 ? ",\n" : "\n");
+            stream << "    {\n";
+            stream << "      \"name\": \"" << escapeJson(result.name) << "\",\n";
+
+            if (!result.skipReason.empty())
+            {
+                stream << "      \"skipped\": \"" << escapeJson(result.skipReason) << "\"\n";
+                stream << "    }";
+                continue;
+            }
+
+            std::vector<double> samples = result.samples;
+            std::sort(samples.begin(), samples.end());
+
+            double total = 0;
+            for (const double sample : samples)
+                total += sample;
+
+            double mean = 0;
+            double median = 0;
+            double deviation = 0;
+            if (!samples.empty())
+            {
+                mean = total / samples.size();
+                median = (samples.size() % 2) ? samples[samples.size() / 2]
+                                              : (samples[samples.size() / 2 - 1] + samples[samples.size() / 2]) / 2;
+
+                for (const double sample : samples)
+                    deviation += (sample - mean) * (sample - mean);
+                deviation = std::sqrt(deviation / samples.size());
+            }
+
+            stream << "      \"iterations\": " << samples.size() << ",\n";
+            stream << "      \"mean_ns\": "; writeNumber(stream, mean); stream << ",\n";
+            stream << "      \"median_ns\": "; writeNumber(stream, median); stream << ",\n";
+            stream << "      \"stddev_ns\": "; writeNumber(stream, deviation); stream << ",\n";
+            stream << "      \"min_ns\": "; writeNumber(stream, samples.empty() ? 0 : samples.front()); stream << ",\n";
+            stream << "      \"max_ns\": "; writeNumber(stream, samples.empty() ? 0 : samples.back());
+
+            if ((result.itemsPerIteration > 0) && (total > 0))
+            {
+                stream << ",\n      \"items_per_second\": ";
+                writeNumber(stream, result.itemsPerIteration * samples.size() / (total / 1e9));
+            }
+
+            if ((result.bytesPerIteration > 0) && (total > 0))
+            {
+                stream << ",\n      \"bytes_per_second\": ";
+                writeNumber(stream, result.bytesPerIteration * samples.size() / (total / 1e9));
+            }
+
+            if (!result.counters.empty())
+            {
+                stream << ",\n      \"counters\": {";
+                bool first = true;
+                for (const auto& counter : result.counters)
+                {
+                    stream << (first ? "\n" : ",\n") << "        \"" << escapeJson(counter.first) << "\": ";
+                    writeNumber(stream, counter.second);
+                    first = false;
+                }
+                stream << "\n      }";
+            }
+
+            stream << "\n    }";
+        }
+
+        stream << "\n  ]\n";
+        stream << "}\n";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    tgui::Font getFont()
+    {
+        static std::shared_ptr<sf::Font> font;
+        if (!font)
+        {
+            font = std::make_shared<sf::Font>();
+            font->loadFromFile("resources/DroidSansArmenian.ttf");
+        }
+
+        return font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void escape(const void* pointer)
+    {
+        escapedPointer = pointer;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t getResidentMemory()
+    {
+    #ifdef SFML_SYSTEM_LINUX
+        std::ifstream file{"/proc/self/statm"};
+        std::size_t totalPages = 0;
+        std::size_t residentPages = 0;
+        if (file >> totalPages >> residentPages)
+            return residentPages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    #endif
+
+        return 0;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
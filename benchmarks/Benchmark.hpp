@@ -0,0 +1,280 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_BENCHMARK_HPP
+#define TGUI_BENCHMARK_HPP
+
+#include <TGUI/Font.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+#include <ostream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define TGUI_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define TGUI_BENCHMARK_CONCAT(a, b) TGUI_BENCHMARK_CONCAT_IMPL(a, b)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Defines a benchmark. The body receives a 'state' parameter and should execute the measured code in a
+/// 'while (state.keepRunning())' loop, e.g.
+/// @code
+/// BENCHMARK("Widgets/Button/Construct") {
+///     while (state.keepRunning())
+///         std::make_shared<tgui::Button>();
+/// }
+/// @endcode
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define BENCHMARK(name) \
+    static void TGUI_BENCHMARK_CONCAT(tguiBenchmark, __LINE__)(bench::State& state); \
+    static const bench::Registrar TGUI_BENCHMARK_CONCAT(tguiBenchmarkRegistrar, __LINE__){name, &TGUI_BENCHMARK_CONCAT(tguiBenchmark, __LINE__)}; \
+    static void TGUI_BENCHMARK_CONCAT(tguiBenchmark, __LINE__)(bench::State& state)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace bench
+{
+    using Clock = std::chrono::steady_clock;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Options that influence how the benchmarks are run
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct Settings
+    {
+        std::string filter;                  ///< Only benchmarks with this text in their name are run
+        double minTime = 0.5;                ///< Minimum amount of seconds that each benchmark is run
+        std::size_t minIterations = 1;       ///< Minimum amount of iterations of each benchmark
+        std::size_t maxIterations = 1000000; ///< Iterations after which a benchmark is stopped regardless of its duration
+        bool render = true;                  ///< Should the benchmarks that draw be run?
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Measurements of a single benchmark
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct Result
+    {
+        std::string name;
+        std::string skipReason;
+        std::vector<double> samples; ///< Duration of each iteration in nanoseconds
+        std::size_t itemsPerIteration = 0;
+        std::size_t bytesPerIteration = 0;
+        std::map<std::string, double> counters;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Object passed to the benchmark functions to control the measurements
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class State
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param settings  Settings that decide how long the benchmark is run
+        /// @param target    Offscreen render target, or nullptr when rendering is skipped
+        /// @param result    Object in which the measurements are stored
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        State(const Settings& settings, sf::RenderTarget* target, Result& result);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finishes the previous iteration and decides whether another one has to be executed
+        ///
+        /// @return True when the measured code should be executed again, false when the benchmark is finished
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool keepRunning();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops the timer during the current iteration, e.g. to reset some state between iterations
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pauseTiming();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Continues the timer after pauseTiming was called
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resumeTiming();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the benchmark as skipped, keepRunning will return false afterwards
+        ///
+        /// @param reason  Explanation that is added to the report
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void skip(const std::string& reason);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets how many items are processed in a single iteration, the report will contain an items per second value
+        ///
+        /// @param items  Amount of items (widgets, lookups, characters, ...) handled in each iteration
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemsPerIteration(std::size_t items);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets how many bytes are processed in a single iteration, the report will contain a bytes per second value
+        ///
+        /// @param bytes  Amount of bytes read or written in each iteration
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBytesPerIteration(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds an extra value to the report
+        ///
+        /// @param name   Name of the counter
+        /// @param value  Value of the counter
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCounter(const std::string& name, double value);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the offscreen render target
+        ///
+        /// @return Target to draw on, or nullptr when the benchmarks are run with rendering disabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::RenderTarget* getRenderTarget() const
+        {
+            return m_target;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of iterations that were already finished
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getIterations() const
+        {
+            return m_result.samples.size();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+        const Settings&   m_settings;
+        sf::RenderTarget* m_target;
+        Result&           m_result;
+
+        bool              m_running = false;
+        bool              m_skipped = false;
+        Clock::time_point m_startTime;
+        Clock::time_point m_iterationStartTime;
+        Clock::time_point m_pauseStartTime;
+        Clock::duration   m_pausedDuration = Clock::duration::zero();
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Registers a benchmark function, used by the BENCHMARK macro
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct Registrar
+    {
+        using Function = void(*)(State&);
+
+        Registrar(const char* name, Function function);
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Runs all registered benchmarks that match the filter
+    ///
+    /// @param settings  Settings that decide which benchmarks are run and for how long
+    /// @param target    Offscreen render target, or nullptr when rendering is skipped
+    /// @param log       Stream to which the progress is written
+    ///
+    /// @return Results of all benchmarks that were run
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    std::vector<Result> runBenchmarks(const Settings& settings, sf::RenderTarget* target, std::ostream& log);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns the names of all registered benchmarks
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    std::vector<std::string> getBenchmarkNames();
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Writes the results as a JSON document
+    ///
+    /// @param stream    Stream to write to
+    /// @param settings  Settings with which the benchmarks were run
+    /// @param results   Results returned by runBenchmarks
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void writeJson(std::ostream& stream, const Settings& settings, const std::vector<Result>& results);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns the font used by all benchmarks that need text
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    tgui::Font getFont();
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns the amount of memory that the process currently uses
+    ///
+    /// @return Resident set size in bytes, or 0 when it can't be determined on this platform
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    std::size_t getResidentMemory();
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Stores the pointer where the compiler can't see it. This is defined in a different translation unit on purpose.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void escape(const void* pointer);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Prevents the compiler from optimizing away a computed value
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    void doNotOptimize(const T& value)
+    {
+        escape(&value);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BENCHMARK_HPP
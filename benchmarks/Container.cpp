@@ -0,0 +1,201 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/TGUI.hpp>
+
+namespace
+{
+    // Creates a panel filled with a grid of buttons that are named "Button0", "Button1", ...
+    tgui::Panel::Ptr createButtonGrid(std::size_t columns, std::size_t rows)
+    {
+        auto panel = std::make_shared<tgui::Panel>();
+        panel->setSize(columns * 40.f, rows * 30.f);
+        for (std::size_t i = 0; i < columns * rows; ++i)
+        {
+            auto button = std::make_shared<tgui::Button>();
+            button->setPosition((i % columns) * 40.f, (i / columns) * 30.f);
+            button->setSize(38, 28);
+            panel->add(button, "Button" + tgui::to_string(i));
+        }
+
+        return panel;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Container/Get/10k widgets") {
+    auto panel = createButtonGrid(100, 100);
+
+    std::vector<sf::String> names;
+    for (std::size_t i = 0; i < 10000; ++i)
+        names.push_back("Button" + tgui::to_string((i * 7919) % 10000));
+
+    state.setItemsPerIteration(names.size());
+    while (state.keepRunning())
+    {
+        for (const auto& name : names)
+            bench::doNotOptimize(panel->get(name));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Container/Get/10k widgets recursive") {
+    auto root = std::make_shared<tgui::Panel>();
+    std::vector<sf::String> names;
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        auto panel = std::make_shared<tgui::Panel>();
+        root->add(panel, "Panel" + tgui::to_string(i));
+        for (std::size_t j = 0; j < 100; ++j)
+        {
+            const sf::String name = "Widget" + tgui::to_string(i) + "_" + tgui::to_string(j);
+            panel->add(std::make_shared<tgui::Button>(), name);
+            names.push_back(name);
+        }
+    }
+
+    state.setItemsPerIteration(names.size());
+    while (state.keepRunning())
+    {
+        for (const auto& name : names)
+            bench::doNotOptimize(root->get(name, true));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Gui/Get/10k widgets recursive") {
+    tgui::Gui gui;
+    std::vector<sf::String> names;
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        auto panel = std::make_shared<tgui::Panel>();
+        gui.add(panel, "Panel" + tgui::to_string(i));
+        for (std::size_t j = 0; j < 100; ++j)
+        {
+            const sf::String name = "Widget" + tgui::to_string(i) + "_" + tgui::to_string(j);
+            panel->add(std::make_shared<tgui::Button>(), name);
+            names.push_back(name);
+        }
+    }
+
+    state.setItemsPerIteration(names.size());
+    while (state.keepRunning())
+    {
+        for (const auto& name : names)
+            bench::doNotOptimize(gui.get(name, true));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Container/FocusNextWidget/1k widgets") {
+    auto panel = std::make_shared<tgui::Panel>();
+    for (std::size_t i = 0; i < 1000; ++i)
+        panel->add(std::make_shared<tgui::EditBox>());
+
+    state.setItemsPerIteration(1000);
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0; i < 1000; ++i)
+            panel->focusNextWidget();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Container/FocusNextWidget/1k widgets with tab index") {
+    auto panel = std::make_shared<tgui::Panel>();
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        auto editBox = std::make_shared<tgui::EditBox>();
+        editBox->setTabIndex(static_cast<int>(1000 - i));
+        panel->add(editBox);
+    }
+
+    state.setItemsPerIteration(1000);
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0; i < 1000; ++i)
+            panel->focusNextWidget();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Container/HandleEvent/MouseMoved 1k widgets") {
+    auto panel = createButtonGrid(40, 25);
+
+    state.setItemsPerIteration(1000);
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0; i < 1000; ++i)
+            panel->mouseMoved((i % 40) * 40.f + 20, (i / 40) * 30.f + 15);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Container/HandleEvent/MouseClick 1k widgets") {
+    auto panel = createButtonGrid(40, 25);
+
+    state.setItemsPerIteration(1000);
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            const float x = (i % 40) * 40.f + 20;
+            const float y = (i / 40) * 30.f + 15;
+            panel->leftMousePressed(x, y);
+            panel->leftMouseReleased(x, y);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Container/HandleEvent/TextEntered 1k widgets") {
+    auto panel = createButtonGrid(40, 25);
+    auto editBox = std::make_shared<tgui::EditBox>();
+    editBox->setFont(bench::getFont());
+    panel->add(editBox);
+    editBox->focus();
+
+    state.setItemsPerIteration(100);
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        editBox->setText("");
+        state.resumeTiming();
+
+        for (std::size_t i = 0; i < 100; ++i)
+            panel->textEntered('a' + (i % 26));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
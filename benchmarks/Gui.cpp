@@ -0,0 +1,333 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/TGUI.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <thread>
+
+namespace
+{
+    // Fills the gui with a form-like screen: rows of labels, edit boxes and buttons, a list box and a chat box
+    void fillGui(tgui::Gui& gui)
+    {
+        gui.setFont(bench::getFont());
+        auto theme = std::make_shared<tgui::Theme>("resources/Black.txt");
+
+        for (std::size_t i = 0; i < 20; ++i)
+        {
+            tgui::Label::Ptr label = theme->load("Label");
+            label->setText("Label " + tgui::to_string(i));
+            label->setPosition(10, 10 + i * 35.f);
+            gui.add(label);
+
+            tgui::EditBox::Ptr editBox = theme->load("EditBox");
+            editBox->setText("Edit box " + tgui::to_string(i));
+            editBox->setPosition(120, 10 + i * 35.f);
+            editBox->setSize(200, 30);
+            gui.add(editBox);
+
+            tgui::Button::Ptr button = theme->load("Button");
+            button->setText("Button " + tgui::to_string(i));
+            button->setPosition(330, 10 + i * 35.f);
+            button->setSize(120, 30);
+            gui.add(button);
+        }
+
+        tgui::ListBox::Ptr listBox = theme->load("ListBox");
+        listBox->setPosition(470, 10);
+        listBox->setSize(250, 340);
+        for (std::size_t i = 0; i < 100; ++i)
+            listBox->addItem("Item " + tgui::to_string(i));
+        gui.add(listBox);
+
+        tgui::ChatBox::Ptr chatBox = theme->load("ChatBox");
+        chatBox->setPosition(470, 360);
+        chatBox->setSize(250, 340);
+        for (std::size_t i = 0; i < 100; ++i)
+            chatBox->addLine("Line " + tgui::to_string(i) + " of the chat box");
+        gui.add(chatBox);
+    }
+
+    // Nests panels 10 levels deep, each panel contains some text widgets that clip their contents
+    void fillGuiWithNestedPanels(tgui::Gui& gui)
+    {
+        gui.setFont(bench::getFont());
+        auto theme = std::make_shared<tgui::Theme>("resources/Black.txt");
+
+        tgui::Container::Ptr parent = gui.getContainer();
+        for (std::size_t depth = 0; depth < 10; ++depth)
+        {
+            tgui::Panel::Ptr panel = theme->load("Panel");
+            panel->setPosition(5, 40);
+            panel->setSize(700 - depth * 10.f, 650 - depth * 50.f);
+            parent->add(panel);
+
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                tgui::TextBox::Ptr textBox = theme->load("TextBox");
+                textBox->setText("Text box " + tgui::to_string(i) + " at depth " + tgui::to_string(depth));
+                textBox->setPosition(100 + i * 150.f, 5);
+                textBox->setSize(140, 30);
+                panel->add(textBox);
+            }
+
+            tgui::Label::Ptr label = theme->load("Label");
+            label->setText("Depth " + tgui::to_string(depth));
+            label->setPosition(5, 5);
+            panel->add(label);
+
+            parent = panel;
+        }
+    }
+
+    void display(sf::RenderTarget* target)
+    {
+        auto renderTexture = dynamic_cast<sf::RenderTexture*>(target);
+        if (renderTexture)
+            renderTexture->display();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Gui/Draw/Frame") {
+    if (!state.getRenderTarget())
+        return state.skip("rendering disabled");
+
+    tgui::Gui gui{*state.getRenderTarget()};
+    fillGui(gui);
+
+    while (state.keepRunning())
+    {
+        state.getRenderTarget()->clear();
+        gui.draw();
+        display(state.getRenderTarget());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Gui/Draw/Frame with events") {
+    if (!state.getRenderTarget())
+        return state.skip("rendering disabled");
+
+    tgui::Gui gui{*state.getRenderTarget()};
+    fillGui(gui);
+
+    sf::Event event;
+    event.type = sf::Event::MouseMoved;
+
+    // Simulates a frame of an application in which the mouse moves over the widgets
+    while (state.keepRunning())
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            event.mouseMove.x = static_cast<int>((state.getIterations() * 10 + i) % 720);
+            event.mouseMove.y = static_cast<int>((state.getIterations() * 7 + i) % 700);
+            gui.handleEvent(event);
+        }
+
+        gui.updateTime(sf::milliseconds(16));
+
+        state.getRenderTarget()->clear();
+        gui.draw();
+        display(state.getRenderTarget());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Gui/Draw/Frame with 1000 buttons") {
+    if (!state.getRenderTarget())
+        return state.skip("rendering disabled");
+
+    tgui::Gui gui{*state.getRenderTarget()};
+    gui.setFont(bench::getFont());
+
+    // A form of small buttons with colored backgrounds and borders instead of textures
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        auto button = std::make_shared<tgui::Button>();
+        button->setPosition((i % 40) * 18.f + 2, (i / 40) * 28.f + 2);
+        button->setSize(14, 24);
+        button->getRenderer()->setBorders({1, 1, 1, 1});
+        button->getRenderer()->setBackgroundColor({60, 60, 60});
+        button->getRenderer()->setBorderColor({200, 200, 200});
+        gui.add(button);
+    }
+
+    state.setItemsPerIteration(1000);
+    while (state.keepRunning())
+    {
+        state.getRenderTarget()->clear();
+        gui.draw();
+        display(state.getRenderTarget());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Gui/Draw/Frame with 10 levels of nested panels") {
+    if (!state.getRenderTarget())
+        return state.skip("rendering disabled");
+
+    tgui::Gui gui{*state.getRenderTarget()};
+    fillGuiWithNestedPanels(gui);
+
+    while (state.keepRunning())
+    {
+        state.getRenderTarget()->clear();
+        gui.draw();
+        display(state.getRenderTarget());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Gui/AbsolutePosition/10 levels of nested panels") {
+    tgui::Gui gui;
+    fillGuiWithNestedPanels(gui);
+
+    // Collect the widgets at all depths, these are the widgets that query their absolute position while being drawn
+    std::vector<tgui::Widget::Ptr> widgets;
+    tgui::Container::Ptr container = gui.getContainer();
+    while (container)
+    {
+        tgui::Container::Ptr nextContainer;
+        for (const auto& widget : container->getWidgets())
+        {
+            widgets.push_back(widget);
+            if (widget->getWidgetType() == "Panel")
+                nextContainer = std::static_pointer_cast<tgui::Container>(widget);
+        }
+
+        container = nextContainer;
+    }
+
+    // The outer panel moves every iteration, like when the user drags a window around
+    state.setItemsPerIteration(widgets.size() * 4);
+    while (state.keepRunning())
+    {
+        widgets.front()->setPosition(5.f + state.getIterations() % 2, 40);
+        for (const auto& widget : widgets)
+        {
+            for (unsigned int i = 0; i < 4; ++i)
+                bench::doNotOptimize(widget->getAbsolutePosition());
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Gui/CommandQueue/100 labels updated 10 times per frame") {
+    tgui::Gui gui;
+    gui.setFont(bench::getFont());
+
+    std::vector<tgui::Label::Ptr> labels;
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        auto label = std::make_shared<tgui::Label>();
+        label->setPosition(10, i * 20.f);
+        gui.add(label);
+        labels.push_back(label);
+    }
+
+    // A worker thread posts the updates, the frame only executes the last update of each label
+    state.setItemsPerIteration(1000);
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        std::thread worker{[&gui, &labels, &state]{
+            for (unsigned int i = 0; i < 10; ++i)
+            {
+                for (const auto& label : labels)
+                {
+                    const sf::String text = tgui::to_string(state.getIterations() * 10 + i);
+                    gui.getCommandQueue().postUpdate(label, "Text", [text](tgui::Label& l){ l.setText(text); });
+                }
+            }
+        }};
+        worker.join();
+        state.resumeTiming();
+
+        gui.updateTime(sf::milliseconds(16));
+    }
+
+    state.setCounter("coalesced", static_cast<double>(gui.getCommandQueue().getCoalescedCount()));
+    state.setCounter("max_drain_us", static_cast<double>(gui.getCommandQueue().getMaxDrainDuration().asMicroseconds()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Gui/Bindings/1000 labels at 10 kHz") {
+    tgui::Gui gui;
+    gui.setFont(bench::getFont());
+
+    std::vector<tgui::Observable<sf::String>::Ptr> values;
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        auto label = std::make_shared<tgui::Label>();
+        label->setPosition((i % 20) * 40.f, (i / 20) * 14.f);
+        label->setTextSize(10);
+        gui.add(label);
+
+        values.push_back(std::make_shared<tgui::Observable<sf::String>>());
+        gui.getBindings().bindText(label, values.back());
+    }
+
+    // Every value changes 10000 times per second, which is about 167 times during a frame of 60 FPS
+    const unsigned int changesPerFrame = 10000 / 60;
+    std::vector<sf::String> texts;
+    for (unsigned int i = 0; i < changesPerFrame * 2; ++i)
+        texts.push_back(tgui::to_string(i));
+
+    state.setItemsPerIteration(values.size() * changesPerFrame);
+    while (state.keepRunning())
+    {
+        const std::size_t offset = (state.getIterations() % 2) * changesPerFrame;
+        for (const auto& value : values)
+        {
+            for (unsigned int i = 0; i < changesPerFrame; ++i)
+                value->set(texts[offset + i]);
+        }
+
+        gui.updateTime(sf::milliseconds(16));
+    }
+
+    state.setCounter("widget_updates", static_cast<double>(gui.getBindings().getUpdateCount()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Gui/UpdateTime") {
+    tgui::Gui gui;
+    fillGui(gui);
+
+    while (state.keepRunning())
+        gui.updateTime(sf::milliseconds(16));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
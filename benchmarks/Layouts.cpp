@@ -0,0 +1,210 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/TGUI.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Layouts/Bound to parent/1k widgets") {
+    auto panel = std::make_shared<tgui::Panel>();
+    panel->setSize(800, 600);
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        auto button = std::make_shared<tgui::Button>();
+        button->setPosition(tgui::bindWidth(panel) * ((i % 10) / 10.f), tgui::bindHeight(panel) * ((i / 10) / 100.f));
+        button->setSize(tgui::bindWidth(panel) / 10, tgui::bindHeight(panel) / 100);
+        panel->add(button);
+    }
+
+    state.setItemsPerIteration(1000);
+    while (state.keepRunning())
+        panel->setSize(state.getIterations() % 2 ? 800.f : 1024.f, 600);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Layouts/Chain/100 widgets") {
+    auto panel = std::make_shared<tgui::Panel>();
+    auto previous = std::make_shared<tgui::Button>();
+    previous->setSize(20, 20);
+    panel->add(previous);
+
+    auto first = previous;
+    for (std::size_t i = 1; i < 100; ++i)
+    {
+        auto button = std::make_shared<tgui::Button>();
+        button->setPosition(tgui::bindRight(previous) + 2, tgui::bindTop(previous));
+        button->setSize(tgui::bindSize(previous));
+        panel->add(button);
+        previous = button;
+    }
+
+    state.setItemsPerIteration(100);
+    while (state.keepRunning())
+        first->setPosition(state.getIterations() % 2 ? 10.f : 0.f, 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Layouts/Parse/Expression") {
+    auto panel = std::make_shared<tgui::Panel>();
+    auto button = std::make_shared<tgui::Button>();
+    panel->add(button);
+
+    while (state.keepRunning())
+        button->setSize("&.width / 4 + 10", "&.height > 100 ? 40 : &.height / 3");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Layouts/HorizontalLayout/100 widgets") {
+    auto layout = std::make_shared<tgui::HorizontalLayout>();
+    layout->setSize(800, 50);
+    for (std::size_t i = 0; i < 100; ++i)
+        layout->add(std::make_shared<tgui::Button>());
+
+    state.setItemsPerIteration(100);
+    while (state.keepRunning())
+        layout->setSize(state.getIterations() % 2 ? 800.f : 1024.f, 50);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Builds a layout with a thousand rows from scratch, optionally inside a beginUpdate/endUpdate batch
+    void benchmarkVerticalLayoutBuild(bench::State& state, bool batched)
+    {
+        state.setItemsPerIteration(1000);
+        while (state.keepRunning())
+        {
+            auto layout = std::make_shared<tgui::VerticalLayout>();
+            layout->setSize(800, 20000);
+
+            if (batched)
+                layout->beginUpdate();
+
+            for (std::size_t i = 0; i < 1000; ++i)
+            {
+                auto button = std::make_shared<tgui::Button>();
+                layout->add(button);
+                layout->setRatio(i, 1 + (i % 3));
+            }
+
+            if (batched)
+                layout->endUpdate();
+
+            bench::doNotOptimize(layout);
+        }
+    }
+
+    void benchmarkGridBuild(bench::State& state, bool batched)
+    {
+        state.setItemsPerIteration(3000);
+        while (state.keepRunning())
+        {
+            auto grid = std::make_shared<tgui::Grid>();
+
+            if (batched)
+                grid->beginUpdate();
+
+            for (unsigned int row = 0; row < 1000; ++row)
+            {
+                for (unsigned int col = 0; col < 3; ++col)
+                {
+                    auto button = std::make_shared<tgui::Button>();
+                    button->setSize(80, 20);
+                    grid->addWidget(button, row, col, {2});
+                }
+            }
+
+            if (batched)
+                grid->endUpdate();
+
+            bench::doNotOptimize(grid);
+        }
+    }
+
+    // Grows and shrinks a single widget in the middle of a big grid, like a button of which the text changes
+    void benchmarkGridResize(bench::State& state, unsigned int row)
+    {
+        auto grid = std::make_shared<tgui::Grid>();
+        grid->beginUpdate();
+
+        std::vector<tgui::Button::Ptr> buttons;
+        for (unsigned int r = 0; r < 1000; ++r)
+        {
+            for (unsigned int col = 0; col < 3; ++col)
+            {
+                auto button = std::make_shared<tgui::Button>();
+                button->setSize(80, 20);
+                grid->addWidget(button, r, col, {2});
+                buttons.push_back(button);
+            }
+        }
+
+        grid->endUpdate();
+
+        auto& button = buttons[row * 3 + 1];
+        while (state.keepRunning())
+        {
+            button->setSize(120, 30);
+            button->setSize(80, 20);
+        }
+
+        bench::doNotOptimize(grid);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Layouts/Build/VerticalLayout 1000 rows") {
+    benchmarkVerticalLayoutBuild(state, false);
+}
+
+BENCHMARK("Layouts/Build/VerticalLayout 1000 rows batched") {
+    benchmarkVerticalLayoutBuild(state, true);
+}
+
+BENCHMARK("Layouts/Build/Grid 1000 rows") {
+    benchmarkGridBuild(state, false);
+}
+
+BENCHMARK("Layouts/Build/Grid 1000 rows batched") {
+    benchmarkGridBuild(state, true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Layouts/Resize/Grid widget in first row") {
+    benchmarkGridResize(state, 0);
+}
+
+BENCHMARK("Layouts/Resize/Grid widget in last row") {
+    benchmarkGridResize(state, 999);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
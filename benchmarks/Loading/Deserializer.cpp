@@ -0,0 +1,74 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "../Benchmark.hpp"
+#include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Global.hpp>
+
+namespace
+{
+    // Deserializes a thousand values of which only a few are unique, like when loading many widgets from the same theme
+    void benchmarkDeserialize(bench::State& state, bool cacheEnabled)
+    {
+        std::vector<std::string> colors;
+        std::vector<std::string> borders;
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            colors.push_back("rgb(" + tgui::to_string(i % 50) + ", 100, 200)");
+            borders.push_back("(" + tgui::to_string(i % 10) + ", 2, 3, 4)");
+        }
+
+        tgui::Deserializer::setCacheEnabled(cacheEnabled);
+        tgui::Deserializer::clearCache();
+
+        state.setItemsPerIteration(2000);
+        while (state.keepRunning())
+        {
+            for (std::size_t i = 0; i < 1000; ++i)
+            {
+                bench::doNotOptimize(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Color, colors[i]));
+                bench::doNotOptimize(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Borders, borders[i]));
+            }
+        }
+
+        state.setCounter("cache_hits", static_cast<double>(tgui::Deserializer::getCacheHits()));
+        state.setCounter("cache_misses", static_cast<double>(tgui::Deserializer::getCacheMisses()));
+
+        tgui::Deserializer::setCacheEnabled(false);
+        tgui::Deserializer::clearCache();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/Deserializer/Colors and borders") {
+    benchmarkDeserialize(state, false);
+}
+
+BENCHMARK("Loading/Deserializer/Colors and borders with cache") {
+    benchmarkDeserialize(state, true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
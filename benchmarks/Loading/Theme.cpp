@@ -0,0 +1,173 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "../Benchmark.hpp"
+#include <TGUI/TGUI.hpp>
+#include <cstdio>
+#include <fstream>
+
+namespace
+{
+    void benchmarkThemeApplication(bench::State& state, bool cacheEnabled)
+    {
+        auto theme = std::make_shared<tgui::Theme>("resources/Black.txt");
+
+        tgui::Deserializer::setCacheEnabled(cacheEnabled);
+        tgui::Deserializer::clearCache();
+
+        state.setItemsPerIteration(400);
+        while (state.keepRunning())
+        {
+            for (std::size_t i = 0; i < 100; ++i)
+            {
+                bench::doNotOptimize(theme->load("Button"));
+                bench::doNotOptimize(theme->load("EditBox"));
+                bench::doNotOptimize(theme->load("ListBox"));
+                bench::doNotOptimize(theme->load("ChildWindow"));
+            }
+        }
+
+        state.setCounter("cache_hits", static_cast<double>(tgui::Deserializer::getCacheHits()));
+        state.setCounter("cache_misses", static_cast<double>(tgui::Deserializer::getCacheMisses()));
+
+        tgui::Deserializer::setCacheEnabled(false);
+        tgui::Deserializer::clearCache();
+    }
+
+    void writeThemeFile(const std::string& filename, const std::string& textColor)
+    {
+        std::ofstream file{filename};
+        file << "Button {\n"
+                "    TextColorNormal : " << textColor << ";\n"
+                "    TextColorHover : rgb(250, 250, 250);\n"
+                "    BackgroundColorNormal : rgb(50, 50, 50);\n"
+                "}\n"
+                "EditBox {\n"
+                "    TextColor : rgb(200, 200, 200);\n"
+                "}\n";
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/Theme/Load widgets") {
+    benchmarkThemeApplication(state, false);
+}
+
+BENCHMARK("Loading/Theme/Load widgets with deserializer cache") {
+    benchmarkThemeApplication(state, true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/Theme/SetProperty 5k widgets") {
+    auto theme = std::make_shared<tgui::Theme>("resources/Black.txt");
+
+    std::vector<tgui::Widget::Ptr> widgets;
+    for (std::size_t i = 0; i < 5000; ++i)
+    {
+        widgets.push_back(theme->load("Button"));
+        widgets.push_back(theme->load("EditBox"));
+    }
+
+    state.setItemsPerIteration(5000);
+    while (state.keepRunning())
+        theme->setProperty("Button", "TextColorNormal", state.getIterations() % 2 ? "rgb(190, 190, 190)" : "rgb(200, 0, 0)");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/Theme/SetProperty class without widgets") {
+    auto theme = std::make_shared<tgui::Theme>("resources/Black.txt");
+
+    std::vector<tgui::Widget::Ptr> widgets;
+    for (std::size_t i = 0; i < 5000; ++i)
+    {
+        widgets.push_back(theme->load("Button"));
+        widgets.push_back(theme->load("EditBox"));
+    }
+
+    // Only the widgets of the changed class should be visited, so this should not depend on the amount of loaded widgets
+    while (state.keepRunning())
+        theme->setProperty("Label", "TextColor", state.getIterations() % 2 ? "rgb(190, 190, 190)" : "rgb(200, 0, 0)");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/Theme/Reload changed file 1k widgets") {
+    const std::string filename = "ThemeBenchmark.txt";
+    writeThemeFile(filename, "rgb(0, 0, 0)");
+
+    auto theme = std::make_shared<tgui::Theme>(filename);
+    std::vector<tgui::Widget::Ptr> widgets;
+    for (std::size_t i = 0; i < 1000; ++i)
+        widgets.push_back(theme->load("Button"));
+
+    tgui::ThemeWatcher watcher;
+    watcher.watch(theme);
+
+    // The length of the color changes on every iteration so that the change is also noticed when only comparing file sizes
+    double totalReloadDuration = 0;
+    state.setItemsPerIteration(1000);
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        writeThemeFile(filename, state.getIterations() % 2 ? "rgb(0, 0, 0)" : "rgb(255, 255, 255)");
+        state.resumeTiming();
+
+        watcher.poll();
+
+        state.pauseTiming();
+        totalReloadDuration += watcher.getLastReloadDuration().asMicroseconds();
+        state.resumeTiming();
+    }
+
+    if (state.getIterations() > 0)
+        state.setCounter("reload_duration_us", totalReloadDuration / state.getIterations());
+
+    state.setCounter("reloads", static_cast<double>(watcher.getReloadCount()));
+
+    watcher.unwatch(theme);
+    std::remove(filename.c_str());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/Theme/ReloadChangedProperties unchanged file 1k widgets") {
+    const std::string filename = "ThemeBenchmark.txt";
+    writeThemeFile(filename, "rgb(0, 0, 0)");
+
+    auto theme = std::make_shared<tgui::Theme>(filename);
+    std::vector<tgui::Widget::Ptr> widgets;
+    for (std::size_t i = 0; i < 1000; ++i)
+        widgets.push_back(theme->load("Button"));
+
+    while (state.keepRunning())
+        theme->reloadChangedProperties();
+
+    std::remove(filename.c_str());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,218 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "../Benchmark.hpp"
+#include <TGUI/TGUI.hpp>
+#include <algorithm>
+#include <sstream>
+
+namespace
+{
+    // Creates panels that each contain a mix of buttons, labels and edit boxes.
+    // The hidden panels are the ones that can be loaded lazily.
+    tgui::Panel::Ptr createWidgetTree(std::size_t panelCount, std::size_t widgetsPerPanel, std::size_t visiblePanelCount)
+    {
+        auto root = std::make_shared<tgui::Panel>();
+        for (std::size_t i = 0; i < panelCount; ++i)
+        {
+            auto panel = std::make_shared<tgui::Panel>();
+            panel->setSize(400, 300);
+            if (i >= visiblePanelCount)
+                panel->hide();
+
+            root->add(panel, "Panel" + tgui::to_string(i));
+
+            for (std::size_t j = 0; j < widgetsPerPanel; ++j)
+            {
+                tgui::Widget::Ptr widget;
+                if (j % 3 == 0)
+                {
+                    auto button = std::make_shared<tgui::Button>();
+                    button->setText("Button " + tgui::to_string(j));
+                    widget = button;
+                }
+                else if (j % 3 == 1)
+                {
+                    auto label = std::make_shared<tgui::Label>();
+                    label->setText("Label " + tgui::to_string(j));
+                    widget = label;
+                }
+                else
+                {
+                    auto editBox = std::make_shared<tgui::EditBox>();
+                    editBox->setDefaultText("Edit box " + tgui::to_string(j));
+                    widget = editBox;
+                }
+
+                widget->setPosition(10, j * 30.f);
+                widget->setSize(200, 25);
+                panel->add(widget, "Widget" + tgui::to_string(i) + "_" + tgui::to_string(j));
+            }
+        }
+
+        return root;
+    }
+
+    std::string createWidgetFile(std::size_t panelCount, std::size_t widgetsPerPanel, std::size_t visiblePanelCount)
+    {
+        std::stringstream stream;
+        createWidgetTree(panelCount, widgetsPerPanel, visiblePanelCount)->saveWidgetsToStream(stream);
+        return stream.str();
+    }
+
+    void benchmarkLoad(bench::State& state, bool lazy)
+    {
+        const std::string file = createWidgetFile(100, 50, 2);
+
+        tgui::WidgetLoader::setLazyLoadingEnabled(lazy);
+        tgui::WidgetLoader::resetMaterializedWidgetCount();
+
+        state.setBytesPerIteration(file.length());
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            auto parent = std::make_shared<tgui::Panel>();
+            std::stringstream stream{file};
+            state.resumeTiming();
+
+            tgui::WidgetLoader::load(parent, stream);
+
+            // The destruction of the widgets isn't part of the loading time
+            state.pauseTiming();
+            parent = nullptr;
+            state.resumeTiming();
+        }
+
+        if (state.getIterations() > 0)
+            state.setCounter("materialized_widgets", static_cast<double>(tgui::WidgetLoader::getMaterializedWidgetCount() / state.getIterations()));
+
+        tgui::WidgetLoader::setLazyLoadingEnabled(false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/DataIO/Parse 5k widgets") {
+    const std::string file = createWidgetFile(100, 50, 100);
+
+    state.setBytesPerIteration(file.length());
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        std::stringstream stream{file};
+        state.resumeTiming();
+
+        bench::doNotOptimize(tgui::DataIO::parse(stream));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/DataIO/Emit 5k widgets") {
+    std::stringstream input{createWidgetFile(100, 50, 100)};
+    const auto rootNode = tgui::DataIO::parse(input);
+
+    std::size_t bytes = 0;
+    while (state.keepRunning())
+    {
+        std::stringstream stream;
+        tgui::DataIO::emit(rootNode, stream);
+
+        state.pauseTiming();
+        bytes = static_cast<std::size_t>(stream.tellp());
+        state.resumeTiming();
+    }
+
+    state.setBytesPerIteration(bytes);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/WidgetSaver/Stream 10k widgets") {
+    auto root = createWidgetTree(100, 100, 100);
+    const std::size_t memoryBefore = bench::getResidentMemory();
+    std::size_t memoryPeak = memoryBefore;
+
+    std::size_t bytes = 0;
+    while (state.keepRunning())
+    {
+        std::stringstream stream;
+        tgui::WidgetSaver::save(root, stream);
+
+        state.pauseTiming();
+        bytes = static_cast<std::size_t>(stream.tellp());
+        memoryPeak = std::max(memoryPeak, bench::getResidentMemory());
+        state.resumeTiming();
+    }
+
+    state.setBytesPerIteration(bytes);
+    state.setCounter("rss_growth_bytes", static_cast<double>(memoryPeak - memoryBefore));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/WidgetSaver/Node tree 10k widgets") {
+    auto root = createWidgetTree(100, 100, 100);
+    const std::size_t memoryBefore = bench::getResidentMemory();
+    std::size_t memoryPeak = memoryBefore;
+
+    // This is how widget files were saved before they could be streamed: build all nodes first and then emit them
+    std::size_t bytes = 0;
+    while (state.keepRunning())
+    {
+        auto rootNode = std::make_shared<tgui::DataIO::Node>();
+        {
+            tgui::DataIO::Emitter emitter{*rootNode};
+            for (auto& widget : root->getWidgets())
+                tgui::WidgetSaver::emitWidget(widget, emitter);
+        }
+
+        state.pauseTiming();
+        memoryPeak = std::max(memoryPeak, bench::getResidentMemory());
+        state.resumeTiming();
+
+        std::stringstream stream;
+        tgui::DataIO::emit(rootNode, stream);
+
+        state.pauseTiming();
+        bytes = static_cast<std::size_t>(stream.tellp());
+        state.resumeTiming();
+    }
+
+    state.setBytesPerIteration(bytes);
+    state.setCounter("rss_growth_bytes", static_cast<double>(memoryPeak - memoryBefore));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/WidgetLoader/Eager 5k widgets") {
+    benchmarkLoad(state, false);
+}
+
+BENCHMARK("Loading/WidgetLoader/Lazy 5k widgets") {
+    benchmarkLoad(state, true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
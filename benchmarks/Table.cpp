@@ -0,0 +1,171 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/TGUI.hpp>
+#include <TGUI/Widgets/devel/Table.hpp>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    const std::size_t RowCount = 1000000;
+
+    tgui::ColumnTableDataSource::Ptr createDataSource()
+    {
+        auto source = std::make_shared<tgui::ColumnTableDataSource>(3);
+        source->reserve(RowCount);
+        for (std::size_t i = 0; i < RowCount; ++i)
+            source->addRow({tgui::to_string(i), "Sensor " + tgui::to_string(i % 64), tgui::to_string(i * 0.25)});
+
+        return source;
+    }
+
+    tgui::Table::Ptr createTable()
+    {
+        auto table = std::make_shared<tgui::Table>();
+        table->setFont(bench::getFont());
+        table->setSize(800, 600);
+        table->setHeaderColumns({"Sample", "Source", "Value"});
+        table->setStripesRowsColor({255, 255, 255}, {230, 230, 230});
+        return table;
+    }
+
+    // Sort keys owned by the application, the cells of the data source are only strings
+    std::vector<double> createSortKeys()
+    {
+        std::vector<double> keys(RowCount);
+        for (std::size_t i = 0; i < RowCount; ++i)
+            keys[i] = static_cast<double>((i * 2654435761u) % RowCount);
+
+        return keys;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Widgets/Table/Fill 1M rows") {
+    auto table = createTable();
+
+    state.setItemsPerIteration(RowCount);
+    while (state.keepRunning())
+    {
+        table->setDataSource(createDataSource());
+        bench::doNotOptimize(table->getWidgets().size());
+    }
+
+    state.setCounter("row_widgets", static_cast<double>(table->getWidgets().size()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Widgets/Table/Scroll 1M rows") {
+    auto table = createTable();
+    table->setDataSource(createDataSource());
+
+    // Every iteration scrolls down by one mouse wheel step, jumping back to the top when the end is reached
+    while (state.keepRunning())
+    {
+        if (table->getScrollOffset() + table->getSize().y >= table->getContentHeight())
+            table->setScrollOffset(0);
+        else
+            table->mouseWheelMoved(-1, 0, 0);
+    }
+
+    state.setCounter("row_widgets", static_cast<double>(table->getWidgets().size()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Widgets/Table/Jump 1M rows") {
+    auto table = createTable();
+    table->setDataSource(createDataSource());
+
+    // Jumps to unrelated positions, like when dragging a scrollbar, so all visible rows have to be refilled
+    std::size_t position = 0;
+    while (state.keepRunning())
+    {
+        position = (position + 7919 * 21) % static_cast<std::size_t>(table->getContentHeight());
+        table->setScrollOffset(static_cast<double>(position));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Widgets/Table/Sort 1M rows") {
+    auto table = createTable();
+    table->setDataSource(createDataSource());
+    tgui::Widget::Ptr widget = table;
+
+    const auto keys = createSortKeys();
+    bool ascending = false;
+
+    // Only the time spent on the gui thread is measured: requesting the sort and the updates until the new order is shown
+    double longestFrame = 0;
+    auto measureFrame = [&](const std::function<void()>& function) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        longestFrame = std::max(longestFrame, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    };
+
+    state.setItemsPerIteration(RowCount);
+    while (state.keepRunning())
+    {
+        ascending = !ascending;
+        measureFrame([&]{
+            table->sortRows([&keys, ascending](std::size_t left, std::size_t right){
+                return ascending ? (keys[left] < keys[right]) : (keys[right] < keys[left]);
+            });
+        });
+
+        while (table->isRowOrderPending())
+        {
+            state.pauseTiming();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            state.resumeTiming();
+
+            measureFrame([&]{ widget->update(sf::milliseconds(1)); });
+        }
+    }
+
+    state.setCounter("longest_frame_ms", longestFrame);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Widgets/Table/Sort 1M rows on gui thread") {
+    const auto keys = createSortKeys();
+
+    // What a frame would cost if the rows were sorted without the worker thread
+    state.setItemsPerIteration(RowCount);
+    while (state.keepRunning())
+    {
+        bench::doNotOptimize(tgui::priv::RowOrderTask::calculate(RowCount, nullptr, [&keys](std::size_t left, std::size_t right){
+            return keys[left] < keys[right];
+        }));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,99 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/TGUI.hpp>
+
+namespace
+{
+    const std::size_t LabelCount = 5000;
+
+    // Fills the gui with a large form: every label has a few words and some of them have to be word-wrapped
+    std::vector<tgui::Label::Ptr> fillGui(tgui::Gui& gui)
+    {
+        std::vector<tgui::Label::Ptr> labels;
+        for (std::size_t i = 0; i < LabelCount; ++i)
+        {
+            auto label = std::make_shared<tgui::Label>();
+            label->setText("Field " + tgui::to_string(i) + ": the value of this field in the form");
+            label->setPosition(10 + (i % 10) * 150.f, 10 + (i / 10) * 30.f);
+            if (i % 4 == 0)
+                label->setMaximumTextWidth(140);
+
+            gui.add(label);
+            labels.push_back(label);
+        }
+
+        return labels;
+    }
+
+    // Switches between two different fonts, so that every label has to rearrange its text in each iteration
+    void benchmarkFontSwitch(bench::State& state, unsigned int threads, bool batched)
+    {
+        auto otherFont = std::make_shared<sf::Font>();
+        if (!otherFont->loadFromFile("resources/DroidSansArmenian.ttf"))
+            return state.skip("font not found");
+
+        const tgui::Font fonts[] = {bench::getFont(), otherFont};
+
+        tgui::Gui gui;
+        auto labels = fillGui(gui);
+        gui.setFont(fonts[0]);
+
+        tgui::TextLayoutBatch::setThreadCount(threads);
+
+        state.setItemsPerIteration(LabelCount);
+        while (state.keepRunning())
+        {
+            const tgui::Font& font = fonts[state.getIterations() % 2 ? 0 : 1];
+            if (batched)
+                gui.setFont(font);
+            else
+            {
+                for (auto& label : labels)
+                    label->setFont(font);
+            }
+        }
+
+        state.setCounter("threads", batched ? tgui::TextLayoutBatch::getThreadCount() : 1);
+        tgui::TextLayoutBatch::setThreadCount(0);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("TextLayout/Font switch 5000 labels/Serial") {
+    benchmarkFontSwitch(state, 1, false);
+}
+
+BENCHMARK("TextLayout/Font switch 5000 labels/Batch 1 thread") {
+    benchmarkFontSwitch(state, 1, true);
+}
+
+BENCHMARK("TextLayout/Font switch 5000 labels/Batch all threads") {
+    benchmarkFontSwitch(state, 0, true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,301 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/TGUI.hpp>
+#include <TGUI/Widgets/devel/RichTextLabel.hpp>
+
+namespace
+{
+    // Returns text of the requested length consisting of words and spaces, with a newline every few hundred characters
+    std::string generateText(std::size_t length)
+    {
+        const std::string words = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore. ";
+
+        std::string text;
+        text.reserve(length);
+        while (text.length() < length)
+        {
+            text += words;
+            if (text.length() % 7 == 0)
+                text += '\n';
+        }
+
+        text.resize(length);
+        return text;
+    }
+
+    template <typename WidgetType>
+    void benchmarkConstruction(bench::State& state)
+    {
+        state.setItemsPerIteration(100);
+        while (state.keepRunning())
+        {
+            for (std::size_t i = 0; i < 100; ++i)
+                bench::doNotOptimize(std::make_shared<WidgetType>());
+        }
+    }
+
+    void benchmarkTyping(bench::State& state, const std::string& validator, const std::string& characters)
+    {
+        auto editBox = std::make_shared<tgui::EditBox>();
+        editBox->setFont(bench::getFont());
+        editBox->setSize(300, 30);
+        editBox->setInputValidator(validator);
+
+        state.setItemsPerIteration(1000);
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            editBox->setText("");
+            state.resumeTiming();
+
+            for (std::size_t i = 0; i < 1000; ++i)
+                editBox->textEntered(characters[i % characters.length()]);
+        }
+
+        state.setCounter("final_length", static_cast<double>(editBox->getText().getSize()));
+    }
+
+    void benchmarkLargeTextBoxKeystroke(bench::State& state, bool textChangedConnected)
+    {
+        auto textBox = std::make_shared<tgui::TextBox>();
+        textBox->setFont(bench::getFont());
+        textBox->setSize(600, 400);
+        textBox->setText(generateText(1024 * 1024));
+
+        std::size_t textChangedCount = 0;
+        if (textChangedConnected)
+            textBox->connect("TextChanged", [&]{ ++textChangedCount; });
+
+        const sf::Event::KeyEvent backspace{sf::Keyboard::BackSpace, false, false, false, false};
+
+        // Every iteration types a character and removes it again, so that the text keeps its size
+        state.setItemsPerIteration(2);
+        while (state.keepRunning())
+        {
+            textBox->textEntered('a');
+            textBox->keyPressed(backspace);
+        }
+
+        state.setCounter("text_changed_signals", static_cast<double>(textChangedCount));
+    }
+
+    // Updates 100 readouts that show a changing counter, like a dashboard does every frame
+    void benchmarkLabelCounters(bench::State& state, bool numericMode)
+    {
+        std::vector<tgui::Label::Ptr> labels;
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            auto label = std::make_shared<tgui::Label>();
+            label->setFont(bench::getFont());
+            if (numericMode)
+                label->setNumericMode(8);
+
+            labels.push_back(label);
+        }
+
+        std::vector<sf::String> values;
+        for (std::size_t i = 0; i < 1000; ++i)
+            values.push_back(tgui::to_string(i * 37.5f));
+
+        state.setItemsPerIteration(labels.size());
+        while (state.keepRunning())
+        {
+            for (std::size_t i = 0; i < labels.size(); ++i)
+                labels[i]->setText(values[(state.getIterations() + i) % values.size()]);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Widgets/Construct/Button") {
+    benchmarkConstruction<tgui::Button>(state);
+}
+
+BENCHMARK("Widgets/Construct/Label") {
+    benchmarkConstruction<tgui::Label>(state);
+}
+
+BENCHMARK("Widgets/Construct/EditBox") {
+    benchmarkConstruction<tgui::EditBox>(state);
+}
+
+BENCHMARK("Widgets/Construct/TextBox") {
+    benchmarkConstruction<tgui::TextBox>(state);
+}
+
+BENCHMARK("Widgets/Construct/ListBox") {
+    benchmarkConstruction<tgui::ListBox>(state);
+}
+
+BENCHMARK("Widgets/Construct/ChildWindow") {
+    benchmarkConstruction<tgui::ChildWindow>(state);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Widgets/TextWrap/TextBox 64KB") {
+    auto textBox = std::make_shared<tgui::TextBox>();
+    textBox->setFont(bench::getFont());
+    const std::string text = generateText(64 * 1024);
+
+    state.setBytesPerIteration(text.length());
+    while (state.keepRunning())
+    {
+        // Changing the width forces all lines to be rearranged
+        textBox->setSize(state.getIterations() % 2 ? 400.f : 300.f, 300);
+        textBox->setText(text);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Widgets/TextWrap/Label 4KB") {
+    auto label = std::make_shared<tgui::Label>();
+    label->setFont(bench::getFont());
+    label->setText(generateText(4 * 1024));
+
+    state.setBytesPerIteration(4 * 1024);
+    while (state.keepRunning())
+        label->setMaximumTextWidth(state.getIterations() % 2 ? 400.f : 300.f);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Widgets/Label/100 counters with setText") {
+    benchmarkLabelCounters(state, false);
+}
+
+BENCHMARK("Widgets/Label/100 counters in numeric mode") {
+    benchmarkLabelCounters(state, true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Widgets/TextWrap/ChatBox 1k lines") {
+    auto chatBox = std::make_shared<tgui::ChatBox>();
+    chatBox->setFont(bench::getFont());
+    chatBox->setSize(300, 300);
+
+    const std::string line = generateText(120);
+    for (std::size_t i = 0; i < 1000; ++i)
+        chatBox->addLine(line);
+
+    state.setItemsPerIteration(1000);
+    while (state.keepRunning())
+        chatBox->setSize(state.getIterations() % 2 ? 400.f : 300.f, 300);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Widgets/ChatBox/AddLine") {
+    auto chatBox = std::make_shared<tgui::ChatBox>();
+    chatBox->setFont(bench::getFont());
+    chatBox->setSize(300, 300);
+    const std::string line = generateText(120);
+
+    state.setItemsPerIteration(100);
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        chatBox->removeAllLines();
+        state.resumeTiming();
+
+        for (std::size_t i = 0; i < 100; ++i)
+            chatBox->addLine(line);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Widgets/RichTextLabel/Log 100 lines with setText") {
+    auto label = std::make_shared<tgui::RichTextLabel>();
+    label->setFont(bench::getFont());
+    label->setTextSize(14);
+    const sf::String line = "#red *Error:* _" + generateText(80) + "_\n";
+
+    // How a log had to be updated before appendText existed: every line parses and lays out the whole text again
+    state.setItemsPerIteration(100);
+    while (state.keepRunning())
+    {
+        sf::String text;
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            text += line;
+            label->setText(text);
+        }
+    }
+}
+
+BENCHMARK("Widgets/RichTextLabel/Log 100 lines with appendText") {
+    auto label = std::make_shared<tgui::RichTextLabel>();
+    label->setFont(bench::getFont());
+    label->setTextSize(14);
+    const sf::String line = "#red *Error:* _" + generateText(80) + "_\n";
+
+    state.setItemsPerIteration(100);
+    while (state.keepRunning())
+    {
+        label->setText("");
+        for (std::size_t i = 0; i < 100; ++i)
+            label->appendText(line);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Widgets/EditBox/Typing 1k characters") {
+    benchmarkTyping(state, ".*", "abcdefghijklmnopqrstuvwxyz");
+}
+
+BENCHMARK("Widgets/EditBox/Typing 1k characters Int") {
+    benchmarkTyping(state, tgui::EditBox::Validator::Int, "1234567890");
+}
+
+BENCHMARK("Widgets/EditBox/Typing 1k characters Float") {
+    benchmarkTyping(state, tgui::EditBox::Validator::Float, "1234567890");
+}
+
+BENCHMARK("Widgets/EditBox/Typing 1k characters Hex") {
+    benchmarkTyping(state, tgui::EditBox::Validator::Hex, "0123456789abcdef");
+}
+
+BENCHMARK("Widgets/EditBox/Typing 1k characters custom regex") {
+    benchmarkTyping(state, "[a-z ]*", "abcdefghijklmnopqrstuvwxyz ");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Widgets/TextBox/Keystroke 1MB") {
+    benchmarkLargeTextBoxKeystroke(state, false);
+}
+
+BENCHMARK("Widgets/TextBox/Keystroke 1MB with TextChanged") {
+    benchmarkLargeTextBoxKeystroke(state, true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
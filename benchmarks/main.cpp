@@ -0,0 +1,112 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+namespace
+{
+    void printUsage(const char* program)
+    {
+        std::cerr << "Usage: " << program << " [options]\n"
+                  << "  --filter <text>         Only run the benchmarks that contain the text in their name\n"
+                  << "  --min-time <seconds>    Minimum time that each benchmark runs (default: 0.5)\n"
+                  << "  --min-iterations <n>    Minimum amount of iterations of each benchmark (default: 1)\n"
+                  << "  --max-iterations <n>    Maximum amount of iterations of each benchmark (default: 1000000)\n"
+                  << "  --no-render             Skip the benchmarks that need an offscreen render target\n"
+                  << "  --output <file>         Write the JSON report to a file instead of the standard output\n"
+                  << "  --list                  Print the names of the benchmarks without running them\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    bench::Settings settings;
+    std::string outputFilename;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = (i + 1 < argc);
+
+        if ((arg == "--filter") && hasValue)
+            settings.filter = argv[++i];
+        else if ((arg == "--min-time") && hasValue)
+            settings.minTime = std::stod(argv[++i]);
+        else if ((arg == "--min-iterations") && hasValue)
+            settings.minIterations = std::stoul(argv[++i]);
+        else if ((arg == "--max-iterations") && hasValue)
+            settings.maxIterations = std::stoul(argv[++i]);
+        else if ((arg == "--output") && hasValue)
+            outputFilename = argv[++i];
+        else if (arg == "--no-render")
+            settings.render = false;
+        else if (arg == "--list")
+        {
+            for (const auto& name : bench::getBenchmarkNames())
+                std::cout << name << "\n";
+            return 0;
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return (arg == "--help") ? 0 : 1;
+        }
+    }
+
+    // Drawing happens on an offscreen texture so that no window has to be opened
+    std::unique_ptr<sf::RenderTexture> renderTexture;
+    if (settings.render)
+    {
+        renderTexture = std::unique_ptr<sf::RenderTexture>(new sf::RenderTexture);
+        if (!renderTexture->create(1024, 768))
+        {
+            std::cerr << "Failed to create the offscreen render target, the drawing benchmarks will be skipped." << std::endl;
+            renderTexture = nullptr;
+            settings.render = false;
+        }
+    }
+
+    const auto results = bench::runBenchmarks(settings, renderTexture.get(), std::cerr);
+
+    if (outputFilename.empty())
+        bench::writeJson(std::cout, settings, results);
+    else
+    {
+        std::ofstream file{outputFilename};
+        if (!file.is_open())
+        {
+            std::cerr << "Failed to open '" << outputFilename << "' for writing." << std::endl;
+            return 1;
+        }
+
+        bench::writeJson(file, settings, results);
+    }
+
+    return 0;
+}
@@ -0,0 +1,372 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BINDING_HPP
+#define TGUI_BINDING_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+    class Label;
+    class ProgressBar;
+    class Slider;
+    class Knob;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Value of a model to which widget properties can be bound
+    ///
+    /// The value can be changed from any thread. Changing it doesn't touch the bound widgets, they are updated by the
+    /// Bindings object of the gui when the next frame is drawn. Setting a value that is equal to the current one is ignored.
+    ///
+    /// @code
+    /// auto temperature = std::make_shared<tgui::Observable<sf::String>>("0 C");
+    /// gui.getBindings().bindText(label, temperature);
+    /// temperature->set("21 C"); // The label shows the new text in the next frame
+    /// @endcode
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class Observable
+    {
+    public:
+
+        typedef std::shared_ptr<Observable<T>> Ptr; ///< Shared observable pointer
+        typedef std::shared_ptr<const Observable<T>> ConstPtr; ///< Shared constant observable pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param value  Initial value
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Observable(T value = T{}) :
+            m_value{std::move(value)}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the value
+        ///
+        /// @param value  New value
+        ///
+        /// This function may be called from any thread.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void set(T value)
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            if (m_value == value)
+                return;
+
+            m_value = std::move(value);
+            m_version.fetch_add(1, std::memory_order_release);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a copy of the value
+        ///
+        /// This function may be called from any thread.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        T get() const
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            return m_value;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a number that changes every time the value is changed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::uint64_t getVersion() const
+        {
+            return m_version.load(std::memory_order_acquire);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        mutable std::mutex m_mutex;
+        T m_value;
+        std::atomic<std::uint64_t> m_version{0};
+    };
+
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Connection between an observable and a widget, stored by the Bindings class
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API BindingBase
+        {
+        public:
+            virtual ~BindingBase() = default;
+
+            // Passes the value to the widget when it changed since the last call, returns whether the widget was updated
+            virtual bool apply() = 0;
+
+            // Returns whether the widget no longer exists
+            virtual bool isExpired() const = 0;
+
+            // Returns whether the binding belongs to the given widget
+            virtual bool isBoundTo(const Widget* widget) const = 0;
+
+            // Marks the binding as unbound. It is only destroyed once the bindings are no longer being applied.
+            void markRemoved()
+            {
+                m_removed = true;
+            }
+
+            bool isRemoved() const
+            {
+                return m_removed;
+            }
+
+        private:
+            bool m_removed = false;
+        };
+
+
+        template <typename WidgetClass, typename T, typename Function>
+        class Binding : public BindingBase
+        {
+        public:
+            Binding(const std::shared_ptr<WidgetClass>& widget, const std::shared_ptr<Observable<T>>& observable, Function function) :
+                m_widget    {widget},
+                m_observable{observable},
+                m_function  (std::move(function))
+            {
+            }
+
+            bool apply() override
+            {
+                // The version check keeps the cost of a binding that didn't change to a single atomic load
+                const std::uint64_t version = m_observable->getVersion();
+                if (m_applied && (version == m_version))
+                    return false;
+
+                m_version = version;
+
+                // The value may have changed back to what the widget already shows
+                T value = m_observable->get();
+                if (m_applied && (value == m_lastValue))
+                    return false;
+
+                const auto widget = m_widget.lock();
+                if (!widget)
+                    return false;
+
+                // The setter may send signals of which the handlers unbind the widget, so nothing may be changed afterwards
+                m_lastValue = value;
+                m_applied = true;
+                m_function(*widget, value);
+                return true;
+            }
+
+            bool isExpired() const override
+            {
+                return m_widget.expired();
+            }
+
+            bool isBoundTo(const Widget* widget) const override
+            {
+                const auto lockedWidget = m_widget.lock();
+                return lockedWidget && (lockedWidget.get() == widget);
+            }
+
+        private:
+            std::weak_ptr<WidgetClass> m_widget;
+            std::shared_ptr<Observable<T>> m_observable;
+            Function m_function;
+            std::uint64_t m_version = 0;
+            T m_lastValue{};
+            bool m_applied = false;
+        };
+    }
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Keeps widget properties in sync with observable values
+    ///
+    /// The gui owns a Bindings object and applies it once per frame, before the widgets are drawn. A binding only calls the
+    /// setter of its widget when the observed value differs from the value that was passed the last time, so a model that
+    /// changes thousands of times per second still causes at most one text layout or ValueChanged signal per frame.
+    ///
+    /// The bindings only keep weak references to the widgets, bindings of destroyed widgets are removed automatically.
+    /// All functions of this class must be called from the gui thread.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Bindings
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Binds a widget property to an observable value
+        ///
+        /// @param widget      Widget that should follow the value
+        /// @param observable  Value to observe
+        /// @param function    Function that is called with the widget and the new value
+        ///
+        /// The function is called immediately with the current value.
+        ///
+        /// @code
+        /// bindings.bind(editBox, name, [](tgui::EditBox& box, const sf::String& text){ box.setText(text); });
+        /// @endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename WidgetClass, typename T, typename Function>
+        void bind(const std::shared_ptr<WidgetClass>& widget, const std::shared_ptr<Observable<T>>& observable, Function function)
+        {
+            std::unique_ptr<priv::BindingBase> binding{new priv::Binding<WidgetClass, T, Function>{widget, observable, std::move(function)}};
+            m_bindings.push_back(std::move(binding));
+            applyNewBinding();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Binds the text of a label to an observable value
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindText(const std::shared_ptr<Label>& label, const std::shared_ptr<Observable<sf::String>>& observable);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Binds the value of a progress bar to an observable value
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindValue(const std::shared_ptr<ProgressBar>& progressBar, const std::shared_ptr<Observable<unsigned int>>& observable);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Binds the value of a slider to an observable value
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindValue(const std::shared_ptr<Slider>& slider, const std::shared_ptr<Observable<int>>& observable);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Binds the value of a knob to an observable value
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindValue(const std::shared_ptr<Knob>& knob, const std::shared_ptr<Observable<int>>& observable);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all bindings of a widget
+        ///
+        /// @param widget  Widget that should no longer follow its observed values
+        ///
+        /// This function may be called from a signal handler while the bindings are being applied.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unbind(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all bindings
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unbindAll();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Passes the values that changed since the last call to the widgets
+        ///
+        /// @return Amount of widget properties that were updated
+        ///
+        /// This function is called by the gui every frame.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t apply();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of bindings
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getBindingCount() const
+        {
+            return m_bindings.size();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times a widget property was updated by the bindings
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getUpdateCount() const
+        {
+            return m_updateCount;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes the current value to the widget of the binding that was just added
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyNewBinding();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Destroys the bindings that were unbound or of which the widget no longer exists
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeBindings();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::vector<std::unique_ptr<priv::BindingBase>> m_bindings;
+        std::size_t m_updateCount = 0;
+        bool m_applying = false;
+        bool m_removePending = false;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BINDING_HPP
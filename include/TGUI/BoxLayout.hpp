@@ -281,6 +281,15 @@ namespace tgui
         void removeAllWidgets() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the widget
+        ///
+        /// @return Approximate amount of bytes used by the widget, its renderer, its texts, its signals and its textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -290,6 +299,12 @@ namespace tgui
         virtual void updateWidgetPositions() = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Repositions the widgets once after a batch started with beginUpdate ends
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void applyPostponedUpdate() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,7 @@
 #include <functional>
 
 #include <TGUI/Global.hpp>
+#include <TGUI/WidgetType.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -52,8 +53,8 @@ namespace tgui
         // Pointer to the widget
         Widget* widget = nullptr;
 
-        // The type of the widget
-        std::string widgetType = "Unknown";
+        // The type of the widget, which can be compared with both other types and strings
+        WidgetType widgetType;
 
         // When the mouse has something to do with the callback then this data will be filled
         sf::Vector2i mouse;
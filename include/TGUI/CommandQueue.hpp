@@ -0,0 +1,322 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_COMMAND_QUEUE_HPP
+#define TGUI_COMMAND_QUEUE_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Queue of commands that can be posted from any thread and are executed on the thread that updates the gui
+    ///
+    /// Widgets may only be changed from the thread that draws the gui. Other threads can instead post a function that
+    /// changes the widgets, it is executed the next time the gui is updated.
+    ///
+    /// @code
+    /// // On a worker thread
+    /// gui.getCommandQueue().postUpdate(label, "Text", [=](tgui::Label& l){ l.setText(text); });
+    /// gui.getCommandQueue().post([=]{ chatBox->addLine(message); });
+    /// @endcode
+    ///
+    /// Posting never blocks: the commands are stored in a lock-free linked list with a single consumer. The Gui executes
+    /// the commands at the start of updateTime. A single frame executes at most getMaxBatchSize() commands and stops
+    /// earlier when the time budget is used up, the remaining commands are left for the next frame.
+    ///
+    /// Updates that are posted with a property name are coalesced: when the same property of the same widget was changed
+    /// multiple times since the last frame, only the last change is executed.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API CommandQueue
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandQueue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor, commands that were never executed are destroyed without being called
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~CommandQueue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted copy constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandQueue(const CommandQueue&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted assignment operator overload
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandQueue& operator=(const CommandQueue&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a command to the queue
+        ///
+        /// @param command  Function to call on the gui thread
+        ///
+        /// This function may be called from any thread.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> command);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a command that changes a property of an object to the queue
+        ///
+        /// @param object    Object of which the property is changed
+        /// @param property  Name of the changed property
+        /// @param command   Function to call on the gui thread
+        ///
+        /// When the queue contains multiple commands for the same object and property by the time they are executed, only
+        /// the last one is called. It is called at the place in the queue where it was posted.
+        ///
+        /// This function may be called from any thread.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(const void* object, std::string property, std::function<void()> command);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a command that changes a property of a widget to the queue
+        ///
+        /// @param widget    Widget of which the property is changed
+        /// @param property  Name of the changed property
+        /// @param function  Function that is called with the widget on the gui thread
+        ///
+        /// Redundant updates are coalesced like with the other post function. The queue only keeps a weak reference to the
+        /// widget, the function isn't called when the widget was destroyed before the command was executed.
+        ///
+        /// @code
+        /// queue.postUpdate(progressBar, "Value", [value](tgui::ProgressBar& bar){ bar.setValue(value); });
+        /// @endcode
+        ///
+        /// This function may be called from any thread.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename WidgetClass, typename Function>
+        void postUpdate(const std::shared_ptr<WidgetClass>& widget, std::string property, Function function)
+        {
+            std::weak_ptr<WidgetClass> weakWidget = widget;
+            post(widget.get(), std::move(property), [weakWidget, function]() mutable
+                {
+                    const auto lockedWidget = weakWidget.lock();
+                    if (lockedWidget)
+                        function(*lockedWidget);
+                });
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes the commands in the queue, oldest first
+        ///
+        /// @return Amount of commands that were called
+        ///
+        /// This function is called by the gui at the start of updateTime and may only be called from that thread.
+        /// At least one command is executed, even when the first command takes longer than the time budget.
+        ///
+        /// When a command throws, the exception is passed to the caller and the remaining commands stay in the queue.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t execute();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how long a single call to execute may spend on executing commands
+        ///
+        /// @param budget  Maximum time per frame, or sf::Time::Zero to execute commands until the batch is empty
+        ///
+        /// The budget is checked between commands, a slow command can thus make execute exceed it. The default is 2ms.
+        /// This function may only be called from the gui thread.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTimeBudget(sf::Time budget)
+        {
+            m_timeBudget = budget;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long a single call to execute may spend on executing commands
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTimeBudget() const
+        {
+            return m_timeBudget;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of commands that a single call to execute takes from the queue
+        ///
+        /// @param size  Maximum amount of commands per frame, the default is 1000
+        ///
+        /// This function may only be called from the gui thread.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaxBatchSize(std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of commands that a single call to execute takes from the queue
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getMaxBatchSize() const
+        {
+            return m_maxBatchSize;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of commands that were posted but not yet executed or coalesced
+        ///
+        /// This function may be called from any thread.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getDepth() const
+        {
+            return m_depth.load(std::memory_order_relaxed);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long the last call to execute took
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getLastDrainDuration() const
+        {
+            return m_lastDrainDuration;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the longest time that a call to execute took
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getMaxDrainDuration() const
+        {
+            return m_maxDrainDuration;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many commands were executed since the queue was created
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getExecutedCount() const
+        {
+            return m_executedCount;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many commands were dropped because a later command changed the same property
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getCoalescedCount() const
+        {
+            return m_coalescedCount;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Node
+        {
+            std::atomic<Node*> next{nullptr};
+            std::function<void()> command;
+            const void* object = nullptr;
+            std::string property;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Links a node to the end of the list, can be called from any thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void push(Node* node);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Unlinks the oldest node from the list, only called from the consumer thread.
+        // Returns a nullptr when the list is empty or when the next node is still being linked by another thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Node* pop();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the commands from the batch that are followed by a command for the same property of the same object
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void coalesceBatch();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Producers exchange the head, the consumer owns the tail. The stub node keeps the list non-empty.
+        std::atomic<Node*> m_head;
+        Node* m_tail;
+        Node m_stub;
+
+        // Commands that were taken from the list but could not be executed within the time budget
+        std::deque<Node*> m_batch;
+
+        std::atomic<std::size_t> m_depth{0};
+
+        sf::Time m_timeBudget = sf::milliseconds(2);
+        std::size_t m_maxBatchSize = 1000;
+
+        sf::Time m_lastDrainDuration;
+        sf::Time m_maxDrainDuration;
+        std::size_t m_executedCount = 0;
+        std::size_t m_coalescedCount = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_COMMAND_QUEUE_HPP
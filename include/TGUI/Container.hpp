@@ -28,6 +28,9 @@
 
 
 #include <list>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <TGUI/Widget.hpp>
 
@@ -35,6 +38,19 @@
 
 namespace tgui
 {
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Hash function that allows sf::String to be used as key in unordered containers
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct TGUI_API StringHash
+        {
+            std::size_t operator()(const sf::String& str) const;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Container widget
     ///
@@ -94,9 +110,12 @@ namespace tgui
         ///
         /// @return Vector of all widget pointers
         ///
+        /// Widgets that were not loaded yet because of lazy loading will be loaded by this function.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const std::vector<Widget::Ptr>& getWidgets()
         {
+            loadPendingWidgets();
             return m_widgets;
         }
 
@@ -109,6 +128,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const std::vector<sf::String>& getWidgetNames()
         {
+            loadPendingWidgets();
             return m_objName;
         }
 
@@ -133,6 +153,8 @@ namespace tgui
         ///
         /// @return Pointer to the earlier created widget
         ///
+        /// When the widget was not loaded yet because of lazy loading, the widgets in this container will be loaded first.
+        ///
         /// @warning This function will return nullptr when an unknown widget name was passed.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -158,6 +180,35 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget by following a path of widget names.
+        ///
+        /// @param path  Names of the widgets separated by dots, e.g. "panel.grid.okButton"
+        ///
+        /// Every name in the path is looked up in the container that was found with the previous part of the path.
+        ///
+        /// @return Pointer to the widget or nullptr when no widget could be found at that path
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getByPath(const sf::String& path) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget by following a path of widget names.
+        ///
+        /// @param path  Names of the widgets separated by dots, e.g. "panel.grid.okButton"
+        ///
+        /// @return Pointer to the widget or nullptr when no widget could be found at that path.
+        ///         The pointer will already be casted to the desired type.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
+        typename T::Ptr getByPath(const sf::String& path) const
+        {
+            return std::dynamic_pointer_cast<T>(getByPath(path));
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes a single widget that was added to the container.
         ///
@@ -188,6 +239,76 @@ namespace tgui
         bool setWidgetName(const Widget::Ptr& widget, const std::string& name);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts a batch of changes during which the container doesn't reposition its child widgets
+        ///
+        /// Layout containers such as Grid, HorizontalLayout and VerticalLayout recalculate the position and size of all their
+        /// widgets every time a widget is added or changed. Between beginUpdate and endUpdate this work is postponed and it
+        /// is only done once when endUpdate is called, which makes building large layouts a lot faster.
+        ///
+        /// Calls can be nested, the postponed work is done when the last endUpdate is called.
+        /// Prefer using an UpdateGuard, which calls endUpdate automatically.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends a batch of changes that was started with beginUpdate
+        ///
+        /// When this ends the outermost batch, the widgets are repositioned if anything changed during the batch.
+        /// Calling this function without a matching beginUpdate is an error, it asserts in debug builds and does nothing otherwise.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the container is inside a batch of changes started with beginUpdate
+        ///
+        /// @return True between beginUpdate and the matching endUpdate
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdating() const
+        {
+            return m_updateDepth > 0;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls beginUpdate on a container when created and endUpdate when destroyed
+        ///
+        /// @code
+        /// {
+        ///     tgui::Container::UpdateGuard guard{*grid};
+        ///     for (unsigned int row = 0; row < 1000; ++row)
+        ///         grid->addWidget(std::make_shared<tgui::Button>(), row, 0);
+        /// } // The grid only positions its widgets here
+        /// @endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class UpdateGuard
+        {
+        public:
+            explicit UpdateGuard(Container& container) :
+                m_container(container)
+            {
+                m_container.beginUpdate();
+            }
+
+            ~UpdateGuard()
+            {
+                m_container.endUpdate();
+            }
+
+            UpdateGuard(const UpdateGuard&) = delete;
+            UpdateGuard& operator=(const UpdateGuard&) = delete;
+
+        private:
+            Container& m_container;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the name of a widget.
         ///
@@ -227,6 +348,11 @@ namespace tgui
         /// The currently focused widget will be unfocused, even if it was the only widget.
         /// When no widget was focused, the first widget in the container will be focused.
         ///
+        /// Widgets inside child containers are part of the focus order, the order is determined by the tab index of the
+        /// widgets and the order in which they were added to their parent.
+        ///
+        /// @see Widget::setTabIndex
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void focusNextWidget();
 
@@ -237,6 +363,8 @@ namespace tgui
         /// The currently focused widget will be unfocused, even if it was the only widget.
         /// When no widget was focused, the last widget in the container will be focused.
         ///
+        /// @see focusNextWidget
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void focusPreviousWidget();
 
@@ -307,10 +435,81 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Save the child widgets to a text file
         ///
-        /// @param stream  stringstream to which the widget file will be added
+        /// @param stream  Stream to which the widget file will be written
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToStream(std::ostream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the container has child widgets that were not loaded yet.
+        ///
+        /// @return Are there widgets that still have to be loaded?
+        ///
+        /// @see WidgetLoader::setLazyLoadingEnabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool hasPendingWidgets() const
+        {
+            return m_pendingWidgetsLoader != nullptr;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the child widgets that were not loaded yet because of lazy loading.
+        ///
+        /// This happens automatically when the container is shown or when one of its widgets is requested.
+        ///
+        /// @see WidgetLoader::setLazyLoadingEnabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadPendingWidgets()
+        {
+            if (m_pendingWidgetsLoader)
+                loadPendingWidgetsImpl();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Sets the function that will create the child widgets once they are needed. The names of all widgets that will be
+        // created (including those inside child containers) are needed so that get can tell when they have to be loaded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPendingWidgets(const std::function<void(Container&)>& loader, const std::vector<sf::String>& widgetNames);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the container and loads its child widgets if this didn't happen yet.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void show() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the container itself
+        ///
+        /// @return Approximate amount of bytes used by the container, without the memory used by its child widgets
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by all widgets inside this container, grouped by type
+        ///
+        /// @return Map with the widget type (e.g. "Button") as key and the memory used by all widgets of that type as value
+        ///
+        /// Widgets inside child containers are included. Widgets that were not loaded yet because of lazy loading are not
+        /// created by this function and are thus not included.
+        ///
+        /// @code
+        /// std::size_t total = 0;
+        /// for (const auto& pair : gui.getContainer()->getMemoryUsageByType())
+        ///     total += pair.second.getTotal();
+        /// @endcode
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToStream(std::stringstream& stream);
+        std::map<std::string, MemoryUsage> getMemoryUsageByType() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -368,6 +567,17 @@ namespace tgui
         virtual Widget::Ptr askToolTip(sf::Vector2f mousePos) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns a number that changes every time a widget is added, removed, renamed or reordered in any container.
+        // This is used to find out when cached lookup results have become outdated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getWidgetNamesVersion()
+        {
+            return m_widgetNamesVersion;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -403,18 +613,11 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Focuses the next widget in the container. If the last widget was focused then all widgets will be unfocused and
-        // this function will return false.
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        bool focusNextWidgetInContainer();
-
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // When the tab key is pressed then this function is called. The focus will move to the next widget (if there is one).
-        // This function will only work when tabKeyUsageEnabled is true.
+        // When the tab key is pressed then this function is called. The focus will move to the next widget (if there is one),
+        // or to the previous widget when shift was held down. This function will only work when tabKeyUsageEnabled is true.
         // The function will return true when another widget was focused.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        bool tabKeyPressed();
+        bool tabKeyPressed(bool shiftPressed);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -430,17 +633,112 @@ namespace tgui
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the lookup tables after the widgets starting from the given index changed their position inside m_widgets.
+        // Derived classes that reorder m_widgets and m_objName themselves have to call this function afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgetIndices(std::size_t startIndex = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Derived classes call this before repositioning their widgets. When the container is inside a batch started with
+        // beginUpdate, true is returned and the work should be skipped: applyPostponedUpdate will be called later instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool postponeUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called by endUpdate when work was postponed during the batch
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void applyPostponedUpdate()
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the cached absolute position of this container and of all widgets inside it as outdated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidateAbsolutePosition() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the name of the widget at the given index to the name lookup table
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToNameIndex(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes a name of a widget from the name lookup table. The widget must no longer use the name inside m_objName.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFromNameIndex(const sf::String& name, const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the child widgets that were not loaded yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadPendingWidgetsImpl();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the focus order of this container and all its parents as outdated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateFocusOrder();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the focus order when it is outdated and returns the position in the focus order of the focused widget.
+        // When the focused widget can't be focused with the tab key, the position of the first widget behind it is returned.
+        // The size of the focus order is returned when no widget is focused.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getFocusOrderPosition();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widgets inside the given container that can be focused to the focus order
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void buildFocusOrder(const Container& container);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
         std::vector<Widget::Ptr> m_widgets;
         std::vector<sf::String>  m_objName;
 
+        // Lookup tables to find a widget by name or to find the index of a widget without looping over all widgets.
+        // When multiple widgets have the same name, the name refers to the one with the lowest index.
+        struct NameIndexEntry
+        {
+            const Widget* widget;
+            std::size_t count;
+        };
+        std::unordered_map<sf::String, NameIndexEntry, priv::StringHash> m_widgetsByName;
+        std::unordered_map<const Widget*, std::size_t> m_widgetIndices;
+
+        static std::size_t m_widgetNamesVersion;
+
+        // Widgets that can be focused with the tab key, including those inside child containers, in the order that they get focused.
+        // For every widget inside the container the position of that widget (or the first focusable widget behind it) is stored.
+        std::vector<Widget*> m_focusOrder;
+        std::unordered_map<const Widget*, std::size_t> m_focusOrderPositions;
+        bool m_focusOrderValid = false;
+
+        // Creates the child widgets that are not loaded yet, together with the names of the widgets that it will create
+        std::function<void(Container&)> m_pendingWidgetsLoader;
+        std::unordered_set<sf::String, priv::StringHash> m_pendingWidgetNames;
+
         Widget::Ptr m_widgetBelowMouse;
 
         // The id of the focused widget
         std::size_t m_focusedWidget = 0;
 
+        // Nesting depth of beginUpdate calls and whether work was postponed because of them
+        unsigned int m_updateDepth = 0;
+        bool m_updatePostponed = false;
+
 
         friend class Widget;
 
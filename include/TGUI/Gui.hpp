@@ -29,7 +29,10 @@
 
 #include <queue>
 
+#include <TGUI/Binding.hpp>
+#include <TGUI/CommandQueue.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/Loading/ThemeWatcher.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -294,7 +297,64 @@ namespace tgui
         template <class T>
         typename T::Ptr get(const sf::String& widgetName, bool recursive = false) const
         {
-            return m_container->get<T>(widgetName, recursive);
+            return std::dynamic_pointer_cast<T>(get(widgetName, recursive));
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget by following a path of widget names.
+        ///
+        /// @param path  Names of the widgets separated by dots, e.g. "panel.grid.okButton"
+        ///
+        /// @return Pointer to the widget or nullptr when no widget could be found at that path
+        ///
+        /// Usage example:
+        /// @code
+        /// auto button = gui.getByPath<tgui::Button>("settingsWindow.buttons.okButton");
+        /// @endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getByPath(const sf::String& path) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget by following a path of widget names.
+        ///
+        /// @param path  Names of the widgets separated by dots, e.g. "panel.grid.okButton"
+        ///
+        /// @return Pointer to the widget or nullptr when no widget could be found at that path.
+        ///         The pointer will already be casted to the desired type.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
+        typename T::Ptr getByPath(const sf::String& path) const
+        {
+            return std::dynamic_pointer_cast<T>(getByPath(path));
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the results of recursive lookups by name are cached.
+        ///
+        /// @param enabled  Should get(name, true) remember which widget was found for a name?
+        ///
+        /// When enabled, searching recursively for the same name a second time no longer searches through the whole widget tree.
+        /// The cache is cleared automatically when widgets are added, removed, renamed or reordered.
+        /// The cache is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setNameCacheEnabled(bool enabled = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the results of recursive lookups by name are cached.
+        ///
+        /// @return Is the name cache enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isNameCacheEnabled() const
+        {
+            return m_nameCacheEnabled;
         }
 
 
@@ -408,6 +468,28 @@ namespace tgui
         float getOpacity() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by all widgets in the gui, grouped by widget type
+        ///
+        /// @return Map with the widget type (e.g. "Button") as key and the memory used by all widgets of that type as value
+        ///
+        /// This can be used to find out which widgets use most memory or to check that a screen stays within a memory budget.
+        ///
+        /// @see Widget::getMemoryUsage
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::map<std::string, MemoryUsage> getMemoryUsageByType() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by all widgets in the gui
+        ///
+        /// @return Approximate amount of bytes used by the widgets, their renderers, texts, signals and textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MemoryUsage getMemoryUsage() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Load the child widgets from a text file
         ///
@@ -438,10 +520,70 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Save this the child widgets to a text file
         ///
-        /// @param stream  stringstream to which the widget file will be added
+        /// @param stream  Stream to which the widget file will be written
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToStream(std::ostream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reload the properties of a theme that changed whenever its theme file is modified
+        ///
+        /// @param theme  The theme to watch
+        ///
+        /// The file is checked for changes in updateTime, only the changed properties are passed to the affected widgets.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void watchTheme(const std::shared_ptr<Theme>& theme);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stop reloading the theme when its theme file is modified
+        ///
+        /// @param theme  The theme that was passed to watchTheme
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToStream(std::stringstream& stream);
+        void unwatchTheme(const std::shared_ptr<Theme>& theme);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the watcher that reloads the themes passed to watchTheme
+        ///
+        /// @return Theme watcher of the gui
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ThemeWatcher& getThemeWatcher()
+        {
+            return m_themeWatcher;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the queue through which other threads can change the widgets
+        ///
+        /// @return Command queue of the gui
+        ///
+        /// The posted commands are executed at the start of updateTime, see CommandQueue for details.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandQueue& getCommandQueue()
+        {
+            return m_commandQueue;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the bindings that keep widget properties in sync with observable values
+        ///
+        /// @return Bindings of the gui
+        ///
+        /// The bindings are applied once per frame, after the commands in the command queue were executed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Bindings& getBindings()
+        {
+            return m_bindings;
+        }
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -474,6 +616,20 @@ namespace tgui
 
         sf::View m_view;
 
+        // Cache for recursive lookups by name, only valid while the widget names version did not change
+        bool m_nameCacheEnabled = false;
+        mutable std::unordered_map<sf::String, std::weak_ptr<Widget>, priv::StringHash> m_nameCache;
+        mutable std::size_t m_nameCacheVersion = 0;
+
+        // Reloads themes when their file changes
+        ThemeWatcher m_themeWatcher;
+
+        // Commands posted by other threads
+        CommandQueue m_commandQueue;
+
+        // Widget properties that follow observable values
+        Bindings m_bindings;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -30,6 +30,7 @@
 
 #include <TGUI/Config.hpp>
 #include <sstream>
+#include <ostream>
 #include <memory>
 #include <vector>
 #include <string>
@@ -75,6 +76,106 @@ namespace tgui
         };
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Streaming emitter for widget files
+        ///
+        /// The emitter writes sections and properties to the stream as soon as possible instead of first building a tree of
+        /// nodes. Only the properties of the sections that are still open are kept in memory, so that they can be written in
+        /// the same sorted order as the emit function does.
+        ///
+        /// The emitter can also be constructed with a node, in which case it builds a tree of nodes instead of writing to a
+        /// stream. This allows the same code to be used for both ways of saving widgets.
+        ///
+        /// @note All properties of a section have to be set before its first child section is started.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Emitter
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Construct an emitter that writes to a stream
+            ///
+            /// @param stream  Stream to which the widget file will be written
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            explicit Emitter(std::ostream& stream);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Construct an emitter that adds the sections and properties to a node
+            ///
+            /// @param node  Node that will serve as root for the emitted sections and properties
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            explicit Emitter(Node& node);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Destructor, writes the properties that were not written yet
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ~Emitter();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Start a new section inside the current one
+            ///
+            /// @param name  Name of the section, can be empty
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void beginSection(const std::string& name);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Close the section that was last started
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void endSection();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Set a property in the current section
+            ///
+            /// @param property  Name of the property
+            /// @param value     Serialized value of the property
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setProperty(const std::string& property, const std::string& value);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Emit a node and its children as a section inside the current one
+            ///
+            /// @param node  Node to emit
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void emitNode(const Node& node);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            // Writes the properties of the current section to the stream if this didn't happen yet
+            void flushProperties();
+
+        private:
+
+            struct Section
+            {
+                std::map<std::string, std::string> properties;
+                bool propertiesWritten = false;
+                bool empty = true;
+            };
+
+            std::ostream* m_stream = nullptr;
+            Node* m_node = nullptr;
+            std::vector<Section> m_sections;
+
+            Emitter(const Emitter&) = delete;
+            Emitter& operator=(const Emitter&) = delete;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Parse a widget file
         ///
@@ -93,14 +194,12 @@ namespace tgui
         /// @param stream   Stream to which the widget file will be added
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static void emit(std::shared_ptr<Node> rootNode, std::stringstream& stream);
+        static void emit(std::shared_ptr<Node> rootNode, std::ostream& stream);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        static std::vector<std::string> convertNodesToLines(std::shared_ptr<Node> node);
-
         static std::string parseSection(std::stringstream& stream, std::shared_ptr<Node> node, const std::string& sectionName);
 
         static std::string parseKeyValue(std::stringstream& stream, std::shared_ptr<Node> node, const std::string& key);
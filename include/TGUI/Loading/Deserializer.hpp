@@ -47,6 +47,52 @@ namespace tgui
         static void setFunction(ObjectConverter::Type type, const DeserializeFunc& deserializer);
         static const DeserializeFunc& getFunction(ObjectConverter::Type type);
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Enables or disables remembering the results of deserialize
+        ///
+        /// @param enabled  Should the same strings be converted only once?
+        ///
+        /// When enabled, the deserialized value of each (type, string) pair is stored so that deserializing the same string
+        /// again only requires a copy. Fonts and textures are also stored per resource path. The cached values keep their
+        /// fonts and images loaded until they are removed from the cache. The cache is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setCacheEnabled(bool enabled);
+        static bool isCacheEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of values that are kept in the cache
+        ///
+        /// @param capacity  Maximum amount of cached values, the least recently used values are removed first
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setCacheCapacity(std::size_t capacity);
+        static std::size_t getCacheCapacity();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all values from the cache and resets the hit and miss counters
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times deserialize could return a cached value
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getCacheHits();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times deserialize had to convert the string while the cache was enabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getCacheMisses();
+
+
     private:
         static std::map<ObjectConverter::Type, DeserializeFunc> m_deserializers;
     };
@@ -31,6 +31,8 @@
 #include <TGUI/Loading/WidgetConverter.hpp>
 #include <TGUI/Loading/ThemeLoader.hpp>
 
+#include <set>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -119,7 +121,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
-        static std::map<std::string, std::function<Widget::Ptr()>> m_constructors; ///< Widget creator functions
+        static std::map<WidgetType, std::function<Widget::Ptr()>> m_constructors; ///< Widget creator functions
         static std::shared_ptr<BaseThemeLoader> m_themeLoader;  ///< Theme loading functions, they read the theme file
     };
 
@@ -198,6 +200,30 @@ namespace tgui
         void reload(Widget::Ptr widget, std::string className);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads the theme file again and only updates the properties that were changed in the file
+        ///
+        /// The new property values of each class are compared with the old ones and only the properties that differ are
+        /// passed to the renderers of the widgets that use the class. Widgets of a class from which a property was removed
+        /// are reloaded completely.
+        ///
+        /// @return Whether any property was changed
+        ///
+        /// @exception Exception when the theme file could not be loaded. The theme is left unchanged in this case.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool reloadChangedProperties();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the filename of the theme file
+        ///
+        /// @return Filename of the theme file, or an empty string when the theme wasn't loaded from a file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::string& getFilename() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Change a property of the renderer of all widgets that were loaded with a certain class name
         ///
@@ -287,13 +313,29 @@ namespace tgui
         virtual void initWidget(Widget* widget, std::string filename, std::string className) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the class name of the widget, keeping the widgets per class name up to date
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWidgetClassName(Widget* widget, const std::string& className);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes the properties to the renderer of the widget, loading resources relative to the theme file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyProperties(Widget* widget, const std::map<std::string, std::string>& properties);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         std::string m_filename;
         std::string m_resourcePath;
         bool m_resourcePathLock = false;
         std::map<Widget*, std::string> m_widgets; // Map widget to class name
-        std::map<std::string, std::string> m_widgetTypes; // Map class name to type
+        std::map<std::string, std::set<Widget*>> m_classWidgets; // Map class name to the widgets that were loaded with it
+        std::map<std::string, WidgetType> m_widgetTypes; // Map class name to type
         std::map<std::string, std::map<std::string, std::string>> m_widgetProperties; // Map class name to property-value pairs
 
         friend class ThemeTest;
@@ -0,0 +1,190 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_THEME_WATCHER_HPP
+#define TGUI_THEME_WATCHER_HPP
+
+
+#include <TGUI/Loading/Theme.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Watches the files of themes and reloads the properties that changed when a file is modified
+    ///
+    /// On linux inotify is used to get notified about changes, on other systems the modification time of the files is
+    /// checked every time poll is called.
+    ///
+    /// The Gui owns a watcher which is polled from its updateTime function, see Gui::watchTheme.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ThemeWatcher
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ThemeWatcher();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor, stops watching all files
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~ThemeWatcher();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted copy constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ThemeWatcher(const ThemeWatcher&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted assignment operator overload
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ThemeWatcher& operator=(const ThemeWatcher&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts watching the file of a theme
+        ///
+        /// @param theme  The theme that should be updated when its file changes
+        ///
+        /// The watcher only keeps a weak reference to the theme.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void watch(const std::shared_ptr<Theme>& theme);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops watching the file of a theme
+        ///
+        /// @param theme  The theme that was passed to the watch function
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unwatch(const std::shared_ptr<Theme>& theme);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether any theme is being watched
+        ///
+        /// @return Is there at least one watched theme?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isWatching() const
+        {
+            return !m_themes.empty();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether any of the watched files changed and updates the themes that use them
+        ///
+        /// Errors in the modified theme file are written to sf::err() and leave the theme unchanged.
+        ///
+        /// @return Amount of themes that were reloaded
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t poll();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long it took to apply the last change
+        ///
+        /// @return Time between noticing the file change and having updated all affected widgets
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getLastReloadDuration() const
+        {
+            return m_lastReloadDuration;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times a theme was reloaded by this watcher
+        ///
+        /// @return Amount of reloads since the watcher was created
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getReloadCount() const
+        {
+            return m_reloadCount;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Start or stop watching the file of a theme
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addWatch(std::size_t index);
+        void removeWatch(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Check whether the files were changed since the last poll, marking the themes as modified
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void checkForChanges();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct WatchedTheme
+        {
+            std::weak_ptr<Theme> theme;
+            std::string filename;
+            int watchDescriptor = -1;
+            std::pair<long long, long long> fileStamp; // Modification time and size of the file
+            bool modified = false;
+        };
+
+        std::vector<WatchedTheme> m_themes;
+
+        int m_inotifyDescriptor = -1;
+
+        sf::Time m_lastReloadDuration;
+        std::size_t m_reloadCount = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_THEME_WATCHER_HPP
@@ -79,9 +79,64 @@ namespace tgui
         static const LoadFunction& getLoadFunction(const std::string& type);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the child widgets of hidden containers are only loaded when they are needed
+        ///
+        /// @param enabled  Should widgets be loaded lazily?
+        ///
+        /// When enabled, the child widgets of a container that is hidden in the widget file are kept as parsed sections.
+        /// They are only created when the container is shown, when a widget inside it is requested with the get function
+        /// or when the list of widgets inside the container is requested. The "LazyLoad" property can be set in the widget
+        /// file to explicitly choose whether the child widgets of a container are loaded lazily. The widgets of a visible
+        /// container that is loaded lazily are created during the next update of the gui.
+        ///
+        /// Lazy loading is disabled by default.
+        ///
+        /// @see Container::loadPendingWidgets
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setLazyLoadingEnabled(bool enabled = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets of hidden containers are only loaded when they are needed
+        ///
+        /// @return Are widgets loaded lazily?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isLazyLoadingEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of widgets that were created from widget files
+        ///
+        /// @return Number of loaded widgets since the last call to resetMaterializedWidgetCount
+        ///
+        /// This includes the widgets that were created later because they were loaded lazily.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getMaterializedWidgetCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets the amount of widgets that were created from widget files to 0
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetMaterializedWidgetCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called each time a widget from a widget file was created
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void widgetMaterialized();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         static std::map<std::string, LoadFunction> m_loadFunctions;
+        static bool m_lazyLoading;
+        static std::size_t m_materializedWidgetCount;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +43,7 @@ namespace tgui
     {
     public:
         using SaveFunction = std::function<std::shared_ptr<DataIO::Node>(WidgetConverter)>;
+        using StreamSaveFunction = std::function<void(WidgetConverter, DataIO::Emitter&)>;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,11 +52,28 @@ namespace tgui
         /// @param widget  The container to save
         /// @param stream  Stream to which the widget file will be written to
         ///
+        /// The widgets are written to the stream while walking through them, no tree of nodes is build in memory.
+        ///
         /// @note You should use the saveWidgetsToFile or saveWidgetsToSteam functions in Gui and Container
         ///       instead of calling this function directly.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static void save(Container::Ptr widget, std::stringstream& stream);
+        static void save(Container::Ptr widget, std::ostream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Write a widget as a section to an emitter
+        ///
+        /// @param widget       The widget to save
+        /// @param emitter      Emitter to which the widget is written
+        /// @param sectionName  Name of the section, when empty the type and name of the widget are used
+        ///
+        /// @throw Exception when no save function exists for the type of the widget
+        ///
+        /// This function can be used inside a stream save function to save child widgets.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void emitWidget(Widget::Ptr widget, DataIO::Emitter& emitter, const std::string& sectionName = "");
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -64,6 +82,11 @@ namespace tgui
         /// @param type         Type of the widget
         /// @param saveFunction New save function
         ///
+        /// The save function returns a node that is written to the stream afterwards. Stream save functions are faster
+        /// because they don't need to build the node first.
+        ///
+        /// @see setStreamSaveFunction
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void setSaveFunction(const std::string& type, const SaveFunction& saveFunction);
 
@@ -75,12 +98,39 @@ namespace tgui
         ///
         /// @return Function called to save the widget
         ///
+        /// When the widget type has a stream save function, the returned function will call it to build the node.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static const SaveFunction& getSaveFunction(const std::string& type);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Change the stream save function for a certain widget type
+        ///
+        /// @param type         Type of the widget
+        /// @param saveFunction New save function
+        ///
+        /// The function is called after the section of the widget was started, it has to set all properties of the
+        /// widget before writing child sections to the emitter.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setStreamSaveFunction(const std::string& type, const StreamSaveFunction& saveFunction);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieve the stream save function of a certain widget type
+        ///
+        /// @param type  Type of the widget
+        ///
+        /// @return Function called to write the widget to the emitter
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const StreamSaveFunction& getStreamSaveFunction(const std::string& type);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
+        static std::map<std::string, StreamSaveFunction> m_streamSaveFunctions;
         static std::map<std::string, SaveFunction> m_saveFunctions;
     };
 
@@ -0,0 +1,137 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_MEMORY_USAGE_HPP
+#define TGUI_MEMORY_USAGE_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace sf
+{
+    class Text;
+}
+
+namespace tgui
+{
+    class Texture;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Approximate amount of bytes used by a widget, split in categories
+    ///
+    /// The numbers are estimates based on the sizes of the objects and the capacity of their containers, they don't include
+    /// the overhead of the memory allocator. Resources that are shared between widgets (e.g. an image used by the textures
+    /// of several widgets) are divided between the users of the resource.
+    ///
+    /// @see Widget::getMemoryUsage, Container::getMemoryUsageByType
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API MemoryUsage
+    {
+        std::size_t widget = 0;   ///< The widget objects and their internal bookkeeping
+        std::size_t renderer = 0; ///< The renderer objects, including their Texture members
+        std::size_t text = 0;     ///< Strings and the vertices of the texts that are displayed
+        std::size_t signals = 0;  ///< The signal table and the connected functions
+        std::size_t textures = 0; ///< Vertices of the textures and their share of the loaded images and textures
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the sum of all categories
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getTotal() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds the amount of bytes in each category of another object to this object
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MemoryUsage& operator+=(const MemoryUsage& right);
+    };
+
+
+    namespace priv
+    {
+        /// @internal Approximate size of a node in a std::map or std::set, excluding the value
+        const std::size_t MapNodeOverhead = 4 * sizeof(void*);
+
+        /// @internal Approximate size of the control block of a shared pointer created with std::make_shared
+        const std::size_t SharedPtrOverhead = 2 * sizeof(long) + sizeof(void*);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Estimated heap memory used by the objects, the size of the object itself is not included
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API std::size_t getHeapMemoryUsage(const std::string& str);
+        TGUI_API std::size_t getHeapMemoryUsage(const sf::String& str);
+        TGUI_API std::size_t getHeapMemoryUsage(const sf::Text& text);
+        TGUI_API std::size_t getHeapMemoryUsage(const Texture& texture);
+        TGUI_API std::size_t getHeapMemoryUsage(const std::vector<sf::String>& strings);
+        TGUI_API std::size_t getHeapMemoryUsage(const std::vector<sf::Text>& texts);
+        TGUI_API std::size_t getHeapMemoryUsage(const std::vector<Texture>& textures);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Memory used by a widget that is stored inside another widget (e.g. the Label inside a Button). The size of the
+        // object is already included in the size of the widget that contains it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename WidgetType>
+        MemoryUsage getEmbeddedMemoryUsage(const WidgetType& widget)
+        {
+            MemoryUsage usage = widget.getMemoryUsage();
+            usage.widget -= sizeof(WidgetType);
+            return usage;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Memory used by a widget that is owned by another widget without being part of a container (e.g. the scrollbar
+        // inside a ListBox)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename WidgetType>
+        MemoryUsage getOwnedMemoryUsage(const std::shared_ptr<WidgetType>& widget)
+        {
+            if (!widget)
+                return {};
+
+            MemoryUsage usage = widget->getMemoryUsage();
+            usage.widget += SharedPtrOverhead;
+            return usage;
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_MEMORY_USAGE_HPP
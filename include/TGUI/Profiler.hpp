@@ -0,0 +1,232 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_PROFILER_HPP
+#define TGUI_PROFILER_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define TGUI_PROFILE_CONCAT_IMPL(a, b) a##b
+#define TGUI_PROFILE_CONCAT(a, b) TGUI_PROFILE_CONCAT_IMPL(a, b)
+
+// The zones inside TGUI only exist when the library was build with the TGUI_ENABLE_PROFILING option
+#ifdef TGUI_ENABLE_PROFILING
+    #define TGUI_PROFILE_ZONE(name) \
+        const tgui::Profiler::Zone TGUI_PROFILE_CONCAT(tguiProfileZone, __LINE__){name}
+    #define TGUI_PROFILE_WIDGET_ZONE(name, widget, widgetName) \
+        const tgui::Profiler::Zone TGUI_PROFILE_CONCAT(tguiProfileZone, __LINE__){name, widget, widgetName}
+#else
+    #define TGUI_PROFILE_ZONE(name)
+    #define TGUI_PROFILE_WIDGET_ZONE(name, widget, widgetName)
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Records how long parts of the gui take and exports them in the Chrome trace event format
+    ///
+    /// When TGUI is build with the TGUI_ENABLE_PROFILING cmake option, the gui measures drawing, event handling, updating,
+    /// layout recalculations, theme initialization and widget loading. The measured zones are tagged with the type and
+    /// name of the widget when they belong to one.
+    ///
+    /// The zones are stored in a fixed size ring buffer that can be written from multiple threads without locking.
+    /// When the buffer is full, the oldest zones are overwritten.
+    ///
+    /// @code
+    /// tgui::Profiler::clear();
+    /// gui.draw();
+    /// tgui::Profiler::saveChromeTrace("trace.json"); // Open in chrome://tracing
+    /// @endcode
+    ///
+    /// Without the cmake option the zones inside the library are compiled away, but you can still measure your own code
+    /// by creating Profiler::Zone objects.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Profiler
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Measured zone as returned by getEvents
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Event
+        {
+            std::string  name;       ///< Name of the zone
+            std::string  widgetType; ///< Type of the widget to which the zone belongs, empty when not related to a widget
+            std::string  widgetName; ///< Name of the widget to which the zone belongs (may be truncated)
+            double       start;      ///< Time in microseconds when the zone was entered, relative to the start of the program
+            double       duration;   ///< Time in microseconds spend inside the zone
+            unsigned int threadId;   ///< Small number identifying the thread on which the zone was executed
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Measures the time between its construction and destruction
+        ///
+        /// Zones should only be created on the stack, the zone is recorded when the object goes out of scope.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Zone
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Starts measuring
+            ///
+            /// @param name  Name of the zone, the string must remain valid until the events are exported
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            explicit Zone(const char* name);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Starts measuring a zone related to a widget
+            ///
+            /// @param name        Name of the zone, the string must remain valid until the events are exported
+            /// @param widget      Widget of which the type will be stored with the zone
+            /// @param widgetName  Name of the widget in its parent
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Zone(const char* name, const Widget* widget, const sf::String& widgetName = "");
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Stops measuring and stores the zone in the ring buffer
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ~Zone();
+
+
+            Zone(const Zone&) = delete;
+            Zone& operator=(const Zone&) = delete;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+            const char* m_name;
+            char m_widgetType[24];
+            char m_widgetName[40];
+            std::chrono::steady_clock::time_point m_startTime;
+            bool m_recording;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the zones inside TGUI were compiled in
+        ///
+        /// @return True when TGUI was build with the TGUI_ENABLE_PROFILING option
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isInstrumented();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Pauses or resumes recording
+        ///
+        /// @param enabled  Should zones be recorded?
+        ///
+        /// Recording is enabled by default. Zones that were entered while recording was disabled are never recorded.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether zones are being recorded
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of zones that are kept in the ring buffer
+        ///
+        /// @param capacity  Maximum amount of stored zones, rounded up to a power of two. The default is 16384.
+        ///
+        /// All recorded zones are removed. This function may not be called while zones are being recorded on other threads.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setCapacity(std::size_t capacity);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of zones that are kept in the ring buffer
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getCapacity();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all recorded zones
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the zones in the ring buffer, oldest first
+        ///
+        /// Zones that are being overwritten while this function runs are left out.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<Event> getEvents();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes the recorded zones as a Chrome trace event JSON document
+        ///
+        /// @param stream  Stream to write to
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void exportChromeTrace(std::ostream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes the recorded zones to a file that can be opened in chrome://tracing
+        ///
+        /// @param filename  Name of the file to create
+        ///
+        /// @return False when the file could not be opened for writing
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool saveChromeTrace(const std::string& filename);
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROFILER_HPP
@@ -0,0 +1,91 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_ROW_ORDER_HPP
+#define TGUI_ROW_ORDER_HPP
+
+
+#include <TGUI/Config.hpp>
+
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Calculates the order in which the rows of a list or table are displayed on a worker thread.
+        // Starting a new calculation cancels the previous one, so only the result of the newest request is ever returned.
+        // The comparator and predicate are called on the worker thread and only receive row indices.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API RowOrderTask
+        {
+        public:
+            using Comparator = std::function<bool(std::size_t, std::size_t)>;
+            using Predicate = std::function<bool(std::size_t)>;
+
+            RowOrderTask() = default;
+            ~RowOrderTask();
+
+            // A pending calculation is never copied, the copy starts without a task
+            RowOrderTask(const RowOrderTask&);
+            RowOrderTask& operator=(const RowOrderTask&);
+
+            // Starts calculating which of the rows pass the filter and sorts them with the comparator.
+            // Both functions are optional, the result contains the row indices in the order in which they should be shown.
+            void start(std::size_t rowCount, Predicate filter, Comparator comparator);
+
+            // Stops the running calculation, the gui thread waits at most a few thousand comparisons
+            void cancel();
+
+            // Returns true while a calculation was started of which the result wasn't taken yet
+            bool isPending() const;
+
+            // Moves the result into the order vector and returns true when the calculation has finished.
+            // An exception that was thrown by the comparator or predicate is rethrown here.
+            bool takeResult(std::vector<std::size_t>& order);
+
+            // Calculates the order on the calling thread
+            static std::vector<std::size_t> calculate(std::size_t rowCount, const Predicate& filter, const Comparator& comparator);
+
+        private:
+            struct State;
+
+            std::shared_ptr<State> m_state;
+            std::thread m_thread;
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_ROW_ORDER_HPP
@@ -35,6 +35,7 @@
 #include <memory>
 #include <cassert>
 #include <functional>
+#include <tuple>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -197,6 +198,56 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        template <std::size_t Index, std::size_t Size>
+        struct tupleToData
+        {
+            template <typename Tuple>
+            static void set(const Tuple& values)
+            {
+                data[Index] = static_cast<const void*>(&std::get<Index>(values));
+                tupleToData<Index+1, Size>::set(values);
+            }
+        };
+
+        template <std::size_t Size>
+        struct tupleToData<Size, Size>
+        {
+            template <typename Tuple>
+            static void set(const Tuple&)
+            {
+            }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copy of the parameters of the last time that a signal was sent, for functions that are called later
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        struct SignalArgumentsBase
+        {
+            virtual ~SignalArgumentsBase() = default;
+
+            // Points the data used by the bound functions to the stored parameters
+            virtual void setData() const = 0;
+        };
+
+        template <typename... Args>
+        struct SignalArguments : public SignalArgumentsBase
+        {
+            SignalArguments(const Args&... args) :
+                values{args...}
+            {
+            }
+
+            void setData() const override
+            {
+                tupleToData<0, sizeof...(Args)>::set(values);
+            }
+
+            std::tuple<Args...> values;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         template <typename Func, typename... Args>
         struct isFunctionConvertible
         {
@@ -221,6 +272,54 @@ namespace tgui
     }
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Decides when a connected function is called after the widget sent the signal
+    ///
+    /// Widgets like Slider send a signal for every step while the mouse is dragging them. When the connected function is
+    /// expensive, it can be connected with the coalesced policy to only be called once per frame with the last values.
+    ///
+    /// @code
+    /// slider->connect(tgui::DeliveryPolicy::coalesced(), "ValueChanged", [](int value){ runQuery(value); });
+    /// @endcode
+    ///
+    /// Delayed calls are made when the gui updates the widget, which happens at the start of every frame for visible widgets.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API DeliveryPolicy
+    {
+        enum class Type
+        {
+            Immediate,   ///< Call the function every time the signal is sent (default)
+            Coalesced,   ///< Call the function once per frame, with the values of the last time the signal was sent
+            RateLimited  ///< Call the function at most once per interval, with the values of the last time the signal was sent
+        };
+
+        /// @brief Returns the policy that calls the function while the signal is being sent
+        static DeliveryPolicy immediate()
+        {
+            return {Type::Immediate, sf::Time::Zero};
+        }
+
+        /// @brief Returns the policy that calls the function once per frame in which the signal was sent
+        static DeliveryPolicy coalesced()
+        {
+            return {Type::Coalesced, sf::Time::Zero};
+        }
+
+        /// @brief Returns the policy that calls the function at most once per interval
+        ///
+        /// When the signal is sent and the previous call was longer than the interval ago, the function is called
+        /// immediately. Otherwise the call is delayed until the interval has passed.
+        static DeliveryPolicy rateLimited(sf::Time interval)
+        {
+            return {Type::RateLimited, interval};
+        }
+
+        Type type;        ///< When the function is called
+        sf::Time interval; ///< Minimum time between two calls, only used by the rate limited policy
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @internal
     // Stores the actual callback functions and checks if their parameters are valid
@@ -253,15 +352,51 @@ namespace tgui
 
         bool isEmpty();
 
+        bool hasDeferredFunctions() const
+        {
+            return !m_deferredFunctions.empty();
+        }
+
+        bool hasCallbackFunctions() const;
+
+        bool setDeliveryPolicy(unsigned int id, const DeliveryPolicy& policy);
+
+        std::size_t getMemoryUsage() const;
+
         void operator()(unsigned int count);
 
         template <typename T, typename... Args>
-        void operator()(unsigned int count, const T& value, Args... args)
+        void operator()(unsigned int count, const T& value, const Args&... args)
         {
             priv::data[count] = static_cast<const void*>(&value);
             (*this)(count+1, args...);
         }
 
+        // Stores the parameters for the functions that aren't called immediately
+        template <typename... Args>
+        void storeArguments(const Callback& callback, const Args&... args)
+        {
+            // The stored values are only overwritten when they aren't being used by a function that is being called
+            auto arguments = dynamic_cast<priv::SignalArguments<Args...>*>(m_lastArguments.get());
+            if (arguments && (m_lastArguments.use_count() == 1))
+                arguments->values = std::tie(args...);
+            else
+                m_lastArguments = std::make_shared<priv::SignalArguments<Args...>>(args...);
+
+            if (hasDeferredCallbackFunctions())
+                m_lastCallback = callback;
+        }
+
+        // Calls the rate limited functions that may be called now and marks the others as pending.
+        // Returns whether some functions are waiting to be called later.
+        bool sendDeferred(sf::Time time);
+
+        // Calls the pending functions that may be called now, returns whether some functions are still waiting
+        bool deliverPending(sf::Time time);
+
+        // Forgets the pending calls, used when the signal was copied
+        void clearPending();
+
     protected:
 
         template <typename Type>
@@ -285,11 +420,33 @@ namespace tgui
             throw Exception{"Failed to bind parameter to callback function. Parameter is of wrong type."};
         }
 
+    private:
+
+        struct DeferredFunction
+        {
+            DeliveryPolicy policy;
+            std::function<void()> function; // Empty when the function was connected with connectEx
+            std::function<void(const Callback&)> functionEx;
+            sf::Time lastDelivery;
+            bool delivered = false;
+            bool pending = false;
+        };
+
+        bool hasDeferredCallbackFunctions() const;
+
+        // Calls the function with the stored parameters
+        void deliver(DeferredFunction& deferred, sf::Time time);
+
     private:
 
         std::map<unsigned int, std::function<void()>> m_functions;
         std::map<unsigned int, std::function<void(const Callback&)>> m_functionsEx;
 
+        // Functions that don't use the immediate delivery policy, together with the last parameters that were sent
+        std::map<unsigned int, DeferredFunction> m_deferredFunctions;
+        std::shared_ptr<priv::SignalArgumentsBase> m_lastArguments;
+        Callback m_lastCallback;
+
         std::vector<std::vector<std::string>> m_allowedTypes;
 
         friend class SignalWidgetBase; // Only needed for m_functionsEx
@@ -385,6 +542,30 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Connects a signal handler function to one or more signals, with a policy for when it is called
+        ///
+        /// @param policy      Decides whether the function is called immediately, once per frame or at a limited rate
+        /// @param signalNames Name of the signal, or multiple names split by spaces
+        /// @param func        The function to connect
+        /// @param args        The arguments that should be bound to the function
+        ///
+        /// @return Id of this connection, which you need if you want to disconnect it later
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename Func, typename... Args>
+        unsigned int connect(const DeliveryPolicy& policy, const std::string& signalNames, Func func, Args... args)
+        {
+            const unsigned int firstId = m_lastId;
+            const unsigned int lastId = connect(signalNames, func, args...);
+
+            for (unsigned int id = firstId; id <= lastId; ++id)
+                setDeliveryPolicy(id, policy);
+
+            return lastId;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Connects a signal handler function to one or more signals
         ///
@@ -442,6 +623,18 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes when the function of a connection is called
+        ///
+        /// @param id      The id that was returned by the connect or connectEx function
+        /// @param policy  Decides whether the function is called immediately, once per frame or at a limited rate
+        ///
+        /// @throw Exception when there is no function connected with the given id
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDeliveryPolicy(unsigned int id, const DeliveryPolicy& policy);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Disconnects a connection
         ///
@@ -488,24 +681,54 @@ namespace tgui
         bool isSignalBound(std::string&& name);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Check if a function that receives the Callback object has been bound to the signal. The members of m_callback that
+        // are expensive to fill (e.g. the text) only have to be set when this function returns true.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCallbackBound(std::string&& name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls the functions that are connected with a coalesced or rate limited policy and which are waiting to be called.
+        // This function is called every frame when the widget is updated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void deliverPendingSignals(sf::Time elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the approximate amount of bytes used by the signals, the connected functions and the callback object.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getSignalsMemoryUsage() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Send a signal to all signal handlers that are connected with this signal.
+        // The arguments are passed by reference, they are only copied when a connected function takes them by value.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         template <typename... Args>
-        void sendSignal(std::string&& name, Args... args)
+        void sendSignal(std::string&& name, const Args&... args)
         {
-            assert(m_signals[toLower(name)] != nullptr);
+            auto signalIt = m_signals.find(toLower(name));
+            assert((signalIt != m_signals.end()) && (signalIt->second != nullptr));
 
-            auto& signal = *m_signals[toLower(name)];
+            auto& signal = *signalIt->second;
             if (!signal.isEmpty())
                 signal(0, args...);
 
-            m_callback.trigger = name;
             if (!signal.m_functionsEx.empty())
             {
+                m_callback.trigger = name;
                 for (auto& function : signal.m_functionsEx)
                     function.second(m_callback);
             }
+
+            if (signal.hasDeferredFunctions())
+            {
+                m_callback.trigger = name;
+                signal.storeArguments(m_callback, args...);
+                if (signal.sendDeferred(m_signalTime))
+                    m_signalsPending = true;
+            }
         }
 
 
@@ -523,6 +746,12 @@ namespace tgui
 
         Callback m_callback;
 
+        // Time passed in deliverPendingSignals, used by the rate limited connections
+        sf::Time m_signalTime;
+
+        // Set when a coalesced or rate limited connection is waiting to be called
+        bool m_signalsPending = false;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
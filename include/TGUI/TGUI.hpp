@@ -29,15 +29,24 @@
 
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/Animation.hpp>
+#include <TGUI/Binding.hpp>
+#include <TGUI/CommandQueue.hpp>
+#include <TGUI/WidgetType.hpp>
 #include <TGUI/Widget.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/HorizontalLayout.hpp>
 #include <TGUI/VerticalLayout.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/MemoryUsage.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RowOrder.hpp>
+#include <TGUI/TextLayout.hpp>
+#include <TGUI/VertexCache.hpp>
 
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Loading/ThemeWatcher.hpp>
 #include <TGUI/Loading/WidgetLoader.hpp>
 #include <TGUI/Loading/WidgetSaver.hpp>
 
@@ -0,0 +1,191 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_TEXT_LAYOUT_HPP
+#define TGUI_TEXT_LAYOUT_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/Font.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Label;
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Line of a text that was split by wrapText
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct TextLayoutLine
+        {
+            std::size_t start;
+            std::size_t length;
+            bool        wrapped; // True when the line was split because it didn't fit and not because of a newline
+        };
+
+        struct TextLayoutResult
+        {
+            std::vector<TextLayoutLine> lines;
+            float width = 0;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Read-only copy of the glyph sizes and kerning of a font, which can be used from multiple threads at once.
+        // The sf::Font itself can't be used outside the gui thread because it loads its glyphs on demand.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API GlyphMetrics
+        {
+        public:
+            GlyphMetrics(const sf::Font& font, unsigned int characterSize, bool bold);
+
+            // Loads the metrics of all characters in the text and of all pairs of characters next to each other
+            void prepare(const sf::String& text);
+
+            float getWidth(sf::Uint32 character) const;
+            float getAdvance(sf::Uint32 character) const;
+            float getKerning(sf::Uint32 first, sf::Uint32 second) const;
+
+        private:
+            struct Glyph
+            {
+                float width;
+                float advance;
+            };
+
+            const sf::Font& m_font;
+            unsigned int m_characterSize;
+            bool m_bold;
+
+            std::unordered_map<sf::Uint32, Glyph> m_glyphs;
+            std::unordered_map<std::uint64_t, float> m_kerning;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Splits the text in lines that fit within the maximum width (0 means no limit) with word-wrap
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API TextLayoutResult wrapText(const sf::String& text, float maxWidth, const sf::Font& font, unsigned int characterSize, bool bold);
+        TGUI_API TextLayoutResult wrapText(const sf::String& text, float maxWidth, const GlyphMetrics& metrics);
+    }
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Postpones the text layout of labels and performs it on multiple threads at once
+    ///
+    /// While a TextLayoutBatch object exists, labels that are part of a container don't split their text in lines
+    /// immediately when their font, text size or text changes. When the last batch object is destroyed, the line breaks of
+    /// all these labels are calculated in parallel and the results are applied on the calling thread.
+    ///
+    /// Container::setFont (and thus Gui::setFont) uses a batch automatically. Create one yourself when changing e.g.
+    /// the text size of many labels at once:
+    /// @code
+    /// {
+    ///     tgui::TextLayoutBatch batch;
+    ///     for (auto& label : labels)
+    ///         label->setTextSize(30);
+    /// } // All labels are updated here
+    /// @endcode
+    ///
+    /// Asking the size of a label while its layout is postponed will update that label immediately.
+    /// Batches only affect the thread on which they are created, which should be the thread that uses the gui.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextLayoutBatch
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts postponing the text layout, batches can be nested
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextLayoutBatch();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Lays out all postponed labels when this is the outermost batch
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~TextLayoutBatch();
+
+
+        TextLayoutBatch(const TextLayoutBatch&) = delete;
+        TextLayoutBatch& operator=(const TextLayoutBatch&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a batch exists on the current thread
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isActive();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of threads used to lay out the labels
+        ///
+        /// @param threads  Maximum amount of threads, 0 (default) uses the amount of cores of the processor.
+        ///                 With 1 thread everything is done on the calling thread.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setThreadCount(unsigned int threads);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of threads used to lay out the labels
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int getThreadCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Called by the label to postpone its layout. Returns false when no batch is active.
+        static bool postpone(Label* label);
+
+        // Called by a label that is destroyed or that had to be laid out immediately
+        static void cancel(Label* label);
+
+        // Lays out the postponed labels when the outermost batch is destroyed
+        static void flush(std::vector<Label*>& labels);
+
+        friend class Label;
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_LAYOUT_HPP
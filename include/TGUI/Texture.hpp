@@ -30,6 +30,7 @@
 
 #include <TGUI/TextureData.hpp>
 #include <TGUI/TextureManager.hpp>
+#include <TGUI/MemoryUsage.hpp>
 
 #include <TGUI/Global.hpp>
 
@@ -467,6 +468,8 @@ namespace tgui
         std::function<void(std::shared_ptr<TextureData>)> m_destructCallback;
         static TextureLoaderFunc m_textureLoader;
         static ImageLoaderFunc m_imageLoader;
+
+        friend std::size_t priv::getHeapMemoryUsage(const Texture& texture);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,97 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_VERTEX_CACHE_HPP
+#define TGUI_VERTEX_CACHE_HPP
+
+
+#include <TGUI/Borders.hpp>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Colored rectangles of a renderer that are kept between frames and drawn with a single draw call.
+        // The vertices are relative to the top left of the widget, the position has to be added to the transform when drawing.
+        // The renderer only has to rebuild the geometry when update returns true, which happens when the size, state or
+        // opacity of the widget changed or when a property of the renderer was changed and invalidate was called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API VertexCache : public sf::Drawable
+        {
+        public:
+
+            // Returns true and removes the old vertices when the geometry has to be rebuilt
+            bool update(sf::Vector2f size, unsigned int state, float opacity);
+
+            // Forces the geometry to be rebuilt before it is drawn the next time
+            void invalidate();
+
+            // Adds a rectangle to the geometry
+            void addRect(sf::Vector2f position, sf::Vector2f size, const sf::Color& color);
+
+            // Adds the four borders around a rectangle, the borders are placed outside the rectangle
+            void addBorders(sf::Vector2f position, sf::Vector2f size, const Borders& borders, const sf::Color& color);
+
+            // Returns the amount of vertices in the geometry
+            std::size_t getVertexCount() const
+            {
+                return m_vertices.size();
+            }
+
+            // Draws all rectangles with a single draw call
+            virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+        private:
+            friend std::size_t getHeapMemoryUsage(const VertexCache& cache);
+
+            std::vector<sf::Vertex> m_vertices;
+            sf::Vector2f m_size;
+            unsigned int m_state = 0;
+            float m_opacity = 0;
+            bool m_valid = false;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Estimated heap memory used by the vertices in the cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API std::size_t getHeapMemoryUsage(const VertexCache& cache);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_VERTEX_CACHE_HPP
@@ -33,6 +33,7 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/Font.hpp>
+#include <TGUI/MemoryUsage.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -175,6 +176,8 @@ namespace tgui
         ///
         /// @return Position of the widget
         ///
+        /// The position is cached and only recalculated after the widget or one of its parents moved.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual sf::Vector2f getAbsolutePosition() const;
 
@@ -315,6 +318,35 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the tab index of the widget.
+        ///
+        /// @param tabIndex  Position of the widget in the tab order compared to the other widgets in the same parent
+        ///
+        /// When pressing the tab key, widgets with a lower tab index are focused before widgets with a higher tab index.
+        /// Widgets with the same tab index are focused in the order in which they were added to their parent.
+        /// The tab index is 0 by default.
+        ///
+        /// @see Container::focusNextWidget
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTabIndex(int tabIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the tab index of the widget.
+        ///
+        /// @return Position of the widget in the tab order compared to the other widgets in the same parent
+        ///
+        /// @see setTabIndex
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getTabIndex() const
+        {
+            return m_tabIndex;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the type of the widget.
         ///
@@ -322,6 +354,18 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const std::string& getWidgetType() const
+        {
+            return m_callback.widgetType.getName();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the interned type of the widget
+        ///
+        /// @return Type of the widget, which can be compared with other types without comparing strings
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WidgetType getType() const
         {
             return m_callback.widgetType;
         }
@@ -473,6 +517,18 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the widget
+        ///
+        /// @return Approximate amount of bytes used by the widget, its renderer, its texts, its signals and its textures
+        ///
+        /// The widgets inside a container are not included, use Container::getMemoryUsageByType to find the memory used by
+        /// all widgets in a container.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called when the widget is added to a container.
@@ -606,6 +662,21 @@ namespace tgui
         virtual void mouseLeftWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function has to be called when something changed that could influence whether the widget can be focused
+        // with the tab key (e.g. when it is shown, hidden, enabled or disabled).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void focusOrderChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the cached absolute position as outdated. This function has to be called when the widget moves, when it gets
+        // a different parent or when the offset of the child widgets of its parent changes. Containers also mark the absolute
+        // positions of their children as outdated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidateAbsolutePosition();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -618,6 +689,11 @@ namespace tgui
         // This will point to our parent widget. If there is no parent then this will be nullptr.
         Container* m_parent = nullptr;
 
+        // Cached result of getAbsolutePosition, only used while m_absolutePositionValid is true.
+        // The position can only be valid when the absolute position of the parent is valid as well.
+        mutable sf::Vector2f m_absolutePosition;
+        mutable bool m_absolutePositionValid = false;
+
         // How transparent is the widget
         float m_opacity = 1;
 
@@ -631,6 +707,9 @@ namespace tgui
         // Can the widget be focused?
         bool m_allowFocus = false;
 
+        // Position of the widget in the tab order compared to its siblings
+        int m_tabIndex = 0;
+
         // Keep track of the elapsed time.
         sf::Time m_animationTimeElapsed;
 
@@ -724,6 +803,17 @@ namespace tgui
         virtual std::map<std::string, ObjectConverter> getPropertyValuePairs() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the renderer
+        ///
+        /// @return Approximate amount of bytes used by the renderer and its textures
+        ///
+        /// Renderers that have members of their own should override this function.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
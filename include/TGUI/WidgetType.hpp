@@ -0,0 +1,241 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_WIDGET_TYPE_HPP
+#define TGUI_WIDGET_TYPE_HPP
+
+
+#include <TGUI/Config.hpp>
+
+#include <ostream>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        struct WidgetTypeEntry;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Interned identifier of a widget type
+    ///
+    /// Every type name is registered only once, all widgets of the same type refer to the same entry. Comparing two
+    /// WidgetType objects is thus as cheap as comparing two integers, while the name remains available.
+    ///
+    /// Custom widgets get their own type by assigning a name in their constructor, just like the built-in widgets do:
+    /// @code
+    /// MyWidget::MyWidget()
+    /// {
+    ///     m_callback.widgetType = "MyWidget";
+    /// }
+    /// @endcode
+    ///
+    /// The type of a widget can then be checked without string comparisons:
+    /// @code
+    /// static const tgui::WidgetType buttonType{"Button"};
+    /// if (widget->getType() == buttonType)
+    ///     ...
+    /// @endcode
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API WidgetType
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor, the type will be "Unknown" with id 0
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WidgetType();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the type with the given name, the name is registered when it didn't exist yet
+        ///
+        /// @param name  Name of the widget type (case-sensitive)
+        ///
+        /// Registering is thread-safe. Keep the object around instead of constructing it from a string every time.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WidgetType(const std::string& name);
+        WidgetType(const char* name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the number that identifies the widget type
+        ///
+        /// @return Id of the type. Ids are assigned in the order in which the types were registered, starting at 0 for
+        ///         the "Unknown" type. The ids of the built-in widgets are always the same.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getId() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the name of the widget type
+        ///
+        /// @return Name of the type, e.g. "Button"
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::string& getName() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the name of the widget type in lowercase
+        ///
+        /// @return Lowercase name of the type, e.g. "button"
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::string& getLowercaseName() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the registered type of which the lowercase name equals the given name
+        ///
+        /// @param lowercaseName  Name of the widget type in lowercase, e.g. "button"
+        ///
+        /// @return The type with the given lowercase name, or the "Unknown" type when no such type was registered.
+        ///         Unlike the constructor, this function never registers a new type.
+        ///
+        /// This is used when loading widgets from theme files, which don't care about the case of the type names.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static WidgetType findByLowercaseName(const std::string& lowercaseName);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of widget types that have been registered, including the "Unknown" type
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int getTypeCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compares two widget types by their id
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool operator==(const WidgetType& right) const
+        {
+            return m_entry == right.m_entry;
+        }
+
+        bool operator!=(const WidgetType& right) const
+        {
+            return m_entry != right.m_entry;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compares the name of the widget type with a string, without registering the string as a type
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool operator==(const std::string& name) const
+        {
+            return getName() == name;
+        }
+
+        bool operator!=(const std::string& name) const
+        {
+            return getName() != name;
+        }
+
+        bool operator==(const char* name) const
+        {
+            return getName() == name;
+        }
+
+        bool operator!=(const char* name) const
+        {
+            return getName() != name;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Orders widget types by their id
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool operator<(const WidgetType& right) const
+        {
+            return getId() < right.getId();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts the type to its name, for compatibility with code that treated the type as a string
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        operator const std::string&() const
+        {
+            return getName();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        explicit WidgetType(const priv::WidgetTypeEntry* entry);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        const priv::WidgetTypeEntry* m_entry;
+    };
+
+
+    inline bool operator==(const std::string& name, const WidgetType& type)
+    {
+        return type == name;
+    }
+
+    inline bool operator!=(const std::string& name, const WidgetType& type)
+    {
+        return type != name;
+    }
+
+    inline bool operator==(const char* name, const WidgetType& type)
+    {
+        return type == name;
+    }
+
+    inline bool operator!=(const char* name, const WidgetType& type)
+    {
+        return type != name;
+    }
+
+    inline std::ostream& operator<<(std::ostream& stream, const WidgetType& type)
+    {
+        return stream << type.getName();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_WIDGET_TYPE_HPP
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Widgets/Label.hpp>
+#include <TGUI/VertexCache.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -216,6 +217,15 @@ namespace tgui
         virtual void widgetFocused() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the widget
+        ///
+        /// @return Approximate amount of bytes used by the widget, its renderer, its texts, its signals and its textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -335,6 +345,15 @@ namespace tgui
         virtual std::map<std::string, ObjectConverter> getPropertyValuePairs() const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the renderer
+        ///
+        /// @return Approximate amount of bytes used by the renderer and its textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the color of the text.
         ///
@@ -481,6 +500,16 @@ namespace tgui
         void setFocusTexture(const Texture& texture);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the borders.
+        ///
+        /// @param borders  The size of the borders
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setBorders(const Borders& borders) override;
+        using WidgetBorders::setBorders;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -516,6 +545,9 @@ namespace tgui
         Texture m_textureDown;
         Texture m_textureFocused;
 
+        // Background color and borders, only rebuilt when they changed since the last time they were drawn
+        mutable priv::VertexCache m_geometry;
+
         friend class Button;
         friend class ChildWindow;
         friend class ChildWindowRenderer;
@@ -173,6 +173,15 @@ namespace tgui
         virtual void setOpacity(float opacity) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the widget
+        ///
+        /// @return Approximate amount of bytes used by the widget, its renderer, its texts, its signals and its textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
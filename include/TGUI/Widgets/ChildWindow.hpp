@@ -30,6 +30,7 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Widgets/Label.hpp>
+#include <TGUI/VertexCache.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -345,6 +346,15 @@ namespace tgui
         virtual void mouseNoLongerDown() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the widget
+        ///
+        /// @return Approximate amount of bytes used by the widget, its renderer, its texts, its signals and its textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -477,6 +487,15 @@ namespace tgui
         virtual std::map<std::string, ObjectConverter> getPropertyValuePairs() const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the renderer
+        ///
+        /// @return Approximate amount of bytes used by the renderer and its textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the color of the title bar
         ///
@@ -597,6 +616,12 @@ namespace tgui
 
         sf::String   m_closeButtonClassName = "";
 
+        // Title bar color and borders, only rebuilt when they changed since the last time they were drawn
+        mutable priv::VertexCache m_geometry;
+
+        // Background below the child widgets, drawn separately because it is placed between the title bar and the widgets
+        mutable priv::VertexCache m_backgroundGeometry;
+
         friend class ChildWindow;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
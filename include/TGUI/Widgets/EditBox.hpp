@@ -77,12 +77,15 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Predefined input validators
+        ///
+        /// These validators are recognized by setInputValidator and checked without using std::regex.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         struct Validator
         {
             static TGUI_API std::string Int;   ///< Accept negative and positive integers
             static TGUI_API std::string UInt;  ///< Accept only positive integers
             static TGUI_API std::string Float; ///< Accept decimal numbers
+            static TGUI_API std::string Hex;   ///< Accept hexadecimal digits
         };
 
 
@@ -391,10 +394,30 @@ namespace tgui
         /// edit1->setInputValidator(tgui::EditBox::Validator::Int);
         /// edit2->setInputValidator("[a-zA-Z][a-zA-Z0-9]*");
         /// @endcode
+        ///
+        /// The predefined validators from EditBox::Validator only check the typed character and its position, which is a lot
+        /// faster than matching a regex against the entire text on every key press.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setInputValidator(const std::string& regex = ".*");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only accept the given characters as input
+        ///
+        /// @param allowedCharacters  The characters that can be typed in the edit box
+        /// @param maxLength          Maximum length of the text, or 0 to not limit the length
+        ///
+        /// The typed characters are checked without using std::regex. Unlike with setInputValidator, unicode characters can
+        /// be allowed. getInputValidator will return an equivalent regex in which characters outside the ascii range are written
+        /// as \\uXXXX. Passing that regex to setInputValidator restores the same character set.
+        ///
+        /// @code
+        /// editBox->setAllowedCharacters("abcdefghijklmnopqrstuvwxyz_", 16);
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAllowedCharacters(const sf::String& allowedCharacters, std::size_t maxLength = 0);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the regex to which the text is matched
         ///
@@ -462,6 +485,15 @@ namespace tgui
         virtual void widgetUnfocused() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the widget
+        ///
+        /// @return Approximate amount of bytes used by the widget, its renderer, its texts, its signals and its textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -499,6 +531,18 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Checks whether the character is allowed by the input validator when it would be inserted at the given position
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isValidInsertion(sf::Uint32 key, std::size_t position) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Checks whether the entire text is allowed by the input validator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isValidText(const sf::String& text) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the position of the texts.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -541,8 +585,23 @@ namespace tgui
         sf::String    m_displayedText;
         sf::String    m_text;
 
+        // The input validator. The regex is only compiled when it isn't one of the predefined validators.
+        enum class ValidatorType
+        {
+            None,
+            Int,
+            UInt,
+            Float,
+            Hex,
+            CharacterSet,
+            Regex
+        };
+
+        ValidatorType m_validatorType = ValidatorType::None;
         std::string   m_regexString = ".*";
-        std::regex    m_regex = std::regex{m_regexString};
+        std::regex    m_regex;
+        std::basic_string<sf::Uint32> m_allowedCharacters; // Sorted, used by the CharacterSet validator
+        std::size_t   m_allowedLength = 0;
 
         // This will store the size of the text ( 0 to auto size )
         unsigned int  m_textSize = 0;
@@ -650,6 +709,15 @@ namespace tgui
         virtual std::map<std::string, ObjectConverter> getPropertyValuePairs() const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the renderer
+        ///
+        /// @return Approximate amount of bytes used by the renderer and its textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the padding of the edit box.
         ///
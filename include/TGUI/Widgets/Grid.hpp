@@ -210,6 +210,15 @@ namespace tgui
         virtual bool mouseOnWidget(float x, float y) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the widget
+        ///
+        /// @return Approximate amount of bytes used by the widget, its renderer, its texts, its signals and its textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -226,6 +235,38 @@ namespace tgui
         void updatePositionsOfAllWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when the size of a widget in the grid changed. Only the row and column of the widget are recalculated and
+        // only the widgets that are placed behind them are moved, unless the space that is distributed over the cells changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateCellSize(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the size of a single column or row from the widgets inside it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateColumnWidth(unsigned int column);
+        void updateRowHeight(unsigned int row);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the real size of the grid and the space that is added around the widgets when the grid is too big.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateAvailableSpace();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places a widget inside its cell, based on its borders and alignment.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgetPosition(unsigned int row, unsigned int column, sf::Vector2f cellPosition);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the cell sizes and repositions the widgets once after a batch started with beginUpdate ends
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void applyPostponedUpdate() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -253,6 +294,17 @@ namespace tgui
 
         std::map<Widget::Ptr, unsigned int> m_connectedCallbacks;
 
+        // Cell of every widget in the grid, so that the widget doesn't have to be searched in m_gridWidgets
+        struct Cell
+        {
+            unsigned int row;
+            unsigned int column;
+        };
+        std::unordered_map<const Widget*, Cell> m_widgetCells;
+
+        // Space added on each side of every cell, which is non-zero when the grid is bigger than its contents
+        sf::Vector2f m_availSpaceOffset;
+
         sf::Vector2f m_realSize; // Actual size of the grid, while m_size contains the intended size
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/TextLayout.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -93,6 +94,32 @@ namespace tgui
         static Label::Ptr copy(Label::ConstPtr label);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        ///
+        /// @param copy  Instance to copy
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Label(const Label& copy);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of assignment operator
+        ///
+        /// @param right  Instance to assign
+        ///
+        /// @return Reference to itself
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Label& operator= (const Label& right);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~Label();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the renderer, which gives access to functions that determine how the widget is displayed
         ///
@@ -140,6 +167,17 @@ namespace tgui
         using Transformable::setSize;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the label
+        ///
+        /// @return Size of the label
+        ///
+        /// When the text of the label is waiting to be laid out by a TextLayoutBatch, it is laid out immediately.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Vector2f getSize() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the full size of the label
         ///
@@ -337,6 +375,48 @@ namespace tgui
         float getMaximumTextWidth() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the text in a fixed amount of equally wide cells, for counters and other values that change often
+        ///
+        /// @param characterCount  Amount of characters that the label can show, or 0 to go back to normal text
+        ///
+        /// In numeric mode the label only shows a single line with the characters "0123456789+-.,:% ". The glyphs of these
+        /// characters are looked up once, changing the text afterwards only overwrites the quads of the characters that
+        /// changed. The text is never wrapped and the size of an auto-sized label doesn't depend on the text.
+        ///
+        /// The horizontal alignment decides to which cells a text that is shorter than the character count is aligned.
+        /// Characters that aren't part of the set are shown as spaces and characters beyond the character count are cut off.
+        ///
+        /// @see updateDigits
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setNumericMode(unsigned int characterCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of characters shown in numeric mode
+        ///
+        /// @return Character count that was passed to setNumericMode, 0 when the label isn't in numeric mode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getNumericCharacterCount() const
+        {
+            return m_numericCharacterCount;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the text of a label in numeric mode without allocating memory or laying out the text again
+        ///
+        /// @param text  The new text, e.g. the result of tgui::to_string
+        ///
+        /// This is the same as setText while the label is in numeric mode, which also uses this fast path.
+        /// When the label isn't in numeric mode, the text is simply passed to setText.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateDigits(const sf::String& text);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the opacity of the widget.
         ///
@@ -371,6 +451,15 @@ namespace tgui
         virtual void leftMouseReleased(float x, float y) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the widget
+        ///
+        /// @return Approximate amount of bytes used by the widget, its renderer, its texts, its signals and its textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -410,6 +499,42 @@ namespace tgui
         void rearrangeText();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width in which the text has to fit, or 0 when the lines can be arbitrary long.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getTextMaxWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the lines of text after the string was split by priv::wrapText
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyTextLayout(const priv::TextLayoutResult& layout, float maxWidth);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Looks up the glyphs of the numeric character set and creates the quads of all cells
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyNumericLayout();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Overwrites the quads of the cells of which the character changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateNumericCells();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gives all cells in numeric mode the text color
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateNumericColor();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the lines of text, or the cells in numeric mode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawText(sf::RenderTarget& target, const sf::RenderStates& states) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -436,7 +561,26 @@ namespace tgui
         // Will be set to true after the first click, but gets reset to false when the second click does not occur soon after
         bool m_possibleDoubleClick = false;
 
+        // Set while a TextLayoutBatch has postponed the rearranging of the text
+        bool m_textLayoutPending = false;
+
+        // Numeric mode: a quad per cell in m_numericVertices, m_numericCells stores which glyph of the set each cell shows
+        struct NumericGlyph
+        {
+            sf::FloatRect bounds;
+            sf::FloatRect textureRect;
+            float advance;
+        };
+
+        unsigned int m_numericCharacterCount = 0;
+        std::vector<NumericGlyph> m_numericGlyphs;
+        std::vector<unsigned char> m_numericCells;
+        sf::VertexArray m_numericVertices{sf::Triangles};
+        float m_numericCellWidth = 0;
+        sf::Vector2f m_numericTextPosition;
+
         friend LabelRenderer;
+        friend TextLayoutBatch;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -503,6 +647,15 @@ namespace tgui
         virtual std::map<std::string, ObjectConverter> getPropertyValuePairs() const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the renderer
+        ///
+        /// @return Approximate amount of bytes used by the renderer and its textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the size of the padding.
         ///
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/RowOrder.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -415,6 +416,33 @@ namespace tgui
         const std::vector<sf::String>& getItemIds();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sorts the items on a worker thread
+        ///
+        /// @param comparator  Function that returns true when the first item has to be placed before the second one
+        ///
+        /// The comparator is called on the worker thread with copies of the item texts, so it may not access any widgets.
+        /// The items are only reordered the next time the list box is updated (in Gui::updateTime), which takes very little
+        /// time compared to sorting the items. The selected item remains selected and items with the same text keep their order.
+        ///
+        /// A sort that didn't finish yet is cancelled when sortItems is called again or when items are added or removed.
+        /// Passing an empty function only cancels the pending sort.
+        ///
+        /// @code
+        /// listBox->sortItems([](const sf::String& left, const sf::String& right){ return left < right; });
+        /// @endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortItems(const std::function<bool(const sf::String&, const sf::String&)>& comparator);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the list box is still waiting for the result of sortItems
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSortPending() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the scrollbar of the list box.
         ///
@@ -592,6 +620,15 @@ namespace tgui
         virtual void mouseNoLongerDown() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the widget
+        ///
+        /// @return Approximate amount of bytes used by the widget, its renderer, its texts, its signals and its textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -601,6 +638,12 @@ namespace tgui
         void updateItemColors();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places the items in the given order, the order contains the old index of every item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyItemOrder(const std::vector<std::size_t>& order);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Reload the widget
         ///
@@ -666,6 +709,9 @@ namespace tgui
 
         bool m_autoScroll = true;
 
+        // Sorts the items for sortItems, it is never copied to another list box
+        priv::RowOrderTask m_sortTask;
+
         // ComboBox contains a list box internally and it should be able to adjust it.
         friend class ComboBox;
         friend class ListBoxRenderer;
@@ -737,6 +783,15 @@ namespace tgui
         virtual std::map<std::string, ObjectConverter> getPropertyValuePairs() const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the renderer
+        ///
+        /// @return Approximate amount of bytes used by the renderer and its textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual MemoryUsage getMemoryUsage() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Set the background color that will be used inside the list box.
         ///
@@ -38,6 +38,10 @@ namespace tgui
     ///
     /// Based on SFML-RichText (https://bitbucket.org/jacobalbano/sfml-richtext)
     ///
+    /// The markup is only parsed when the text is set or appended. The parsed runs are kept, so changing the font or text
+    /// size only has to lay out the text again. All characters are placed in a single vertex array that is drawn with the
+    /// font texture of the text size, instead of using an sf::Text for every part of the text with a different style.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API RichTextLabel : public ClickableWidget
     {
@@ -121,6 +125,19 @@ namespace tgui
         void setText(const sf::String& text);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds text at the end of the current text.
+        ///
+        /// @param text  Markup to append, it continues with the style and color at the end of the current text
+        ///
+        /// Only the new text is parsed and laid out, so this is much faster than calling setText with the complete text when
+        /// the label is used as a log. The result is the same as setText(getText() + text), unless the current text ends in
+        /// the middle of a color name.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void appendText(const sf::String& text);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the text.
         ///
@@ -185,6 +202,24 @@ namespace tgui
         sf::Color getColor(unsigned int argbHex) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the markup in runs and adds them to m_runs, continuing with the style and color of the last run
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void parseMarkup(const sf::String& markup);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the vertices of the runs starting at the given index behind the vertices of the runs before them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void layoutRuns(std::size_t firstRun);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the vertices of all runs, without parsing the markup again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void relayout();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -210,7 +245,27 @@ namespace tgui
         unsigned int m_textSize = 30;
 
         std::map<sf::String, sf::Color> m_colors;
-        std::vector<sf::Text> m_texts;
+
+        // Part of the text with a single style and color. Runs never contain newlines, they end in one instead.
+        struct Run
+        {
+            sf::String text;
+            sf::Uint32 style;
+            sf::Color color;
+            bool endsInNewline;
+        };
+
+        std::vector<Run> m_runs;
+
+        // Glyphs and underlines of all runs. They are all drawn with the font texture of m_textSize.
+        sf::VertexArray m_vertices{sf::Triangles};
+
+        // Position where the next run would be placed
+        sf::Vector2f m_pen;
+        sf::Uint32 m_previousChar = 0;
+
+        // True when the text ends with a backslash, which would escape a formatting character at the start of appended text
+        bool m_pendingEscape = false;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -27,7 +27,9 @@
 #define TGUI_TABLE_HPP
 
 #include <TGUI/BoxLayout.hpp>
+#include <TGUI/RowOrder.hpp>
 #include <TGUI/Widgets/devel/TableRow.hpp>
+#include <TGUI/Widgets/devel/TableDataSource.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -75,9 +77,55 @@ namespace tgui
 
         void setTextColor(const sf::Color& color);
 
+        // Shows the rows of a data source instead of rows added with addRow. Only the visible rows are created as widgets
+        // and these widgets are reused while scrolling. Pass a nullptr to go back to adding rows manually.
+        void setDataSource(const TableDataSource::Ptr& source);
+        TableDataSource::Ptr getDataSource() const;
+
+        // Has to be called when the rows of the data source changed
+        void notifyDataChanged();
+
+        // The scroll offset is only used with a data source. Doubles are used because the height of all rows together
+        // quickly becomes too large to be stored in a float without losing pixel precision.
+        void setScrollOffset(double offset);
+        double getScrollOffset() const;
+        double getContentHeight() const;
+
+        // Returns the position of the row that is displayed at the top of the table, getDataRow converts it to a data source row
+        std::size_t getFirstVisibleRow() const;
+
+        // Sorts the rows of the data source on a worker thread. The comparator receives two row indices of the data source
+        // and is called on the worker thread, so it may not access widgets and the data source may not be changed until
+        // isRowOrderPending returns false. The table shows the new order from the next time the gui is updated.
+        // A request that didn't finish yet is cancelled when a new one is made. Passing an empty function stops sorting.
+        void sortRows(const std::function<bool(std::size_t, std::size_t)>& comparator);
+
+        // Only shows the rows of the data source for which the predicate returns true. The filter is calculated in the same
+        // way as sortRows and the rows that pass the filter remain sorted. Passing an empty function shows all rows again.
+        void filterRows(const std::function<bool(std::size_t)>& predicate);
+
+        // Returns true while the table is waiting for the result of sortRows or filterRows
+        bool isRowOrderPending() const;
+
+        // Returns the amount of rows that are shown, which are all rows of the data source that pass the filter
+        std::size_t getDisplayedRowCount() const;
+
+        // Returns the index in the data source of the row at the given position in the table
+        std::size_t getDataRow(std::size_t displayedRow) const;
+
+        virtual void mouseWheelMoved(int delta, int x, int y) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
+        virtual void update(sf::Time elapsedTime) override;
         virtual void updateWidgetPositions() override;
+        virtual void invalidateAbsolutePosition() override;
+        void updateRowOrder();
+        void updateVisibleRows();
+        void updateRowOffsets();
+        double getRowOffset(std::size_t row) const;
+        float getRowHeight(std::size_t row) const;
+        sf::Color getRowColor(std::size_t row) const;
         void calculateLabelHeight();
         void updateColumnsDelimitatorsPosition();
         void updateColumnsDelimitatorsSize();
@@ -101,6 +149,18 @@ namespace tgui
         unsigned int m_characterSize = 18;
 
         sf::Color m_normalTextColor = sf::Color::Black;
+
+        TableDataSource::Ptr m_dataSource;
+        std::vector<double> m_rowOffsets; // Top of every row when the data source has variable row heights, plus the end
+        std::vector<std::size_t> m_slotRows; // Position of the row that is shown by each widget in m_widgets
+        std::size_t m_slotColumns = 0;
+        double m_scrollOffset = 0;
+
+        priv::RowOrderTask m_rowOrderTask;
+        std::function<bool(std::size_t, std::size_t)> m_rowComparator;
+        std::function<bool(std::size_t)> m_rowFilter;
+        std::vector<std::size_t> m_rowOrder; // Data source rows in the order in which they are shown, when m_rowOrderUsed
+        bool m_rowOrderUsed = false;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,114 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TABLE_DATA_SOURCE_HPP
+#define TGUI_TABLE_DATA_SOURCE_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Provides the contents of a Table without the table having to store a widget for every cell
+    ///
+    /// The table only asks for the cells of the rows that are visible. Call Table::notifyDataChanged after the data changed.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TableDataSource
+    {
+    public:
+        typedef std::shared_ptr<TableDataSource> Ptr; ///< Shared data source pointer
+
+        virtual ~TableDataSource() {};
+
+        /// Returns the amount of rows in the table
+        virtual std::size_t getRowCount() const = 0;
+
+        /// Returns the amount of columns in the table
+        virtual std::size_t getColumnCount() const = 0;
+
+        /// Returns the text to display in a cell
+        virtual sf::String getCell(std::size_t row, std::size_t column) const = 0;
+
+        /// Returns whether getRowHeight has to be called for every row. When false, all rows have the default height.
+        virtual bool hasVariableRowHeights() const
+        {
+            return false;
+        }
+
+        /// Returns the height of a row, 0 means the default height of the table. Only used when hasVariableRowHeights is true.
+        virtual float getRowHeight(std::size_t) const
+        {
+            return 0;
+        }
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Data source that stores the cells as strings, one vector per column
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ColumnTableDataSource : public TableDataSource
+    {
+    public:
+        typedef std::shared_ptr<ColumnTableDataSource> Ptr; ///< Shared data source pointer
+
+        explicit ColumnTableDataSource(std::size_t columnCount);
+
+        /// Reserves memory for the given amount of rows
+        void reserve(std::size_t rowCount);
+
+        /// Adds a row at the bottom, missing cells are left empty and extra cells are ignored
+        void addRow(const std::vector<std::string>& cells);
+
+        /// Changes the text of a single cell, the row and column have to exist
+        void setCell(std::size_t row, std::size_t column, const std::string& text);
+
+        /// Removes all rows, the columns are kept
+        void removeAllRows();
+
+        virtual std::size_t getRowCount() const override;
+        virtual std::size_t getColumnCount() const override;
+        virtual sf::String getCell(std::size_t row, std::size_t column) const override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+        std::vector<std::vector<std::string>> m_columns;
+        std::size_t m_rowCount = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TABLE_DATA_SOURCE_HPP
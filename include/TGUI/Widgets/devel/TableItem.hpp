@@ -60,6 +60,9 @@ namespace tgui
 
         void setHorizontalAlign(HorizontalAlign align);
 
+        // Changes the text when the item is a label
+        void setText(const sf::String& text);
+
         void setFont(const Font& font);
 
         virtual void setSize(const Layout2d& size) override;
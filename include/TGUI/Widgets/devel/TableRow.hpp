@@ -55,6 +55,9 @@ namespace tgui
         void addItem(const std::string& name, const sf::Color& color);
         void addItems(const std::vector<std::string>& columns, const sf::Color& color, TableItem::HorizontalAlign align = TableItem::None);
 
+        // Changes the text of an existing item without recreating it
+        void setItemText(std::size_t column, const sf::String& text);
+
         bool insert(std::size_t index, const tgui::Widget::Ptr& widget, TableItem::HorizontalAlign align, const sf::String& widgetName = "");
         virtual void add(const tgui::Widget::Ptr& widget, const sf::String& widgetName = "") override;
         void add(const tgui::Widget::Ptr& widget, TableItem::HorizontalAlign align, const sf::String& widgetName = "");
@@ -91,6 +94,8 @@ namespace tgui
         TableItem::HorizontalAlign m_align = TableItem::Left;
 
         float m_customHeight = 0.f;
+
+        friend class Table; // Invalidates the cached absolute position of its header
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
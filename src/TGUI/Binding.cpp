@@ -0,0 +1,162 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Binding.hpp>
+#include <TGUI/Widgets/Knob.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/ProgressBar.hpp>
+#include <TGUI/Widgets/Slider.hpp>
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Bindings::bindText(const Label::Ptr& label, const std::shared_ptr<Observable<sf::String>>& observable)
+    {
+        bind(label, observable, [](Label& widget, const sf::String& text){ widget.setText(text); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Bindings::bindValue(const ProgressBar::Ptr& progressBar, const std::shared_ptr<Observable<unsigned int>>& observable)
+    {
+        bind(progressBar, observable, [](ProgressBar& widget, unsigned int value){ widget.setValue(value); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Bindings::bindValue(const Slider::Ptr& slider, const std::shared_ptr<Observable<int>>& observable)
+    {
+        bind(slider, observable, [](Slider& widget, int value){ widget.setValue(value); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Bindings::bindValue(const Knob::Ptr& knob, const std::shared_ptr<Observable<int>>& observable)
+    {
+        bind(knob, observable, [](Knob& widget, int value){ widget.setValue(value); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Bindings::unbind(const Widget* widget)
+    {
+        for (auto& binding : m_bindings)
+        {
+            if (binding->isBoundTo(widget))
+                binding->markRemoved();
+        }
+
+        // A binding that is being applied may not be destroyed yet, apply will remove it when it finishes
+        if (m_applying)
+            m_removePending = true;
+        else
+            removeBindings();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Bindings::unbindAll()
+    {
+        if (m_applying)
+        {
+            for (auto& binding : m_bindings)
+                binding->markRemoved();
+
+            m_removePending = true;
+        }
+        else
+            m_bindings.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Bindings::apply()
+    {
+        if (m_bindings.empty() || m_applying)
+            return 0;
+
+        // Indices are used because a setter could trigger a callback that adds a binding,
+        // and a callback could also unbind widgets, in which case the bindings are only destroyed after the loop.
+        std::size_t updated = 0;
+        m_applying = true;
+        for (std::size_t i = 0; i < m_bindings.size(); ++i)
+        {
+            if (m_bindings[i]->isRemoved())
+                continue;
+
+            if (m_bindings[i]->apply())
+                ++updated;
+            else if (m_bindings[i]->isExpired())
+                m_removePending = true;
+        }
+        m_applying = false;
+
+        if (m_removePending)
+        {
+            removeBindings();
+            m_removePending = false;
+        }
+
+        m_updateCount += updated;
+        return updated;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Bindings::applyNewBinding()
+    {
+        // The binding is protected in the same way as in apply, the setter could trigger a callback that unbinds the widget
+        priv::BindingBase* binding = m_bindings.back().get();
+        const bool wasApplying = m_applying;
+        m_applying = true;
+        binding->apply();
+        m_applying = wasApplying;
+
+        if (!m_applying && m_removePending)
+        {
+            removeBindings();
+            m_removePending = false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Bindings::removeBindings()
+    {
+        m_bindings.erase(std::remove_if(m_bindings.begin(), m_bindings.end(),
+                                        [](const std::unique_ptr<priv::BindingBase>& binding){ return binding->isRemoved() || binding->isExpired(); }),
+                         m_bindings.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -46,6 +46,10 @@ namespace tgui
             m_widgets.insert(m_widgets.begin() + index, widget);
             m_widgets.pop_back(); // The widget was added at the back with Container::add
 
+            m_objName.insert(m_objName.begin() + index, widgetName);
+            m_objName.pop_back();
+            updateWidgetIndices(index);
+
             m_widgetsRatio.insert(m_widgetsRatio.begin() + index, 1.f);
             m_widgetsFixedSizes.insert(m_widgetsFixedSizes.begin() + index, 0.f);
             updateWidgetPositions();
@@ -221,6 +225,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage BoxLayout::getMemoryUsage() const
+    {
+        auto usage = Panel::getMemoryUsage();
+        usage.widget += sizeof(BoxLayout) - sizeof(Panel);
+
+        usage.widget += (m_widgetsRatio.capacity() + m_widgetsFixedSizes.capacity()) * sizeof(float);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BoxLayout::applyPostponedUpdate()
+    {
+        updateWidgetPositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BoxLayout::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         // Set the position
@@ -0,0 +1,235 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/CommandQueue.hpp>
+
+#include <SFML/System/Clock.hpp>
+
+#include <algorithm>
+#include <unordered_set>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    struct PropertyKey
+    {
+        const void* object;
+        const std::string* property;
+
+        bool operator==(const PropertyKey& other) const
+        {
+            return (object == other.object) && (*property == *other.property);
+        }
+    };
+
+    struct PropertyKeyHash
+    {
+        std::size_t operator()(const PropertyKey& key) const
+        {
+            return std::hash<const void*>()(key.object) ^ (std::hash<std::string>()(*key.property) * 31);
+        }
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue::CommandQueue() :
+        m_head{&m_stub},
+        m_tail{&m_stub}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue::~CommandQueue()
+    {
+        for (Node* node : m_batch)
+            delete node;
+
+        while (Node* node = pop())
+            delete node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CommandQueue::post(std::function<void()> command)
+    {
+        post(nullptr, "", std::move(command));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CommandQueue::post(const void* object, std::string property, std::function<void()> command)
+    {
+        if (!command)
+            return;
+
+        Node* node = new Node;
+        node->command = std::move(command);
+        node->object = object;
+        node->property = std::move(property);
+
+        m_depth.fetch_add(1, std::memory_order_relaxed);
+        push(node);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t CommandQueue::execute()
+    {
+        if (m_batch.empty() && (m_tail == &m_stub) && !m_stub.next.load(std::memory_order_acquire))
+        {
+            m_lastDrainDuration = sf::Time::Zero;
+            return 0;
+        }
+
+        const sf::Clock clock;
+
+        while (m_batch.size() < m_maxBatchSize)
+        {
+            Node* node = pop();
+            if (!node)
+                break;
+
+            m_batch.push_back(node);
+        }
+
+        coalesceBatch();
+
+        std::size_t executed = 0;
+        while (!m_batch.empty())
+        {
+            if ((executed > 0) && (m_timeBudget > sf::Time::Zero) && (clock.getElapsedTime() >= m_timeBudget))
+                break;
+
+            const std::unique_ptr<Node> node{m_batch.front()};
+            m_batch.pop_front();
+            m_depth.fetch_sub(1, std::memory_order_relaxed);
+
+            ++executed;
+            ++m_executedCount;
+            node->command();
+        }
+
+        m_lastDrainDuration = clock.getElapsedTime();
+        m_maxDrainDuration = std::max(m_maxDrainDuration, m_lastDrainDuration);
+        return executed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CommandQueue::setMaxBatchSize(std::size_t size)
+    {
+        m_maxBatchSize = std::max<std::size_t>(size, 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CommandQueue::push(Node* node)
+    {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        Node* previous = m_head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue::Node* CommandQueue::pop()
+    {
+        Node* tail = m_tail;
+        Node* next = tail->next.load(std::memory_order_acquire);
+
+        // Skip the stub node
+        if (tail == &m_stub)
+        {
+            if (!next)
+                return nullptr;
+
+            m_tail = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next)
+        {
+            m_tail = next;
+            return tail;
+        }
+
+        // Another thread already exchanged the head but hasn't linked its node yet
+        if (tail != m_head.load(std::memory_order_acquire))
+            return nullptr;
+
+        // The tail is the last node, put the stub behind it so that the tail can be removed
+        push(&m_stub);
+
+        next = tail->next.load(std::memory_order_acquire);
+        if (next)
+        {
+            m_tail = next;
+            return tail;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CommandQueue::coalesceBatch()
+    {
+        const bool hasProperties = std::any_of(m_batch.begin(), m_batch.end(), [](const Node* node){ return node->object != nullptr; });
+        if (!hasProperties)
+            return;
+
+        // Walk backwards so that the last command for each property is the one that is kept
+        std::unordered_set<PropertyKey, PropertyKeyHash> seenProperties;
+        for (auto it = m_batch.rbegin(); it != m_batch.rend(); ++it)
+        {
+            if (!(*it)->object)
+                continue;
+
+            if (!seenProperties.insert({(*it)->object, &(*it)->property}).second)
+            {
+                delete *it;
+                *it = nullptr;
+
+                m_depth.fetch_sub(1, std::memory_order_relaxed);
+                ++m_coalescedCount;
+            }
+        }
+
+        m_batch.erase(std::remove(m_batch.begin(), m_batch.end(), nullptr), m_batch.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,8 @@
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetSaver.hpp>
 #include <TGUI/Loading/WidgetLoader.hpp>
+#include <TGUI/TextLayout.hpp>
+#include <TGUI/Profiler.hpp>
 
 #include <stack>
 #include <cassert>
@@ -35,10 +37,42 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Estimated memory used by the buckets and nodes of an unordered map or set
+    template <typename HashTable>
+    std::size_t getHashTableMemoryUsage(const HashTable& table)
+    {
+        return table.bucket_count() * sizeof(void*) + table.size() * (2 * sizeof(void*) + sizeof(typename HashTable::value_type));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t Container::m_widgetNamesVersion = 0;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t priv::StringHash::operator()(const sf::String& str) const
+    {
+        // FNV-1a hash over the UTF-32 characters
+        std::size_t hash = 2166136261u;
+        const sf::Uint32* data = str.getData();
+        for (std::size_t i = 0; i < str.getSize(); ++i)
+        {
+            hash ^= data[i];
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Container::Container()
     {
         m_containerWidget = true;
@@ -51,6 +85,9 @@ namespace tgui
         Widget                   {containerToCopy},
         m_focusedWidget          {0}
     {
+        // Widgets that weren't loaded yet have to exist before they can be copied
+        const_cast<Container&>(containerToCopy).loadPendingWidgets();
+
         // Copy all the widgets
         for (std::size_t i = 0; i < containerToCopy.m_widgets.size(); ++i)
             add(containerToCopy.m_widgets[i]->clone(), containerToCopy.m_objName[i]);
@@ -71,6 +108,9 @@ namespace tgui
             // Remove all the old widgets
             removeAllWidgets();
 
+            // Widgets that weren't loaded yet have to exist before they can be copied
+            const_cast<Container&>(right).loadPendingWidgets();
+
             // Copy all the widgets
             for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
                 add(right.m_widgets[i]->clone(), right.m_objName[i]);
@@ -85,6 +125,8 @@ namespace tgui
     {
         Widget::setFont(font);
 
+        // The labels inside the container are all rearranged at once when the batch ends
+        TextLayoutBatch batch;
         for (auto& widget : m_widgets)
             widget->setFont(font);
     }
@@ -103,6 +145,10 @@ namespace tgui
         m_widgets.push_back(widgetPtr);
         m_objName.push_back(widgetName);
 
+        m_widgetIndices[widgetPtr.get()] = m_widgets.size() - 1;
+        addToNameIndex(m_widgets.size() - 1);
+        invalidateFocusOrder();
+
         if (m_opacity < 1)
             widgetPtr->setOpacity(m_opacity);
     }
@@ -111,56 +157,92 @@ namespace tgui
 
     Widget::Ptr Container::get(const sf::String& widgetName, bool recursive) const
     {
-        for (std::size_t i = 0; i < m_objName.size(); ++i)
+        // If the widget wasn't loaded yet then load it now. Containers are never created as const objects,
+        // the function is only const because finding the widget doesn't change the container from the outside.
+        if (m_pendingWidgetsLoader && (m_pendingWidgetNames.find(widgetName) != m_pendingWidgetNames.end()))
+            const_cast<Container*>(this)->loadPendingWidgetsImpl();
+
+        // Find the widget with this name directly inside this container
+        std::size_t index = m_widgets.size();
+        auto it = m_widgetsByName.find(widgetName);
+        if (it != m_widgetsByName.end())
+            index = m_widgetIndices.at(it->second.widget);
+
+        // Widgets inside containers that come before the found widget take precedence
+        if (recursive)
         {
-            if (m_objName[i] == widgetName)
+            for (std::size_t i = 0; i < index; ++i)
             {
-                return m_widgets[i];
-            }
-            else if (recursive && m_widgets[i]->m_containerWidget)
-            {
-                Widget::Ptr widget = std::static_pointer_cast<Container>(m_widgets[i])->get(widgetName, true);
-                if (widget != nullptr)
-                    return widget;
+                if (m_widgets[i]->m_containerWidget)
+                {
+                    Widget::Ptr widget = std::static_pointer_cast<Container>(m_widgets[i])->get(widgetName, true);
+                    if (widget != nullptr)
+                        return widget;
+                }
             }
         }
 
-        return nullptr;
+        if (index < m_widgets.size())
+            return m_widgets[index];
+        else
+            return nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Container::remove(const Widget::Ptr& widget)
+    Widget::Ptr Container::getByPath(const sf::String& path) const
     {
-        // Loop through every widget
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        const Container* container = this;
+        std::size_t start = 0;
+        while (true)
         {
-            // Check if the pointer matches
-            if (m_widgets[i] == widget)
-            {
-                if (m_widgetBelowMouse == widget)
-                {
-                    widget->mouseNoLongerOnWidget();
-                    m_widgetBelowMouse = nullptr;
-                }
+            std::size_t end = path.find(".", start);
+            Widget::Ptr widget = container->get(path.substring(start, (end != sf::String::InvalidPos) ? end - start : sf::String::InvalidPos));
+            if ((widget == nullptr) || (end == sf::String::InvalidPos))
+                return widget;
 
-                // Unfocus the widget if it was focused
-                if (m_focusedWidget == i+1)
-                    unfocusWidgets();
+            // Only containers can have the remaining part of the path inside them
+            if (!widget->m_containerWidget)
+                return nullptr;
 
-                // Change the index of the focused widget if this is needed
-                else if (m_focusedWidget > i+1)
-                    m_focusedWidget--;
+            container = static_cast<const Container*>(widget.get());
+            start = end + 1;
+        }
+    }
 
-                // Remove the widget
-                widget->setParent(nullptr);
-                m_widgets.erase(m_widgets.begin() + i);
-                m_objName.erase(m_objName.begin() + i);
-                return true;
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::remove(const Widget::Ptr& widget)
+    {
+        auto it = m_widgetIndices.find(widget.get());
+        if (it == m_widgetIndices.end())
+            return false;
+
+        const std::size_t i = it->second;
+        if (m_widgetBelowMouse == widget)
+        {
+            widget->mouseNoLongerOnWidget();
+            m_widgetBelowMouse = nullptr;
         }
 
-        return false;
+        // Unfocus the widget if it was focused
+        if (m_focusedWidget == i+1)
+            unfocusWidgets();
+
+        // Change the index of the focused widget if this is needed
+        else if (m_focusedWidget > i+1)
+            m_focusedWidget--;
+
+        // Remove the widget
+        const sf::String name = m_objName[i];
+        widget->setParent(nullptr);
+        m_widgets.erase(m_widgets.begin() + i);
+        m_objName.erase(m_objName.begin() + i);
+        m_widgetIndices.erase(it);
+
+        removeFromNameIndex(name, widget.get());
+        updateWidgetIndices(i);
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -173,6 +255,13 @@ namespace tgui
         // Clear the lists
         m_widgets.clear();
         m_objName.clear();
+        m_widgetsByName.clear();
+        m_widgetIndices.clear();
+        m_widgetNamesVersion++;
+        invalidateFocusOrder();
+
+        m_pendingWidgetsLoader = nullptr;
+        m_pendingWidgetNames.clear();
 
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = 0;
@@ -182,27 +271,49 @@ namespace tgui
 
     bool Container::setWidgetName(const Widget::Ptr& widget, const std::string& name)
     {
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            if (m_widgets[i] == widget)
-            {
-                m_objName[i] = name;
-                return true;
-            }
-        }
+        auto it = m_widgetIndices.find(widget.get());
+        if (it == m_widgetIndices.end())
+            return false;
 
-        return false;
+        const sf::String oldName = m_objName[it->second];
+        m_objName[it->second] = name;
+
+        removeFromNameIndex(oldName, widget.get());
+        addToNameIndex(it->second);
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::string Container::getWidgetName(const Widget::Ptr& widget) const
+    void Container::beginUpdate()
     {
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        m_updateDepth++;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::endUpdate()
+    {
+        // Without this check, an unbalanced call would make the depth wrap around in release builds and all future updates
+        // would be postponed forever
+        assert(m_updateDepth > 0);
+        if (m_updateDepth == 0)
+            return;
+
+        if (--m_updateDepth == 0 && m_updatePostponed)
         {
-            if (m_widgets[i] == widget)
-                return m_objName[i];
+            m_updatePostponed = false;
+            applyPostponedUpdate();
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string Container::getWidgetName(const Widget::Ptr& widget) const
+    {
+        auto it = m_widgetIndices.find(widget.get());
+        if (it != m_widgetIndices.end())
+            return m_objName[it->second];
 
         return "";
     }
@@ -254,112 +365,33 @@ namespace tgui
 
     void Container::focusNextWidget()
     {
-        // Loop all widgets behind the focused one
-        for (std::size_t i = m_focusedWidget; i < m_widgets.size(); ++i)
-        {
-            // If you are not allowed to focus the widget, then skip it
-            if (m_widgets[i]->m_allowFocus)
-            {
-                // Make sure that the widget is visible and enabled
-                if ((m_widgets[i]->isVisible()) && (m_widgets[i]->isEnabled()))
-                {
-                    if (m_focusedWidget)
-                    {
-                        // unfocus the current widget
-                        m_widgets[m_focusedWidget-1]->m_focused = false;
-                        m_widgets[m_focusedWidget-1]->widgetUnfocused();
-                    }
+        const std::size_t position = getFocusOrderPosition();
+        if (m_focusOrder.empty())
+            return;
 
-                    // Focus on the new widget
-                    m_focusedWidget = i+1;
-                    m_widgets[i]->m_focused = true;
-                    m_widgets[i]->widgetFocused();
-                    return;
-                }
-            }
-        }
+        // Skip the focused widget itself, the position may also point to the first widget behind a widget that can't be tabbed to
+        std::size_t nextPosition = position;
+        if ((position < m_focusOrder.size()) && m_focusOrder[position]->m_focused)
+            nextPosition++;
 
-        // None of the widgets behind the focused one could be focused, so loop the ones before it
-        if (m_focusedWidget)
-        {
-            for (std::size_t i = 0; i < m_focusedWidget - 1; ++i)
-            {
-                // If you are not allowed to focus the widget, then skip it
-                if (m_widgets[i]->m_allowFocus)
-                {
-                    // Make sure that the widget is visible and enabled
-                    if ((m_widgets[i]->isVisible()) && (m_widgets[i]->isEnabled()))
-                    {
-                        // unfocus the current widget
-                        m_widgets[m_focusedWidget-1]->m_focused = false;
-                        m_widgets[m_focusedWidget-1]->widgetUnfocused();
+        if (nextPosition >= m_focusOrder.size())
+            nextPosition = 0;
 
-                        // Focus on the new widget
-                        m_focusedWidget = i+1;
-                        m_widgets[i]->m_focused = true;
-                        m_widgets[i]->widgetFocused();
-
-                        return;
-                    }
-                }
-            }
-        }
+        m_focusOrder[nextPosition]->focus();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::focusPreviousWidget()
     {
-        // Loop the widgets before the focused one
-        if (m_focusedWidget)
-        {
-            for (std::size_t i = m_focusedWidget - 1; i > 0; --i)
-            {
-                // If you are not allowed to focus the widget, then skip it
-                if (m_widgets[i-1]->m_allowFocus)
-                {
-                    // Make sure that the widget is visible and enabled
-                    if ((m_widgets[i-1]->isVisible()) && (m_widgets[i-1]->isEnabled()))
-                    {
-                        // unfocus the current widget
-                        m_widgets[m_focusedWidget-1]->m_focused = false;
-                        m_widgets[m_focusedWidget-1]->widgetUnfocused();
-
-                        // Focus on the new widget
-                        m_focusedWidget = i;
-                        m_widgets[i-1]->m_focused = true;
-                        m_widgets[i-1]->widgetFocused();
-
-                        return;
-                    }
-                }
-            }
-        }
-
-        // None of the widgets before the focused one could be focused, so loop all widgets behind the focused one
-        for (std::size_t i = m_widgets.size(); i > m_focusedWidget; --i)
-        {
-            // If you are not allowed to focus the widget, then skip it
-            if (m_widgets[i-1]->m_allowFocus)
-            {
-                // Make sure that the widget is visible and enabled
-                if ((m_widgets[i-1]->isVisible()) && (m_widgets[i-1]->isEnabled()))
-                {
-                    if (m_focusedWidget)
-                    {
-                        // unfocus the current widget
-                        m_widgets[m_focusedWidget-1]->m_focused = false;
-                        m_widgets[m_focusedWidget-1]->widgetUnfocused();
-                    }
-
-                    // Focus on the new widget
-                    m_focusedWidget = i;
-                    m_widgets[i-1]->m_focused = true;
-                    m_widgets[i-1]->widgetFocused();
-                    return;
-                }
-            }
-        }
+        const std::size_t position = getFocusOrderPosition();
+        if (m_focusOrder.empty())
+            return;
+
+        if ((position == 0) || (position > m_focusOrder.size()))
+            m_focusOrder.back()->focus();
+        else
+            m_focusOrder[position-1]->focus();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -378,10 +410,12 @@ namespace tgui
 
     void Container::uncheckRadioButtons()
     {
+        static const WidgetType radioButtonType{"RadioButton"};
+
         // Loop through all radio buttons and uncheck them
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
-            if (m_widgets[i]->m_callback.widgetType == "RadioButton")
+            if (m_widgets[i]->m_callback.widgetType == radioButtonType)
                 std::static_pointer_cast<RadioButton>(m_widgets[i])->uncheck();
         }
     }
@@ -413,14 +447,11 @@ namespace tgui
 
     void Container::saveWidgetsToFile(const std::string& filename)
     {
-        std::stringstream stream;
-        WidgetSaver::save(std::static_pointer_cast<Container>(shared_from_this()), stream);
-
         std::ofstream out{filename};
         if (!out.is_open())
             throw Exception{"Failed to open '" + filename + "' for saving the widgets to it."};
 
-        out << stream.rdbuf();
+        WidgetSaver::save(std::static_pointer_cast<Container>(shared_from_this()), out);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -432,13 +463,72 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::saveWidgetsToStream(std::stringstream& stream)
+    void Container::saveWidgetsToStream(std::ostream& stream)
     {
         WidgetSaver::save(std::static_pointer_cast<Container>(shared_from_this()), stream);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setPendingWidgets(const std::function<void(Container&)>& loader, const std::vector<sf::String>& widgetNames)
+    {
+        m_pendingWidgetsLoader = loader;
+        m_pendingWidgetNames.clear();
+        m_pendingWidgetNames.insert(widgetNames.begin(), widgetNames.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::show()
+    {
+        loadPendingWidgets();
+        Widget::show();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MemoryUsage Container::getMemoryUsage() const
+    {
+        auto usage = Widget::getMemoryUsage();
+        usage.widget += sizeof(Container) - sizeof(Widget)
+                      + m_widgets.capacity() * sizeof(Widget::Ptr)
+                      + m_focusOrder.capacity() * sizeof(Widget*)
+                      + getHashTableMemoryUsage(m_widgetsByName)
+                      + getHashTableMemoryUsage(m_widgetIndices)
+                      + getHashTableMemoryUsage(m_focusOrderPositions)
+                      + getHashTableMemoryUsage(m_pendingWidgetNames);
+
+        usage.text += priv::getHeapMemoryUsage(m_objName);
+        for (const auto& pair : m_widgetsByName)
+            usage.text += priv::getHeapMemoryUsage(pair.first);
+        for (const auto& name : m_pendingWidgetNames)
+            usage.text += priv::getHeapMemoryUsage(name);
+
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::map<std::string, MemoryUsage> Container::getMemoryUsageByType() const
+    {
+        std::map<std::string, MemoryUsage> usageByType;
+        for (const auto& widget : m_widgets)
+        {
+            usageByType[widget->getWidgetType()] += widget->getMemoryUsage();
+            usageByType[widget->getWidgetType()].widget += priv::SharedPtrOverhead;
+
+            if (widget->m_containerWidget)
+            {
+                for (const auto& pair : std::static_pointer_cast<Container>(widget)->getMemoryUsageByType())
+                    usageByType[pair.first] += pair.second;
+            }
+        }
+
+        return usageByType;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::leftMousePressed(float x, float y)
     {
         sf::Event event;
@@ -595,6 +685,7 @@ namespace tgui
                 m_widgets.erase(m_widgets.begin() + i);
                 m_objName.erase(m_objName.begin() + i);
 
+                updateWidgetIndices(i);
                 break;
             }
         }
@@ -612,7 +703,7 @@ namespace tgui
             {
                 // Copy the widget
                 Widget::Ptr obj = m_widgets[i];
-                std::string name = m_objName[i];
+                sf::String name = m_objName[i];
                 m_widgets.insert(m_widgets.begin(), obj);
                 m_objName.insert(m_objName.begin(), name);
 
@@ -626,6 +717,7 @@ namespace tgui
                 m_widgets.erase(m_widgets.begin() + i + 1);
                 m_objName.erase(m_objName.begin() + i + 1);
 
+                updateWidgetIndices(0);
                 break;
             }
         }
@@ -637,6 +729,9 @@ namespace tgui
     {
         Widget::update(elapsedTime);
 
+        // A visible container can't wait any longer with loading its widgets
+        loadPendingWidgets();
+
         // Loop through all widgets
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
@@ -778,7 +873,7 @@ namespace tgui
         {
             // Change the focus to another widget when the tab key was pressed
             if (event.key.code == sf::Keyboard::Tab)
-                return tabKeyPressed();
+                return tabKeyPressed(event.key.shift);
             else
                 return false;
         }
@@ -820,167 +915,239 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Container::focusNextWidgetInContainer()
+    bool Container::tabKeyPressed(bool shiftPressed)
     {
         // Don't do anything when the tab key usage is disabled
         if (!TGUI_TabKeyUsageEnabled)
             return false;
 
-        // If the focused widget is a container then try to focus the next widget inside it
-        if ((m_focusedWidget > 0) && m_widgets[m_focusedWidget-1]->m_containerWidget && std::static_pointer_cast<Container>(m_widgets[m_focusedWidget-1])->focusNextWidgetInContainer())
-            return true;
+        if (shiftPressed)
+            focusPreviousWidget();
+        else
+            focusNextWidget();
 
-        // Loop through all widgets
-        for (std::size_t i = m_focusedWidget; i < m_widgets.size(); ++i)
+        return !m_focusOrder.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::mouseOnWhichWidget(float x, float y)
+    {
+        Widget::Ptr widget = nullptr;
+        for (std::vector<Widget::Ptr>::reverse_iterator it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
         {
-            // If you are not allowed to focus the widget, then skip it
-            if (m_widgets[i]->m_allowFocus)
+            if ((*it)->isVisible())
             {
-                // Make sure that the widget is visible and enabled
-                if ((m_widgets[i]->m_visible) && (m_widgets[i]->m_enabled))
+                if ((*it)->mouseOnWidget(x, y))
                 {
-                    // Container widgets can only be focused it they contain focusable widgets
-                    if ((!m_widgets[i]->m_containerWidget) || (std::static_pointer_cast<Container>(m_widgets[i])->focusNextWidgetInContainer()))
-                    {
-                        if (m_focusedWidget > 0)
-                        {
-                            // Unfocus the current widget
-                            m_widgets[m_focusedWidget-1]->m_focused = false;
-                            m_widgets[m_focusedWidget-1]->widgetUnfocused();
-                        }
-
-                        // Focus on the new widget
-                        m_focusedWidget = i+1;
-                        m_widgets[i]->m_focused = true;
-                        m_widgets[i]->widgetFocused();
+                    // If the widget is disabled but the mouse is on top of it, nobody gets the event
+                    if ((*it)->isEnabled())
+                        widget = *it;
 
-                        return true;
-                    }
+                    break;
                 }
             }
         }
 
-        // We have the highest id
-        unfocusWidgets();
-        return false;
+        // If the mouse is on a different widget, tell the old widget that the mouse has left
+        if (m_widgetBelowMouse && (widget != m_widgetBelowMouse))
+            m_widgetBelowMouse->mouseNoLongerOnWidget();
+
+        m_widgetBelowMouse = widget;
+        return widget;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Container::tabKeyPressed()
+    void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
-        // Don't do anything when the tab key usage is disabled
-        if (!TGUI_TabKeyUsageEnabled)
-            return false;
+        TGUI_PROFILE_WIDGET_ZONE("Container::drawWidgetContainer", this, "");
 
-        // Check if a container is focused
-        if (m_focusedWidget)
+        // Draw all widgets when they are visible
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
-            if (m_widgets[m_focusedWidget-1]->m_containerWidget)
+            if (m_widgets[i]->m_visible)
             {
-                // Focus the next widget in container
-                if (std::static_pointer_cast<Container>(m_widgets[m_focusedWidget-1])->focusNextWidgetInContainer())
-                    return true;
+                TGUI_PROFILE_WIDGET_ZONE("Widget::draw", m_widgets[i].get(), m_objName[i]);
+                m_widgets[i]->draw(*target, states);
             }
         }
+    }
 
-        // Loop all widgets behind the focused one
-        for (std::size_t i = m_focusedWidget; i < m_widgets.size(); ++i)
-        {
-            // If you are not allowed to focus the widget, then skip it
-            if (m_widgets[i]->m_allowFocus)
-            {
-                // Make sure that the widget is visible and enabled
-                if ((m_widgets[i]->m_visible) && (m_widgets[i]->m_enabled))
-                {
-                    if (m_focusedWidget)
-                    {
-                        // unfocus the current widget
-                        m_widgets[m_focusedWidget-1]->m_focused = false;
-                        m_widgets[m_focusedWidget-1]->widgetUnfocused();
-                    }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    // Focus on the new widget
-                    m_focusedWidget = i+1;
-                    m_widgets[i]->m_focused = true;
-                    m_widgets[i]->widgetFocused();
-                    return true;
-                }
-            }
-        }
+    void Container::updateWidgetIndices(std::size_t startIndex)
+    {
+        for (std::size_t i = startIndex; i < m_widgets.size(); ++i)
+            m_widgetIndices[m_widgets[i].get()] = i;
 
-        // None of the widgets behind the focused one could be focused, so loop the ones before it
-        if (m_focusedWidget)
+        // When a name is shared by multiple widgets, make sure it still refers to the one with the lowest index
+        for (std::size_t i = startIndex; i < m_widgets.size(); ++i)
         {
-            for (std::size_t i = 0; i < m_focusedWidget-1; ++i)
-            {
-                // If you are not allowed to focus the widget, then skip it
-                if (m_widgets[i]->m_allowFocus)
-                {
-                    // Make sure that the widget is visible and enabled
-                    if ((m_widgets[i]->m_visible) && (m_widgets[i]->m_enabled))
-                    {
-                        // unfocus the current widget
-                        m_widgets[m_focusedWidget-1]->m_focused = false;
-                        m_widgets[m_focusedWidget-1]->widgetUnfocused();
+            auto& entry = m_widgetsByName.at(m_objName[i]);
+            if (entry.widget == m_widgets[i].get())
+                continue;
 
-                        // Focus on the new widget
-                        m_focusedWidget = i+1;
-                        m_widgets[i]->m_focused = true;
-                        m_widgets[i]->widgetFocused();
-                        return true;
-                    }
-                }
-            }
+            auto it = m_widgetIndices.find(entry.widget);
+            if ((it == m_widgetIndices.end()) || (it->second > i))
+                entry.widget = m_widgets[i].get();
         }
 
-        // If the currently focused container widget is the only widget to focus, then focus its next child widget
-        if ((m_focusedWidget) && (m_widgets[m_focusedWidget-1]->m_containerWidget))
+        m_widgetNamesVersion++;
+        invalidateFocusOrder();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::postponeUpdate()
+    {
+        if (m_updateDepth == 0)
+            return false;
+
+        m_updatePostponed = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addToNameIndex(std::size_t index)
+    {
+        auto it = m_widgetsByName.find(m_objName[index]);
+        if (it == m_widgetsByName.end())
+        {
+            m_widgetsByName[m_objName[index]] = {m_widgets[index].get(), 1};
+        }
+        else
         {
-            std::static_pointer_cast<Container>(m_widgets[m_focusedWidget-1])->tabKeyPressed();
-            return true;
+            it->second.count++;
+            if (m_widgetIndices.at(it->second.widget) > index)
+                it->second.widget = m_widgets[index].get();
         }
 
-        return false;
+        m_widgetNamesVersion++;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Widget::Ptr Container::mouseOnWhichWidget(float x, float y)
+    void Container::removeFromNameIndex(const sf::String& name, const Widget* widget)
     {
-        Widget::Ptr widget = nullptr;
-        for (std::vector<Widget::Ptr>::reverse_iterator it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+        auto it = m_widgetsByName.find(name);
+        assert(it != m_widgetsByName.end());
+
+        if (--it->second.count == 0)
         {
-            if ((*it)->isVisible())
+            m_widgetsByName.erase(it);
+        }
+        else if (it->second.widget == widget)
+        {
+            // Another widget has the same name, so the name now has to refer to that widget
+            for (std::size_t i = 0; i < m_widgets.size(); ++i)
             {
-                if ((*it)->mouseOnWidget(x, y))
+                if ((m_objName[i] == name) && (m_widgets[i].get() != widget))
                 {
-                    // If the widget is disabled but the mouse is on top of it, nobody gets the event
-                    if ((*it)->isEnabled())
-                        widget = *it;
-
+                    it->second.widget = m_widgets[i].get();
                     break;
                 }
             }
         }
 
-        // If the mouse is on a different widget, tell the old widget that the mouse has left
-        if (m_widgetBelowMouse && (widget != m_widgetBelowMouse))
-            m_widgetBelowMouse->mouseNoLongerOnWidget();
+        m_widgetNamesVersion++;
+    }
 
-        m_widgetBelowMouse = widget;
-        return widget;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadPendingWidgetsImpl()
+    {
+        // The loader is removed first, so that the widgets are loaded only once even when the loader itself needs them
+        auto loader = std::move(m_pendingWidgetsLoader);
+        m_pendingWidgetsLoader = nullptr;
+        m_pendingWidgetNames.clear();
+
+        loader(*this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
+    void Container::invalidateAbsolutePosition()
     {
-        // Draw all widgets when they are visible
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        // When our position was already outdated then the positions of our children are outdated as well,
+        // because they can't be recalculated without recalculating ours first.
+        if (!m_absolutePositionValid)
+            return;
+
+        Widget::invalidateAbsolutePosition();
+        for (auto& widget : m_widgets)
+            widget->invalidateAbsolutePosition();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidateFocusOrder()
+    {
+        // The focus order of the parents contains our widgets as well, so it also has to be recalculated
+        for (Container* container = this; container != nullptr; container = container->m_parent)
+            container->m_focusOrderValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Container::getFocusOrderPosition()
+    {
+        if (!m_focusOrderValid)
         {
-            if (m_widgets[i]->m_visible)
-                m_widgets[i]->draw(*target, states);
+            m_focusOrder.clear();
+            m_focusOrderPositions.clear();
+            buildFocusOrder(*this);
+            m_focusOrderValid = true;
+        }
+
+        // Find the deepest widget that is focused
+        const Container* container = this;
+        const Widget* focusedWidget = nullptr;
+        while (container->m_focusedWidget)
+        {
+            focusedWidget = container->m_widgets[container->m_focusedWidget-1].get();
+            if (!focusedWidget->m_containerWidget)
+                break;
+
+            container = static_cast<const Container*>(focusedWidget);
+        }
+
+        if (!focusedWidget)
+            return m_focusOrder.size();
+
+        auto it = m_focusOrderPositions.find(focusedWidget);
+        if (it != m_focusOrderPositions.end())
+            return it->second;
+        else
+            return m_focusOrder.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::buildFocusOrder(const Container& container)
+    {
+        // Widgets with a lower tab index come first, the order in which the widgets were added is kept for equal tab indices
+        std::vector<Widget*> widgets;
+        widgets.reserve(container.m_widgets.size());
+        for (auto& widget : container.m_widgets)
+            widgets.push_back(widget.get());
+
+        std::stable_sort(widgets.begin(), widgets.end(), [](const Widget* left, const Widget* right){ return left->m_tabIndex < right->m_tabIndex; });
+
+        for (auto& widget : widgets)
+        {
+            // Every widget gets the position of the first widget that can be focused at or behind it
+            m_focusOrderPositions[widget] = m_focusOrder.size();
+
+            if (!widget->m_allowFocus || !widget->m_visible || !widget->m_enabled)
+                continue;
+
+            // The widgets inside a container are focused instead of the container itself
+            if (widget->m_containerWidget)
+                buildFocusOrder(*static_cast<const Container*>(widget));
+            else
+                m_focusOrder.push_back(widget);
         }
     }
 
@@ -26,6 +26,7 @@
 #include <TGUI/Widgets/ToolTip.hpp>
 #include <TGUI/Gui.hpp>
 #include <TGUI/DefaultFont.hpp>
+#include <TGUI/Profiler.hpp>
 
 #include <SFML/OpenGL.hpp>
 
@@ -118,6 +119,7 @@ namespace tgui
 
             m_container->m_size = view.getSize();
             m_container->m_position = view.getCenter() - (view.getSize() / 2.0f);
+            m_container->invalidateAbsolutePosition();
 
             m_container->m_callback.position = m_container->getPosition();
             m_container->sendSignal("PositionChanged", m_container->getPosition());
@@ -133,6 +135,7 @@ namespace tgui
 
     bool Gui::handleEvent(sf::Event event)
     {
+        TGUI_PROFILE_ZONE("Gui::handleEvent");
         assert(m_window != nullptr);
 
         // Check if the event has something to do with the mouse
@@ -209,6 +212,7 @@ namespace tgui
 
     void Gui::draw()
     {
+        TGUI_PROFILE_ZONE("Gui::draw");
         assert(m_window != nullptr);
 
         // Make sure the right opengl context is set when clipping
@@ -221,7 +225,12 @@ namespace tgui
         if (m_container->m_focused)
             updateTime(m_clock.restart());
         else
+        {
+            // Changes made by other threads and bound values still have to be shown while the window is in the background
             m_clock.restart();
+            m_commandQueue.execute();
+            m_bindings.apply();
+        }
 
         // Check if clipping is enabled
         GLboolean clippingEnabled = glIsEnabled(GL_SCISSOR_TEST);
@@ -276,7 +285,39 @@ namespace tgui
 
     Widget::Ptr Gui::get(const sf::String& widgetName, bool recursive) const
     {
-        return m_container->get(widgetName, recursive);
+        if (!m_nameCacheEnabled || !recursive)
+            return m_container->get(widgetName, recursive);
+
+        // Forget everything that was cached when widgets were added, removed or renamed since the last lookup
+        if (m_nameCacheVersion != Container::getWidgetNamesVersion())
+        {
+            m_nameCache.clear();
+            m_nameCacheVersion = Container::getWidgetNamesVersion();
+        }
+
+        // Widgets inside the gui can't be destroyed without being removed, so an expired pointer means the name wasn't found
+        auto it = m_nameCache.find(widgetName);
+        if (it != m_nameCache.end())
+            return it->second.lock();
+
+        Widget::Ptr widget = m_container->get(widgetName, true);
+        m_nameCache[widgetName] = widget;
+        return widget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Gui::getByPath(const sf::String& path) const
+    {
+        return m_container->getByPath(path);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setNameCacheEnabled(bool enabled)
+    {
+        m_nameCacheEnabled = enabled;
+        m_nameCache.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -358,6 +399,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::map<std::string, MemoryUsage> Gui::getMemoryUsageByType() const
+    {
+        return m_container->getMemoryUsageByType();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MemoryUsage Gui::getMemoryUsage() const
+    {
+        MemoryUsage usage = m_container->getMemoryUsage();
+        for (const auto& pair : m_container->getMemoryUsageByType())
+            usage += pair.second;
+
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::loadWidgetsFromFile(const std::string& filename)
     {
         m_container->loadWidgetsFromFile(filename);
@@ -379,15 +438,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Gui::saveWidgetsToStream(std::stringstream& stream)
+    void Gui::saveWidgetsToStream(std::ostream& stream)
     {
         m_container->saveWidgetsToStream(stream);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::watchTheme(const std::shared_ptr<Theme>& theme)
+    {
+        m_themeWatcher.watch(theme);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::unwatchTheme(const std::shared_ptr<Theme>& theme)
+    {
+        m_themeWatcher.unwatch(theme);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
+        TGUI_PROFILE_ZONE("Gui::updateTime");
+
+        m_commandQueue.execute();
+        m_bindings.apply();
+
+        if (m_themeWatcher.isWatching())
+            m_themeWatcher.poll();
+
         m_container->m_animationTimeElapsed = elapsedTime;
         m_container->update(elapsedTime);
 
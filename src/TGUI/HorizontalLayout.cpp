@@ -26,6 +26,9 @@ namespace tgui
 
     void HorizontalLayout::updateWidgetPositions()
     {
+        if (postponeUpdate())
+            return;
+
         float sumRatio = 0;
         for (std::size_t i = 0; i < m_widgetsRatio.size(); ++i)
         {
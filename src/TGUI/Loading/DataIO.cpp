@@ -26,6 +26,7 @@
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Global.hpp>
 
+#include <cassert>
 #include <cctype>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -118,61 +119,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void DataIO::emit(std::shared_ptr<Node> rootNode, std::stringstream& stream)
+    void DataIO::emit(std::shared_ptr<Node> rootNode, std::ostream& stream)
     {
-        for (auto& pair : rootNode->propertyValuePairs)
-            stream << pair.first << ": " << pair.second->value << ";" << std::endl;
-
-        if (rootNode->propertyValuePairs.size() > 0 && rootNode->children.size() > 0)
-            stream << std::endl;
-
-        std::vector<std::string> output;
-        for (std::size_t i = 0; i < rootNode->children.size(); ++i)
-        {
-            for (auto& line : convertNodesToLines(rootNode->children[i]))
-                output.emplace_back(std::move(line));
-
-            if (i < rootNode->children.size()-1)
-                output.emplace_back("");
-        }
+        Emitter emitter{stream};
 
-        for (auto& line : output)
-            stream << line << std::endl;
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    std::vector<std::string> DataIO::convertNodesToLines(std::shared_ptr<Node> node)
-    {
-        std::vector<std::string> output;
-        if (node->name.empty())
-            output.emplace_back("{");
-        else
-            output.emplace_back(node->name + " {");
-
-        if (node->propertyValuePairs.size())
-        {
-            for (auto& pair : node->propertyValuePairs)
-                output.emplace_back("    " + pair.first + ": " + pair.second->value + ";");
-        }
-
-        if (node->propertyValuePairs.size() > 0 && node->children.size() > 0)
-            output.emplace_back("");
-
-        if (node->children.size())
-        {
-            for (std::size_t i = 0; i < node->children.size(); ++i)
-            {
-                for (auto& line : convertNodesToLines(node->children[i]))
-                    output.emplace_back("    " + line);
-
-                if (i < node->children.size() - 1)
-                    output.emplace_back("");
-            }
-        }
+        for (auto& pair : rootNode->propertyValuePairs)
+            emitter.setProperty(pair.first, pair.second->value);
 
-        output.emplace_back("}");
-        return output;
+        for (auto& child : rootNode->children)
+            emitter.emitNode(*child);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -542,6 +497,136 @@ namespace tgui
         return "";
     }
 
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DataIO::Emitter::Emitter(std::ostream& stream) :
+        m_stream  {&stream},
+        m_sections(1)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DataIO::Emitter::Emitter(Node& node) :
+        m_node    {&node},
+        m_sections(1)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DataIO::Emitter::~Emitter()
+    {
+        if (m_stream)
+            flushProperties();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::Emitter::beginSection(const std::string& name)
+    {
+        if (m_node)
+        {
+            auto node = std::make_shared<Node>();
+            node->parent = m_node;
+            node->name = name;
+            m_node->children.push_back(node);
+            m_node = node.get();
+            return;
+        }
+
+        flushProperties();
+
+        // Sections are separated from each other and from the properties in front of them by an empty line.
+        // These empty lines are indented like the lines of the parent section.
+        if (!m_sections.back().empty)
+        {
+            if (m_sections.size() > 1)
+                *m_stream << std::string((m_sections.size() - 2) * 4, ' ');
+
+            *m_stream << '\n';
+        }
+
+        m_sections.back().empty = false;
+
+        const std::string indentation((m_sections.size() - 1) * 4, ' ');
+        if (name.empty())
+            *m_stream << indentation << "{\n";
+        else
+            *m_stream << indentation << name << " {\n";
+
+        m_sections.emplace_back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::Emitter::endSection()
+    {
+        if (m_node)
+        {
+            m_node = m_node->parent;
+            return;
+        }
+
+        assert(m_sections.size() > 1);
+
+        flushProperties();
+        m_sections.pop_back();
+
+        *m_stream << std::string((m_sections.size() - 1) * 4, ' ') << "}\n";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::Emitter::setProperty(const std::string& property, const std::string& value)
+    {
+        if (m_node)
+        {
+            m_node->propertyValuePairs[property] = std::make_shared<ValueNode>(m_node, value);
+            return;
+        }
+
+        // Properties that are set after a child section was written can no longer be sorted with the other properties
+        auto& section = m_sections.back();
+        if (section.propertiesWritten)
+            *m_stream << std::string((m_sections.size() - 1) * 4, ' ') << property << ": " << value << ";\n";
+        else
+            section.properties[property] = value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::Emitter::emitNode(const Node& node)
+    {
+        beginSection(node.name);
+
+        for (auto& pair : node.propertyValuePairs)
+            setProperty(pair.first, pair.second->value);
+
+        for (auto& child : node.children)
+            emitNode(*child);
+
+        endSection();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::Emitter::flushProperties()
+    {
+        auto& section = m_sections.back();
+        if (section.propertiesWritten)
+            return;
+
+        const std::string indentation((m_sections.size() - 1) * 4, ' ');
+        for (auto& pair : section.properties)
+            *m_stream << indentation << pair.first << ": " << pair.second << ";\n";
+
+        section.empty = section.properties.empty();
+        section.propertiesWritten = true;
+        section.properties.clear();
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
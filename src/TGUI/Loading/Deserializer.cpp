@@ -25,6 +25,8 @@
 
 #include <TGUI/Loading/Deserializer.hpp>
 #include <cassert>
+#include <list>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -54,6 +56,59 @@ namespace
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // Values that were already deserialized, the most recently used ones are at the front of the list
+    struct DeserializeCache
+    {
+        struct Key
+        {
+            tgui::ObjectConverter::Type type;
+            std::string resourcePath;
+            std::string serializedString;
+
+            bool operator==(const Key& other) const
+            {
+                return (type == other.type) && (serializedString == other.serializedString) && (resourcePath == other.resourcePath);
+            }
+        };
+
+        struct KeyHash
+        {
+            std::size_t operator()(const Key& key) const
+            {
+                std::size_t seed = std::hash<std::string>()(key.serializedString);
+                seed ^= std::hash<std::string>()(key.resourcePath) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+                seed ^= static_cast<std::size_t>(key.type) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+                return seed;
+            }
+        };
+
+        using Entry = std::pair<Key, tgui::ObjectConverter>;
+
+        bool enabled = false;
+        std::size_t capacity = 1024;
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        std::list<Entry> entries;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+
+        void removeOldestEntries(std::size_t maxSize)
+        {
+            while (entries.size() > maxSize)
+            {
+                index.erase(entries.back().first);
+                entries.pop_back();
+            }
+        }
+    };
+
+    DeserializeCache& getCache()
+    {
+        static DeserializeCache cache;
+        return cache;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool readIntRect(std::string value, sf::IntRect& rect)
     {
         if (!value.empty() && (value[0] == '(') && (value[value.length()-1] == ')'))
@@ -351,7 +406,34 @@ namespace tgui
     ObjectConverter Deserializer::deserialize(ObjectConverter::Type type, const std::string& serializedString)
     {
         assert(m_deserializers.find(type) != m_deserializers.end());
-        return m_deserializers[type](serializedString);
+
+        auto& cache = getCache();
+        if (!cache.enabled)
+            return m_deserializers[type](serializedString);
+
+        // Fonts and textures are loaded relative to the resource path, so the same string may refer to a different file
+        DeserializeCache::Key key{type, "", serializedString};
+        if ((type == ObjectConverter::Type::Font) || (type == ObjectConverter::Type::Texture))
+            key.resourcePath = getResourcePath();
+
+        auto it = cache.index.find(key);
+        if (it != cache.index.end())
+        {
+            cache.hits++;
+            cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+            return it->second->second;
+        }
+
+        cache.misses++;
+        ObjectConverter value = m_deserializers[type](serializedString);
+        if (cache.capacity > 0)
+        {
+            cache.entries.emplace_front(key, value);
+            cache.index[std::move(key)] = cache.entries.begin();
+            cache.removeOldestEntries(cache.capacity);
+        }
+
+        return value;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -359,6 +441,19 @@ namespace tgui
     void Deserializer::setFunction(ObjectConverter::Type type, const DeserializeFunc& deserializer)
     {
         m_deserializers[type] = deserializer;
+
+        // Values that were created by the old function may no longer be correct
+        auto& cache = getCache();
+        for (auto it = cache.entries.begin(); it != cache.entries.end();)
+        {
+            if (it->first.type == type)
+            {
+                cache.index.erase(it->first);
+                it = cache.entries.erase(it);
+            }
+            else
+                ++it;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -369,6 +464,63 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Deserializer::setCacheEnabled(bool enabled)
+    {
+        auto& cache = getCache();
+        cache.enabled = enabled;
+        if (!enabled)
+            cache.removeOldestEntries(0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Deserializer::isCacheEnabled()
+    {
+        return getCache().enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Deserializer::setCacheCapacity(std::size_t capacity)
+    {
+        auto& cache = getCache();
+        cache.capacity = capacity;
+        cache.removeOldestEntries(capacity);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Deserializer::getCacheCapacity()
+    {
+        return getCache().capacity;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Deserializer::clearCache()
+    {
+        auto& cache = getCache();
+        cache.removeOldestEntries(0);
+        cache.hits = 0;
+        cache.misses = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Deserializer::getCacheHits()
+    {
+        return getCache().hits;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Deserializer::getCacheMisses()
+    {
+        return getCache().misses;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/Profiler.hpp>
 #include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Widgets/ChatBox.hpp>
 #include <TGUI/Widgets/CheckBox.hpp>
@@ -51,27 +52,27 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::map<std::string, std::function<Widget::Ptr()>> BaseTheme::m_constructors =
+    std::map<WidgetType, std::function<Widget::Ptr()>> BaseTheme::m_constructors =
         {
-            {"button", std::make_shared<Button>},
-            {"chatbox", std::make_shared<ChatBox>},
-            {"checkbox", std::make_shared<CheckBox>},
-            {"childwindow", std::make_shared<ChildWindow>},
-            {"combobox", std::make_shared<ComboBox>},
-            {"editbox", std::make_shared<EditBox>},
-            {"knob", std::make_shared<Knob>},
-            {"label", std::make_shared<Label>},
-            {"listbox", std::make_shared<ListBox>},
-            {"menubar", std::make_shared<MenuBar>},
-            {"messagebox", std::make_shared<MessageBox>},
-            {"panel", std::make_shared<Panel>},
-            {"progressbar", std::make_shared<ProgressBar>},
-            {"radiobutton", std::make_shared<RadioButton>},
-            {"scrollbar", std::make_shared<Scrollbar>},
-            {"slider", std::make_shared<Slider>},
-            {"spinbutton", std::make_shared<SpinButton>},
-            {"tab", std::make_shared<Tab>},
-            {"textbox", std::make_shared<TextBox>}
+            {"Button", std::make_shared<Button>},
+            {"ChatBox", std::make_shared<ChatBox>},
+            {"CheckBox", std::make_shared<CheckBox>},
+            {"ChildWindow", std::make_shared<ChildWindow>},
+            {"ComboBox", std::make_shared<ComboBox>},
+            {"EditBox", std::make_shared<EditBox>},
+            {"Knob", std::make_shared<Knob>},
+            {"Label", std::make_shared<Label>},
+            {"ListBox", std::make_shared<ListBox>},
+            {"MenuBar", std::make_shared<MenuBar>},
+            {"MessageBox", std::make_shared<MessageBox>},
+            {"Panel", std::make_shared<Panel>},
+            {"ProgressBar", std::make_shared<ProgressBar>},
+            {"RadioButton", std::make_shared<RadioButton>},
+            {"Scrollbar", std::make_shared<Scrollbar>},
+            {"Slider", std::make_shared<Slider>},
+            {"SpinButton", std::make_shared<SpinButton>},
+            {"Tab", std::make_shared<Tab>},
+            {"TextBox", std::make_shared<TextBox>}
         };
 
     std::shared_ptr<BaseThemeLoader> BaseTheme::m_themeLoader = std::make_shared<DefaultThemeLoader>();
@@ -93,7 +94,12 @@ namespace tgui
 
     void BaseTheme::setConstructFunction(const std::string& type, const std::function<Widget::Ptr()>& constructor)
     {
-        m_constructors[toLower(type)] = constructor;
+        // Theme files don't care about case, so replace the constructor of an existing type when only the case differs
+        WidgetType widgetType = WidgetType::findByLowercaseName(toLower(type));
+        if (widgetType.getId() == 0)
+            widgetType = WidgetType{type};
+
+        m_constructors[widgetType] = constructor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -127,24 +133,29 @@ namespace tgui
     {
         className = toLower(className);
 
-        std::string widgetType;
-        if (m_filename != "")
-        {
-            if (m_widgetTypes.find(className) != m_widgetTypes.end())
-                widgetType = m_widgetTypes[className];
-            else
-                widgetType = toLower(m_themeLoader->load(m_filename, className, m_widgetProperties[className]));
-        }
-        else // Load the white theme
+        // The type is only looked up by name the first time a class is loaded
+        WidgetType widgetType;
+        const auto typeIt = m_widgetTypes.find(className);
+        if (typeIt != m_widgetTypes.end())
+            widgetType = typeIt->second;
+        else
         {
-            widgetType = className;
+            std::string typeName;
+            if (m_filename != "")
+                typeName = toLower(m_themeLoader->load(m_filename, className, m_widgetProperties[className]));
+            else // Load the white theme
+                typeName = className;
+
+            widgetType = WidgetType::findByLowercaseName(typeName);
+            if (widgetType.getId() == 0)
+                throw Exception{"Failed to load widget of type '" + typeName + "'. No constructor function was set for that type."};
         }
 
-        auto constructor = m_constructors[widgetType];
-        if (constructor)
+        const auto constructorIt = m_constructors.find(widgetType);
+        if ((constructorIt != m_constructors.end()) && constructorIt->second)
         {
-            Widget::Ptr widget = constructor();
-            m_widgets[widget.get()] = className;
+            Widget::Ptr widget = constructorIt->second();
+            setWidgetClassName(widget.get(), className);
             m_widgetTypes[className] = widgetType;
 
             widgetAttached(widget.get());
@@ -153,7 +164,7 @@ namespace tgui
             return WidgetConverter{widget};
         }
         else
-            throw Exception{"Failed to load widget of type '" + widgetType + "'. No constructor function was set for that type."};
+            throw Exception{"Failed to load widget of type '" + widgetType.getLowercaseName() + "'. No constructor function was set for that type."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -172,7 +183,7 @@ namespace tgui
 
         for (auto& widget : m_widgets)
         {
-            std::string widgetType;
+            WidgetType widgetType;
             if (m_filename != "")
             {
                 if (m_widgetTypes.find(widget.second) != m_widgetTypes.end())
@@ -180,11 +191,11 @@ namespace tgui
                 else
                 {
                     m_widgetProperties[widget.second].clear();
-                    widgetType = toLower(m_themeLoader->load(m_filename, widget.second, m_widgetProperties[widget.second]));
+                    widgetType = WidgetType::findByLowercaseName(toLower(m_themeLoader->load(m_filename, widget.second, m_widgetProperties[widget.second])));
                 }
             }
             else
-                widgetType = widget.second;
+                widgetType = WidgetType::findByLowercaseName(widget.second);
 
             m_widgetTypes[widget.second] = widgetType;
             widgetReload(widget.first, filename, widget.second, false);
@@ -209,13 +220,16 @@ namespace tgui
         }
 
         // Reload all the widget that match the old class name
-        for (auto& widget : m_widgets)
+        auto classIt = m_classWidgets.find(oldClassName);
+        if (classIt == m_classWidgets.end())
+            return;
+
+        // The widgets are copied because they are removed from the old class while looping over them
+        const std::set<Widget*> widgets = classIt->second;
+        for (auto& widget : widgets)
         {
-            if (widget.second == oldClassName)
-            {
-                widget.second = newClassName;
-                widgetReload(widget.first, m_filename, newClassName, false);
-            }
+            setWidgetClassName(widget, newClassName);
+            widgetReload(widget, m_filename, newClassName, false);
         }
     }
 
@@ -226,7 +240,7 @@ namespace tgui
         className = toLower(className);
 
         // If we don't have the class name in the cache then check if the theme loader has it
-        std::string widgetType;
+        WidgetType widgetType;
         if (m_filename != "")
         {
             if (m_widgetTypes.find(className) != m_widgetTypes.end())
@@ -234,21 +248,94 @@ namespace tgui
             else
             {
                 m_widgetProperties[className].clear();
-                widgetType = toLower(m_themeLoader->load(m_filename, className, m_widgetProperties[className]));
+                widgetType = WidgetType::findByLowercaseName(toLower(m_themeLoader->load(m_filename, className, m_widgetProperties[className])));
             }
         }
         else // Load the white theme
         {
-            widgetType = className;
-            if (!m_constructors[widgetType])
-                throw Exception{"Failed to reload widget of type '" + widgetType + "'. No constructor function was set for that type."};
+            widgetType = WidgetType::findByLowercaseName(className);
+
+            const auto constructorIt = m_constructors.find(widgetType);
+            if ((constructorIt == m_constructors.end()) || !constructorIt->second)
+                throw Exception{"Failed to reload widget of type '" + className + "'. No constructor function was set for that type."};
         }
 
         widgetAttached(widget.get());
         widgetReload(widget.get(), m_filename, className, false);
 
         m_widgetTypes[className] = widgetType;
-        m_widgets[widget.get()] = className;
+        setWidgetClassName(widget.get(), className);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Theme::reloadChangedProperties()
+    {
+        if (m_filename.empty())
+            return false;
+
+        DefaultThemeLoader::flushCache(m_filename);
+
+        // Load all classes before changing anything, so that the theme remains untouched when the file contains errors
+        std::map<std::string, std::map<std::string, std::string>> newWidgetProperties;
+        std::map<std::string, WidgetType> newWidgetTypes;
+        for (auto& pair : m_widgetProperties)
+            newWidgetTypes[pair.first] = WidgetType::findByLowercaseName(toLower(m_themeLoader->load(m_filename, pair.first, newWidgetProperties[pair.first])));
+
+        bool changed = false;
+        for (auto& pair : newWidgetProperties)
+        {
+            const std::string& className = pair.first;
+            auto& oldProperties = m_widgetProperties[className];
+            auto& newProperties = pair.second;
+
+            // A property that was removed can't be reset on its own, the widgets will have to be reloaded completely
+            bool propertyRemoved = false;
+            for (auto& property : oldProperties)
+            {
+                if (newProperties.find(property.first) == newProperties.end())
+                {
+                    propertyRemoved = true;
+                    break;
+                }
+            }
+
+            std::map<std::string, std::string> changedProperties;
+            for (auto& property : newProperties)
+            {
+                auto it = oldProperties.find(property.first);
+                if ((it == oldProperties.end()) || (it->second != property.second))
+                    changedProperties.insert(property);
+            }
+
+            if (!propertyRemoved && changedProperties.empty())
+                continue;
+
+            changed = true;
+            oldProperties = std::move(newProperties);
+            m_widgetTypes[className] = newWidgetTypes[className];
+
+            auto classIt = m_classWidgets.find(className);
+            if (classIt == m_classWidgets.end())
+                continue;
+
+            for (auto& widget : classIt->second)
+            {
+                if (propertyRemoved)
+                    widgetReload(widget, m_filename, className, false);
+                else
+                    applyProperties(widget, changedProperties);
+            }
+        }
+
+        return changed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& Theme::getFilename() const
+    {
+        return m_filename;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -257,6 +344,7 @@ namespace tgui
     {
         auto theme = std::make_shared<Theme>(*this);
         theme->m_widgets.clear();
+        theme->m_classWidgets.clear();
         return theme;
     }
 
@@ -266,7 +354,17 @@ namespace tgui
     {
         auto it = m_widgets.find(widget);
         if (it != m_widgets.end())
+        {
+            auto classIt = m_classWidgets.find(it->second);
+            if (classIt != m_classWidgets.end())
+            {
+                classIt->second.erase(widget);
+                if (classIt->second.empty())
+                    m_classWidgets.erase(classIt);
+            }
+
             m_widgets.erase(it);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -286,10 +384,12 @@ namespace tgui
         className = toLower(className);
         m_widgetProperties[className][toLower(property)] = value;
 
-        for (auto& pair : m_widgets)
+        // Only the widgets of this class have to be updated, and they only need to know about the changed property
+        auto classIt = m_classWidgets.find(className);
+        if (classIt != m_classWidgets.end())
         {
-            if (pair.second == className)
-                pair.first->getRenderer()->setProperty(property, value);
+            for (auto& widget : classIt->second)
+                widget->getRenderer()->setProperty(property, value);
         }
     }
 
@@ -298,12 +398,15 @@ namespace tgui
     void Theme::setProperty(std::string className, const std::string& property, ObjectConverter&& value)
     {
         className = toLower(className);
-        m_widgetProperties[className][toLower(property)] = Serializer::serialize(std::move(value));
+        m_widgetProperties[className][toLower(property)] = Serializer::serialize(ObjectConverter{value});
 
-        for (auto& pair : m_widgets)
+        // Only the widgets of this class have to be updated, and they only need to know about the changed property.
+        // Every widget gets its own copy of the value, as the renderer is allowed to move from it.
+        auto classIt = m_classWidgets.find(className);
+        if (classIt != m_classWidgets.end())
         {
-            if (pair.second == className)
-                pair.first->getRenderer()->setProperty(property, std::move(value));
+            for (auto& widget : classIt->second)
+                widget->getRenderer()->setProperty(property, ObjectConverter{value});
         }
     }
 
@@ -337,9 +440,18 @@ namespace tgui
 
     void Theme::initWidget(Widget* widget, std::string filename, std::string className)
     {
+        TGUI_PROFILE_WIDGET_ZONE("Theme::initWidget", widget, className);
+
         if (filename != m_filename)
             throw Exception{"Theme tried to init widget which gave a wrong filename"};
 
+        applyProperties(widget, m_widgetProperties[className]);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Theme::applyProperties(Widget* widget, const std::map<std::string, std::string>& properties)
+    {
         // Temporarily change the resource path to load relative from the theme file
         std::string oldResourcePath = getResourcePath();
 
@@ -353,7 +465,7 @@ namespace tgui
 
         try
         {
-            for (auto& property : m_widgetProperties[className])
+            for (auto& property : properties)
                 widget->getRenderer()->setProperty(property.first, property.second);
         }
         catch (Exception& e)
@@ -376,6 +488,32 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Theme::setWidgetClassName(Widget* widget, const std::string& className)
+    {
+        auto it = m_widgets.find(widget);
+        if (it != m_widgets.end())
+        {
+            if (it->second == className)
+                return;
+
+            auto classIt = m_classWidgets.find(it->second);
+            if (classIt != m_classWidgets.end())
+            {
+                classIt->second.erase(widget);
+                if (classIt->second.empty())
+                    m_classWidgets.erase(classIt);
+            }
+
+            it->second = className;
+        }
+        else
+            m_widgets[widget] = className;
+
+        m_classWidgets[className].insert(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
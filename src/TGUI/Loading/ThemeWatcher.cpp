@@ -0,0 +1,284 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <SFML/Config.hpp>
+#include <TGUI/Loading/ThemeWatcher.hpp>
+
+#include <sys/stat.h>
+
+#ifdef SFML_SYSTEM_LINUX
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Returns the directory of the file, which is what inotify watches so that files that are replaced are also noticed
+    std::string getDirectory(const std::string& filename)
+    {
+        auto slashPos = filename.find_last_of("/\\");
+        if (slashPos == std::string::npos)
+            return ".";
+        else if (slashPos == 0)
+            return "/";
+        else
+            return filename.substr(0, slashPos);
+    }
+
+    std::string getFileName(const std::string& filename)
+    {
+        auto slashPos = filename.find_last_of("/\\");
+        if (slashPos == std::string::npos)
+            return filename;
+        else
+            return filename.substr(slashPos + 1);
+    }
+
+    // Returns the modification time and size of the file. The size is included because the modification time
+    // only has a resolution of one second on some systems.
+    std::pair<long long, long long> getFileStamp(const std::string& filename)
+    {
+        struct stat fileInfo;
+        if (stat(filename.c_str(), &fileInfo) != 0)
+            return {0, 0};
+
+        return {static_cast<long long>(fileInfo.st_mtime), static_cast<long long>(fileInfo.st_size)};
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ThemeWatcher::ThemeWatcher()
+    {
+    #ifdef SFML_SYSTEM_LINUX
+        // When inotify is unavailable, the modification times of the files will be compared instead
+        m_inotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    #endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ThemeWatcher::~ThemeWatcher()
+    {
+    #ifdef SFML_SYSTEM_LINUX
+        if (m_inotifyDescriptor >= 0)
+            close(m_inotifyDescriptor);
+    #endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThemeWatcher::watch(const std::shared_ptr<Theme>& theme)
+    {
+        for (auto& watchedTheme : m_themes)
+        {
+            if (watchedTheme.theme.lock() == theme)
+                return;
+        }
+
+        WatchedTheme watchedTheme;
+        watchedTheme.theme = theme;
+        watchedTheme.filename = theme->getFilename();
+        m_themes.push_back(watchedTheme);
+
+        addWatch(m_themes.size() - 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThemeWatcher::unwatch(const std::shared_ptr<Theme>& theme)
+    {
+        for (std::size_t i = 0; i < m_themes.size(); ++i)
+        {
+            if (m_themes[i].theme.lock() == theme)
+            {
+                removeWatch(i);
+                m_themes.erase(m_themes.begin() + i);
+                return;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ThemeWatcher::poll()
+    {
+        // Forget about themes that no longer exist and follow themes that were reloaded with a different file
+        for (std::size_t i = m_themes.size(); i > 0; --i)
+        {
+            auto theme = m_themes[i-1].theme.lock();
+            if (!theme)
+            {
+                removeWatch(i-1);
+                m_themes.erase(m_themes.begin() + i - 1);
+            }
+            else if (theme->getFilename() != m_themes[i-1].filename)
+            {
+                removeWatch(i-1);
+                m_themes[i-1].filename = theme->getFilename();
+                addWatch(i-1);
+            }
+        }
+
+        checkForChanges();
+
+        sf::Clock clock;
+        std::size_t reloadedThemes = 0;
+        for (auto& watchedTheme : m_themes)
+        {
+            if (!watchedTheme.modified)
+                continue;
+
+            watchedTheme.modified = false;
+
+            auto theme = watchedTheme.theme.lock();
+            try
+            {
+                theme->reloadChangedProperties();
+                reloadedThemes++;
+            }
+            catch (const Exception& e)
+            {
+                sf::err() << "TGUI Warning: failed to reload theme file '" << watchedTheme.filename << "'. " << e.what() << std::endl;
+            }
+        }
+
+        if (reloadedThemes > 0)
+        {
+            m_lastReloadDuration = clock.getElapsedTime();
+            m_reloadCount += reloadedThemes;
+        }
+
+        return reloadedThemes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThemeWatcher::addWatch(std::size_t index)
+    {
+        auto& watchedTheme = m_themes[index];
+        if (watchedTheme.filename.empty())
+            return;
+
+        watchedTheme.fileStamp = getFileStamp(watchedTheme.filename);
+
+    #ifdef SFML_SYSTEM_LINUX
+        if (m_inotifyDescriptor >= 0)
+        {
+            // Editors often write to a new file and rename it, so the directory is watched instead of the file itself
+            watchedTheme.watchDescriptor = inotify_add_watch(m_inotifyDescriptor, getDirectory(watchedTheme.filename).c_str(),
+                                                             IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+
+            if (watchedTheme.watchDescriptor < 0)
+            {
+                sf::err() << "TGUI Warning: failed to watch the directory of theme file '" << watchedTheme.filename
+                          << "', the modification time of the file will be checked instead." << std::endl;
+            }
+        }
+    #endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThemeWatcher::removeWatch(std::size_t index)
+    {
+        auto& watchedTheme = m_themes[index];
+        if (watchedTheme.watchDescriptor < 0)
+            return;
+
+        // Watching the same directory twice gives the same descriptor, which may still be needed for another theme
+        bool descriptorShared = false;
+        for (std::size_t i = 0; i < m_themes.size(); ++i)
+        {
+            if ((i != index) && (m_themes[i].watchDescriptor == watchedTheme.watchDescriptor))
+                descriptorShared = true;
+        }
+
+    #ifdef SFML_SYSTEM_LINUX
+        if (!descriptorShared)
+            inotify_rm_watch(m_inotifyDescriptor, watchedTheme.watchDescriptor);
+    #endif
+
+        watchedTheme.watchDescriptor = -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThemeWatcher::checkForChanges()
+    {
+    #ifdef SFML_SYSTEM_LINUX
+        if (m_inotifyDescriptor >= 0)
+        {
+            alignas(inotify_event) char buffer[4096];
+            while (true)
+            {
+                ssize_t length = read(m_inotifyDescriptor, buffer, sizeof(buffer));
+                if (length <= 0)
+                    break;
+
+                for (char* ptr = buffer; ptr < buffer + length; )
+                {
+                    const inotify_event* event = reinterpret_cast<const inotify_event*>(ptr);
+                    ptr += sizeof(inotify_event) + event->len;
+
+                    if (event->len == 0)
+                        continue;
+
+                    for (auto& watchedTheme : m_themes)
+                    {
+                        if ((watchedTheme.watchDescriptor == event->wd) && (getFileName(watchedTheme.filename) == event->name))
+                            watchedTheme.modified = true;
+                    }
+                }
+            }
+        }
+    #endif
+
+        // Themes that couldn't be watched with inotify (or all themes when it isn't available) are checked manually
+        for (auto& watchedTheme : m_themes)
+        {
+            if (watchedTheme.filename.empty() || (watchedTheme.watchDescriptor >= 0))
+                continue;
+
+            auto fileStamp = getFileStamp(watchedTheme.filename);
+            if (fileStamp != watchedTheme.fileStamp)
+            {
+                watchedTheme.fileStamp = fileStamp;
+                watchedTheme.modified = true;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
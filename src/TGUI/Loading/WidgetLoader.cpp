@@ -25,6 +25,7 @@
 
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/WidgetLoader.hpp>
+#include <TGUI/Profiler.hpp>
 #include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Widgets/Canvas.hpp>
 #include <TGUI/Widgets/ChatBox.hpp>
@@ -182,11 +183,8 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API Widget::Ptr loadContainer(std::shared_ptr<DataIO::Node> node, Container::Ptr container)
+    void loadChildWidgets(std::shared_ptr<DataIO::Node> node, Container& container)
     {
-        assert(container != nullptr);
-        loadWidget(node, container);
-
         for (auto& childNode : node->children)
         {
             auto nameSeparator = childNode->name.find('.');
@@ -199,11 +197,54 @@ namespace tgui
                     className = Deserializer::deserialize(ObjectConverter::Type::String, childNode->name.substr(nameSeparator + 1)).getString();
 
                 tgui::Widget::Ptr childWidget = loadFunction(childNode);
-                container->add(childWidget, className);
+                container.add(childWidget, className);
+                WidgetLoader::widgetMaterialized();
             }
             else
                 throw Exception{"No load function exists for widget type '" + widgetType + "'."};
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Find the names of all widgets in the sections below the node, without loading these widgets
+    void collectWidgetNames(const DataIO::Node& node, std::vector<sf::String>& names)
+    {
+        for (auto& childNode : node.children)
+        {
+            auto nameSeparator = childNode->name.find('.');
+            if (nameSeparator != std::string::npos)
+                names.push_back(Deserializer::deserialize(ObjectConverter::Type::String, childNode->name.substr(nameSeparator + 1)).getString());
+
+            collectWidgetNames(*childNode, names);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_API Widget::Ptr loadContainer(std::shared_ptr<DataIO::Node> node, Container::Ptr container)
+    {
+        assert(container != nullptr);
+        loadWidget(node, container);
+
+        bool loadLazily = false;
+        if (WidgetLoader::isLazyLoadingEnabled() && !node->children.empty())
+        {
+            if (node->propertyValuePairs["lazyload"])
+                loadLazily = parseBoolean(node->propertyValuePairs["lazyload"]->value);
+            else
+                loadLazily = !container->isVisible();
+        }
+
+        // The child widgets of hidden containers are only created once they are needed
+        if (loadLazily)
+        {
+            std::vector<sf::String> names;
+            collectWidgetNames(*node, names);
+            container->setPendingWidgets([node](Container& parent){ loadChildWidgets(node, parent); }, names);
+        }
+        else
+            loadChildWidgets(node, *container);
 
         return container;
     }
@@ -446,6 +487,8 @@ namespace tgui
                 editBox->setInputValidator(EditBox::Validator::UInt);
             else if (toLower(node->propertyValuePairs["inputvalidator"]->value) == "float")
                 editBox->setInputValidator(EditBox::Validator::Float);
+            else if (toLower(node->propertyValuePairs["inputvalidator"]->value) == "hex")
+                editBox->setInputValidator(EditBox::Validator::Hex);
             else
                 editBox->setInputValidator(DESERIALIZE_STRING("inputvalidator"));
         }
@@ -878,30 +921,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool WidgetLoader::m_lazyLoading = false;
+    std::size_t WidgetLoader::m_materializedWidgetCount = 0;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void WidgetLoader::load(Container::Ptr parent, std::stringstream& stream)
     {
+        TGUI_PROFILE_ZONE("WidgetLoader::load");
+
         auto rootNode = DataIO::parse(stream);
 
         if (rootNode->propertyValuePairs.size() != 0)
             loadWidget(rootNode, parent);
 
-        for (auto& node : rootNode->children)
-        {
-            auto nameSeparator = node->name.find('.');
-            auto widgetType = node->name.substr(0, nameSeparator);
-            auto& loadFunction = m_loadFunctions[toLower(widgetType)];
-            if (loadFunction)
-            {
-                std::string className;
-                if (nameSeparator != std::string::npos)
-                    className = Deserializer::deserialize(ObjectConverter::Type::String, node->name.substr(nameSeparator + 1)).getString();
-
-                tgui::Widget::Ptr widget = loadFunction(node);
-                parent->add(widget, className);
-            }
-            else
-                throw Exception{"No load function exists for widget type '" + widgetType + "'."};
-        }
+        loadChildWidgets(rootNode, *parent);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -919,6 +953,41 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetLoader::setLazyLoadingEnabled(bool enabled)
+    {
+        m_lazyLoading = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool WidgetLoader::isLazyLoadingEnabled()
+    {
+        return m_lazyLoading;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t WidgetLoader::getMaterializedWidgetCount()
+    {
+        return m_materializedWidgetCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetLoader::resetMaterializedWidgetCount()
+    {
+        m_materializedWidgetCount = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetLoader::widgetMaterialized()
+    {
+        m_materializedWidgetCount++;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -72,22 +72,26 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    #define SET_PROPERTY(property, value) node->propertyValuePairs[property] = std::make_shared<DataIO::ValueNode>(node.get(), value)
+    #define SET_PROPERTY(property, value) emitter.setProperty(property, value)
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveWidget(Widget::Ptr widget)
+    std::string getSectionName(Widget::Ptr widget)
     {
         sf::String widgetName;
         if (widget->getParent())
             widgetName = widget->getParent()->getWidgetName(widget);
 
-        auto node = std::make_shared<DataIO::Node>();
         if (widgetName.isEmpty())
-            node->name = widget->getWidgetType();
+            return widget->getWidgetType();
         else
-            node->name = widget->getWidgetType() + "." + Serializer::serialize(widgetName);
+            return widget->getWidgetType() + "." + Serializer::serialize(widgetName);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void saveWidgetProperties(Widget::Ptr widget, DataIO::Emitter& emitter)
+    {
         if (!widget->isVisible())
             SET_PROPERTY("Visible", "false");
         if (!widget->isEnabled())
@@ -106,53 +110,65 @@ namespace tgui
             SET_PROPERTY("Opacity", tgui::to_string(widget->getOpacity()));
 
         /// TODO: Font and ToolTip
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // The renderer is written as a child section, so it has to be saved after all properties of the widget
+    void saveRenderer(Widget::Ptr widget, DataIO::Emitter& emitter)
+    {
         if (widget->getRenderer())
         {
-            node->children.emplace_back(std::make_shared<DataIO::Node>());
-            node->children.back()->name = "Renderer";
+            emitter.beginSection("Renderer");
             for (auto& pair : widget->getRenderer()->getPropertyValuePairs())
-                node->children.back()->propertyValuePairs[pair.first] = std::make_shared<DataIO::ValueNode>(node->children.back().get(), Serializer::serialize(std::move(pair.second)));
+                emitter.setProperty(pair.first, Serializer::serialize(std::move(pair.second)));
+            emitter.endSection();
         }
-
-        return node;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveContainer(Container::Ptr container)
+    void saveChildWidgets(Container::Ptr container, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(container);
         for (auto& child : container->getWidgets())
-        {
-            auto& saveFunction = WidgetSaver::getSaveFunction(toLower(child->getWidgetType()));
-            if (saveFunction)
-                node->children.emplace_back(saveFunction(WidgetConverter{child}));
-            else
-                throw Exception{"No save function exists for widget type '" + child->getWidgetType() + "'."};
-        }
+            WidgetSaver::emitWidget(child, emitter);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        return node;
+    TGUI_API void saveWidget(Widget::Ptr widget, DataIO::Emitter& emitter)
+    {
+        saveWidgetProperties(widget, emitter);
+        saveRenderer(widget, emitter);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveButton(Button::Ptr button)
+    TGUI_API void saveContainer(Container::Ptr container, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(button);
+        saveWidgetProperties(container, emitter);
+        saveRenderer(container, emitter);
+        saveChildWidgets(container, emitter);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_API void saveButton(Button::Ptr button, DataIO::Emitter& emitter)
+    {
+        saveWidgetProperties(button, emitter);
 
         if (!button->getText().isEmpty())
             SET_PROPERTY("Text", Serializer::serialize(button->getText()));
 
         SET_PROPERTY("TextSize", tgui::to_string(button->getTextSize()));
-        return node;
+        saveRenderer(button, emitter);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveChatBox(ChatBox::Ptr chatBox)
+    TGUI_API void saveChatBox(ChatBox::Ptr chatBox, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(chatBox);
+        saveWidgetProperties(chatBox, emitter);
 
         SET_PROPERTY("TextSize", tgui::to_string(chatBox->getTextSize()));
         SET_PROPERTY("TextColor", Serializer::serialize(chatBox->getTextColor()));
@@ -170,39 +186,31 @@ namespace tgui
         else
             SET_PROPERTY("NewLinesBelowOthers", "false");
 
+        saveRenderer(chatBox, emitter);
+
         for (std::size_t i = 0; i < chatBox->getLineAmount(); ++i)
         {
             unsigned int lineTextSize = chatBox->getLineTextSize(i);
             sf::Color lineTextColor = chatBox->getLineColor(i);
 
-            auto lineNode = std::make_shared<DataIO::Node>();
-            lineNode->parent = node.get();
-            lineNode->name = "Line";
-
-            lineNode->propertyValuePairs["Text"] = std::make_shared<DataIO::ValueNode>(lineNode.get(), Serializer::serialize(chatBox->getLine(i)));
+            emitter.beginSection("Line");
+            emitter.setProperty("Text", Serializer::serialize(chatBox->getLine(i)));
             if (lineTextSize != chatBox->getTextSize())
-                lineNode->propertyValuePairs["TextSize"] = std::make_shared<DataIO::ValueNode>(lineNode.get(), tgui::to_string(lineTextSize));
+                emitter.setProperty("TextSize", tgui::to_string(lineTextSize));
             if (lineTextColor != chatBox->getTextColor())
-                lineNode->propertyValuePairs["Color"] = std::make_shared<DataIO::ValueNode>(lineNode.get(), Serializer::serialize(lineTextColor));
-
-            node->children.push_back(lineNode);
+                emitter.setProperty("Color", Serializer::serialize(lineTextColor));
+            emitter.endSection();
         }
 
         if (chatBox->getScrollbar())
-        {
-            node->children.push_back(WidgetSaver::getSaveFunction("scrollbar")(tgui::WidgetConverter{chatBox->getScrollbar()}));
-            node->children.back()->parent = node.get();
-            node->children.back()->name = "Scrollbar";
-        }
-
-        return node;
+            WidgetSaver::emitWidget(chatBox->getScrollbar(), emitter, "Scrollbar");
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveChildWindow(ChildWindow::Ptr childWindow)
+    TGUI_API void saveChildWindow(ChildWindow::Ptr childWindow, DataIO::Emitter& emitter)
     {
-        auto node = saveContainer(childWindow);
+        saveWidgetProperties(childWindow, emitter);
 
         if (childWindow->getTitleAlignment() == ChildWindow::TitleAlignment::Left)
             SET_PROPERTY("TitleAlignment", "Left");
@@ -220,33 +228,28 @@ namespace tgui
         if (childWindow->isKeptInParent())
             SET_PROPERTY("KeepInParent", "true");
 
-        node->children.push_back(WidgetSaver::getSaveFunction("button")(tgui::WidgetConverter{childWindow->getCloseButton()}));
-        node->children.back()->parent = node.get();
-        node->children.back()->name = "CloseButton";
-
-        return node;
+        saveRenderer(childWindow, emitter);
+        saveChildWidgets(childWindow, emitter);
+        WidgetSaver::emitWidget(childWindow->getCloseButton(), emitter, "CloseButton");
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveComboBox(ComboBox::Ptr comboBox)
+    TGUI_API void saveComboBox(ComboBox::Ptr comboBox, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(comboBox);
+        saveWidgetProperties(comboBox, emitter);
 
         SET_PROPERTY("ItemsToDisplay", tgui::to_string(comboBox->getItemsToDisplay()));
 
-        node->children.push_back(WidgetSaver::getSaveFunction("listbox")(tgui::WidgetConverter{comboBox->getListBox()}));
-        node->children.back()->parent = node.get();
-        node->children.back()->name = "ListBox";
-
-        return node;
+        saveRenderer(comboBox, emitter);
+        WidgetSaver::emitWidget(comboBox->getListBox(), emitter, "ListBox");
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveEditBox(EditBox::Ptr editBox)
+    TGUI_API void saveEditBox(EditBox::Ptr editBox, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(editBox);
+        saveWidgetProperties(editBox, emitter);
 
         if (editBox->getAlignment() != EditBox::Alignment::Left)
         {
@@ -264,6 +267,8 @@ namespace tgui
                 SET_PROPERTY("InputValidator", "UInt");
             else if (editBox->getInputValidator() == EditBox::Validator::Float)
                 SET_PROPERTY("InputValidator", "Float");
+            else if (editBox->getInputValidator() == EditBox::Validator::Hex)
+                SET_PROPERTY("InputValidator", "Hex");
             else
                 SET_PROPERTY("InputValidator", Serializer::serialize(sf::String{editBox->getInputValidator()}));
         }
@@ -281,14 +286,14 @@ namespace tgui
 
         SET_PROPERTY("CaretWidth", tgui::to_string((int)editBox->getCaretWidth()));
         SET_PROPERTY("TextSize", tgui::to_string(editBox->getTextSize()));
-        return node;
+        saveRenderer(editBox, emitter);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveKnob(Knob::Ptr knob)
+    TGUI_API void saveKnob(Knob::Ptr knob, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(knob);
+        saveWidgetProperties(knob, emitter);
 
         if (knob->getClockwiseTurning())
             SET_PROPERTY("ClockwiseTurning", "true");
@@ -300,14 +305,14 @@ namespace tgui
         SET_PROPERTY("Minimum", tgui::to_string(knob->getMinimum()));
         SET_PROPERTY("Maximum", tgui::to_string(knob->getMaximum()));
         SET_PROPERTY("Value", tgui::to_string(knob->getValue()));
-        return node;
+        saveRenderer(knob, emitter);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveLabel(Label::Ptr label)
+    TGUI_API void saveLabel(Label::Ptr label, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(label);
+        saveWidgetProperties(label, emitter);
 
         if (label->getTextStyle() != sf::Text::Regular)
         {
@@ -343,14 +348,14 @@ namespace tgui
             SET_PROPERTY("AutoSize", "true");
 
         SET_PROPERTY("TextSize", tgui::to_string(label->getTextSize()));
-        return node;
+        saveRenderer(label, emitter);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveListBox(ListBox::Ptr listBox)
+    TGUI_API void saveListBox(ListBox::Ptr listBox, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(listBox);
+        saveWidgetProperties(listBox, emitter);
 
         if (listBox->getItemCount() > 0)
         {
@@ -374,35 +379,31 @@ namespace tgui
         SET_PROPERTY("ItemHeight", tgui::to_string(listBox->getItemHeight()));
         SET_PROPERTY("MaximumItems", tgui::to_string(listBox->getMaximumItems()));
 
-        if (listBox->getScrollbar() != nullptr)
-        {
-            node->children.push_back(WidgetSaver::getSaveFunction("scrollbar")(tgui::WidgetConverter{listBox->getScrollbar()}));
-            node->children.back()->parent = node.get();
-            node->children.back()->name = "Scrollbar";
-        }
+        saveRenderer(listBox, emitter);
 
-        return node;
+        if (listBox->getScrollbar() != nullptr)
+            WidgetSaver::emitWidget(listBox->getScrollbar(), emitter, "Scrollbar");
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> savePicture(Picture::Ptr picture)
+    TGUI_API void savePicture(Picture::Ptr picture, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(picture);
+        saveWidgetProperties(picture, emitter);
 
         if (!picture->getLoadedFilename().isEmpty())
             SET_PROPERTY("Filename", Serializer::serialize(sf::String{picture->getLoadedFilename()}));
         if (picture->isSmooth())
             SET_PROPERTY("Smooth", "true");
 
-        return node;
+        saveRenderer(picture, emitter);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveProgressBar(ProgressBar::Ptr progressBar)
+    TGUI_API void saveProgressBar(ProgressBar::Ptr progressBar, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(progressBar);
+        saveWidgetProperties(progressBar, emitter);
 
         if (!progressBar->getText().isEmpty())
             SET_PROPERTY("Text", Serializer::serialize(progressBar->getText()));
@@ -421,14 +422,14 @@ namespace tgui
         SET_PROPERTY("Maximum", tgui::to_string(progressBar->getMaximum()));
         SET_PROPERTY("Value", tgui::to_string(progressBar->getValue()));
         SET_PROPERTY("TextSize", tgui::to_string(progressBar->getTextSize()));
-        return node;
+        saveRenderer(progressBar, emitter);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveRadioButton(RadioButton::Ptr radioButton)
+    TGUI_API void saveRadioButton(RadioButton::Ptr radioButton, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(radioButton);
+        saveWidgetProperties(radioButton, emitter);
 
         if (!radioButton->getText().isEmpty())
             SET_PROPERTY("Text", Serializer::serialize(radioButton->getText()));
@@ -436,14 +437,14 @@ namespace tgui
             SET_PROPERTY("Checked", "true");
 
         SET_PROPERTY("TextSize", tgui::to_string(radioButton->getTextSize()));
-        return node;
+        saveRenderer(radioButton, emitter);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveScrollbar(Scrollbar::Ptr scrollbar)
+    TGUI_API void saveScrollbar(Scrollbar::Ptr scrollbar, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(scrollbar);
+        saveWidgetProperties(scrollbar, emitter);
 
         if (scrollbar->getAutoHide())
             SET_PROPERTY("AutoHide", "true");
@@ -454,25 +455,25 @@ namespace tgui
         SET_PROPERTY("Maximum", tgui::to_string(scrollbar->getMaximum()));
         SET_PROPERTY("Value", tgui::to_string(scrollbar->getValue()));
         SET_PROPERTY("ArrowScrollAmount", tgui::to_string(scrollbar->getArrowScrollAmount()));
-        return node;
+        saveRenderer(scrollbar, emitter);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveSlider(Slider::Ptr slider)
+    TGUI_API void saveSlider(Slider::Ptr slider, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(slider);
+        saveWidgetProperties(slider, emitter);
         SET_PROPERTY("Minimum", tgui::to_string(slider->getMinimum()));
         SET_PROPERTY("Maximum", tgui::to_string(slider->getMaximum()));
         SET_PROPERTY("Value", tgui::to_string(slider->getValue()));
-        return node;
+        saveRenderer(slider, emitter);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveSpinButton(SpinButton::Ptr spinButton)
+    TGUI_API void saveSpinButton(SpinButton::Ptr spinButton, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(spinButton);
+        saveWidgetProperties(spinButton, emitter);
 
         if (spinButton->getVerticalScroll())
             SET_PROPERTY("VerticalScroll", "true");
@@ -482,14 +483,14 @@ namespace tgui
         SET_PROPERTY("Minimum", tgui::to_string(spinButton->getMinimum()));
         SET_PROPERTY("Maximum", tgui::to_string(spinButton->getMaximum()));
         SET_PROPERTY("Value", tgui::to_string(spinButton->getValue()));
-        return node;
+        saveRenderer(spinButton, emitter);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveTab(Tab::Ptr tab)
+    TGUI_API void saveTab(Tab::Ptr tab, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(tab);
+        saveWidgetProperties(tab, emitter);
 
         if (tab->getTabsCount() > 0)
         {
@@ -509,14 +510,14 @@ namespace tgui
 
         SET_PROPERTY("TextSize", tgui::to_string(tab->getTextSize()));
         SET_PROPERTY("TabHeight", tgui::to_string(tab->getTabHeight()));
-        return node;
+        saveRenderer(tab, emitter);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_API std::shared_ptr<DataIO::Node> saveTextBox(TextBox::Ptr textBox)
+    TGUI_API void saveTextBox(TextBox::Ptr textBox, DataIO::Emitter& emitter)
     {
-        auto node = saveWidget(textBox);
+        saveWidgetProperties(textBox, emitter);
 
         SET_PROPERTY("Text", Serializer::serialize(textBox->getText()));
         SET_PROPERTY("TextSize", tgui::to_string(textBox->getTextSize()));
@@ -525,14 +526,10 @@ namespace tgui
         if (textBox->isReadOnly())
             SET_PROPERTY("ReadOnly", "true");
 
-        if (textBox->getScrollbar() != nullptr)
-        {
-            node->children.push_back(WidgetSaver::getSaveFunction("scrollbar")(tgui::WidgetConverter{textBox->getScrollbar()}));
-            node->children.back()->parent = node.get();
-            node->children.back()->name = "Scrollbar";
-        }
+        saveRenderer(textBox, emitter);
 
-        return node;
+        if (textBox->getScrollbar() != nullptr)
+            WidgetSaver::emitWidget(textBox->getScrollbar(), emitter, "Scrollbar");
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -544,7 +541,7 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::map<std::string, WidgetSaver::SaveFunction> WidgetSaver::m_saveFunctions =
+    std::map<std::string, WidgetSaver::StreamSaveFunction> WidgetSaver::m_streamSaveFunctions =
         {
             {"widget", saveWidget},
             {"container", saveContainer},
@@ -570,27 +567,52 @@ namespace tgui
             {"textbox", saveTextBox}
         };
 
+    std::map<std::string, WidgetSaver::SaveFunction> WidgetSaver::m_saveFunctions;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void WidgetSaver::save(Container::Ptr widget, std::stringstream& stream)
+    void WidgetSaver::save(Container::Ptr widget, std::ostream& stream)
     {
-        auto node = std::make_shared<DataIO::Node>();
+        DataIO::Emitter emitter{stream};
         for (auto& child : widget->getWidgets())
+            emitWidget(child, emitter);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetSaver::emitWidget(Widget::Ptr widget, DataIO::Emitter& emitter, const std::string& sectionName)
+    {
+        const std::string& type = widget->getType().getLowercaseName();
+
+        auto streamIt = m_streamSaveFunctions.find(type);
+        if ((streamIt != m_streamSaveFunctions.end()) && streamIt->second)
         {
-            auto& saveFunction = WidgetSaver::getSaveFunction(toLower(child->getWidgetType()));
-            if (saveFunction)
-                node->children.emplace_back(saveFunction(WidgetConverter{child}));
-            else
-                throw Exception{"No save function exists for widget type '" + child->getWidgetType() + "'."};
+            emitter.beginSection(sectionName.empty() ? getSectionName(widget) : sectionName);
+            streamIt->second(WidgetConverter{widget}, emitter);
+            emitter.endSection();
+            return;
         }
 
-        DataIO::emit(node, stream);
+        // Save functions that create a node are still supported, the node is written to the stream afterwards
+        auto it = m_saveFunctions.find(type);
+        if ((it != m_saveFunctions.end()) && it->second)
+        {
+            auto node = it->second(WidgetConverter{widget});
+            if (!sectionName.empty())
+                node->name = sectionName;
+
+            emitter.emitNode(*node);
+            return;
+        }
+
+        throw Exception{"No save function exists for widget type '" + widget->getWidgetType() + "'."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void WidgetSaver::setSaveFunction(const std::string& type, const SaveFunction& saveFunction)
     {
+        m_streamSaveFunctions.erase(toLower(type));
         m_saveFunctions[toLower(type)] = saveFunction;
     }
 
@@ -598,7 +620,46 @@ namespace tgui
 
     const WidgetSaver::SaveFunction& WidgetSaver::getSaveFunction(const std::string& type)
     {
-        return m_saveFunctions[toLower(type)];
+        const std::string lowercaseType = toLower(type);
+        auto it = m_saveFunctions.find(lowercaseType);
+        if (it != m_saveFunctions.end())
+            return it->second;
+
+        // When only a streaming save function exists, wrap it inside a function that creates a node
+        auto& saveFunction = m_saveFunctions[lowercaseType];
+        auto streamIt = m_streamSaveFunctions.find(lowercaseType);
+        if ((streamIt != m_streamSaveFunctions.end()) && streamIt->second)
+        {
+            StreamSaveFunction streamSaveFunction = streamIt->second;
+            saveFunction = [streamSaveFunction](WidgetConverter converter)
+                {
+                    Widget::Ptr widget = converter;
+
+                    auto node = std::make_shared<DataIO::Node>();
+                    node->name = getSectionName(widget);
+
+                    DataIO::Emitter emitter{*node};
+                    streamSaveFunction(WidgetConverter{widget}, emitter);
+                    return node;
+                };
+        }
+
+        return saveFunction;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetSaver::setStreamSaveFunction(const std::string& type, const StreamSaveFunction& saveFunction)
+    {
+        m_saveFunctions.erase(toLower(type));
+        m_streamSaveFunctions[toLower(type)] = saveFunction;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const WidgetSaver::StreamSaveFunction& WidgetSaver::getStreamSaveFunction(const std::string& type)
+    {
+        return m_streamSaveFunctions[toLower(type)];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,158 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+#include <TGUI/MemoryUsage.hpp>
+#include <TGUI/Texture.hpp>
+
+#include <SFML/Graphics/Text.hpp>
+
+#include <functional>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MemoryUsage::getTotal() const
+    {
+        return widget + renderer + text + signals + textures;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MemoryUsage& MemoryUsage::operator+=(const MemoryUsage& right)
+    {
+        widget += right.widget;
+        renderer += right.renderer;
+        text += right.text;
+        signals += right.signals;
+        textures += right.textures;
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t getHeapMemoryUsage(const std::string& str)
+        {
+            // Short strings are stored inside the string object itself
+            const char* data = str.data();
+            const char* object = reinterpret_cast<const char*>(&str);
+            if (!std::less<const char*>()(data, object) && std::less<const char*>()(data, object + sizeof(std::string)))
+                return 0;
+            else
+                return str.capacity() + 1;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t getHeapMemoryUsage(const sf::String& str)
+        {
+            if (str.isEmpty())
+                return 0;
+            else
+                return (str.getSize() + 1) * sizeof(sf::Uint32);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t getHeapMemoryUsage(const sf::Text& text)
+        {
+            // Every character is drawn with two triangles
+            return getHeapMemoryUsage(text.getString()) + text.getString().getSize() * 6 * sizeof(sf::Vertex);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t getHeapMemoryUsage(const Texture& texture)
+        {
+            std::size_t usage = texture.m_vertices.capacity() * sizeof(sf::Vertex) + getHeapMemoryUsage(texture.m_id);
+            if (!texture.m_loaded)
+                return usage;
+
+            // The texture data is shared with other textures loaded from the same file. Textures that were loaded by the
+            // texture manager have a copy callback and the manager holds an extra reference to their data.
+            const auto& data = texture.m_data;
+            std::size_t users = static_cast<std::size_t>(data.use_count());
+            if (texture.m_copyCallback && (users > 1))
+                users--;
+
+            std::size_t dataSize = sizeof(TextureData) + data->texture.getSize().x * data->texture.getSize().y * 4;
+            if (data->image)
+            {
+                // The image can in turn be shared between the texture data of different parts of the same file
+                dataSize += (sizeof(sf::Image) + data->image->getSize().x * data->image->getSize().y * 4)
+                            / static_cast<std::size_t>(data->image.use_count());
+            }
+
+            return usage + dataSize / users;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t getHeapMemoryUsage(const std::vector<sf::String>& strings)
+        {
+            std::size_t usage = strings.capacity() * sizeof(sf::String);
+            for (const auto& str : strings)
+                usage += getHeapMemoryUsage(str);
+
+            return usage;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t getHeapMemoryUsage(const std::vector<sf::Text>& texts)
+        {
+            std::size_t usage = texts.capacity() * sizeof(sf::Text);
+            for (const auto& text : texts)
+                usage += getHeapMemoryUsage(text);
+
+            return usage;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t getHeapMemoryUsage(const std::vector<Texture>& textures)
+        {
+            std::size_t usage = textures.capacity() * sizeof(Texture);
+            for (const auto& texture : textures)
+                usage += getHeapMemoryUsage(texture);
+
+            return usage;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
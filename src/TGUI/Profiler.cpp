@@ -0,0 +1,330 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Profiler.hpp>
+#include <TGUI/Widget.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    // A slot is written by a single thread at a time. The sequence number is odd while the slot is being written and
+    // becomes 2 * (index + 1) once the event with the given index is completely stored.
+    struct Slot
+    {
+        std::atomic<std::uint64_t> sequence{0};
+        const char* name = nullptr;
+        char widgetType[24];
+        char widgetName[40];
+        std::int64_t start = 0;
+        std::int64_t duration = 0;
+        unsigned int threadId = 0;
+    };
+
+    struct RingBuffer
+    {
+        std::unique_ptr<Slot[]> slots;
+        std::size_t capacity = 0;
+        std::atomic<std::uint64_t> writeIndex{0};
+        std::atomic<bool> enabled{true};
+        const Clock::time_point epoch = Clock::now();
+
+        explicit RingBuffer(std::size_t newCapacity)
+        {
+            resize(newCapacity);
+        }
+
+        void resize(std::size_t newCapacity)
+        {
+            capacity = 1;
+            while (capacity < newCapacity)
+                capacity *= 2;
+
+            slots = std::unique_ptr<Slot[]>(new Slot[capacity]);
+            writeIndex = 0;
+        }
+    };
+
+    RingBuffer& getRingBuffer()
+    {
+        static RingBuffer buffer{16384};
+        return buffer;
+    }
+
+    unsigned int getThreadId()
+    {
+        static std::atomic<unsigned int> nextThreadId{0};
+        thread_local const unsigned int threadId = nextThreadId++;
+        return threadId;
+    }
+
+    // Copies the string into the fixed size buffer, characters that aren't ascii are replaced
+    template <std::size_t Size>
+    void copyTag(char (&destination)[Size], const sf::String& source)
+    {
+        std::size_t i = 0;
+        for (; (i < Size - 1) && (i < source.getSize()); ++i)
+            destination[i] = (source[i] < 128) ? static_cast<char>(source[i]) : '?';
+
+        destination[i] = '\0';
+    }
+
+    template <std::size_t Size>
+    void copyTag(char (&destination)[Size], const std::string& source)
+    {
+        const std::size_t length = std::min(source.length(), Size - 1);
+        std::memcpy(destination, source.c_str(), length);
+        destination[length] = '\0';
+    }
+
+    std::string escapeJson(const std::string& str)
+    {
+        std::string result;
+        result.reserve(str.length());
+        for (const char c : str)
+        {
+            if ((c == '"') || (c == '\\'))
+            {
+                result += '\\';
+                result += c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+                result += ' ';
+            else
+                result += c;
+        }
+
+        return result;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Profiler::Zone::Zone(const char* name) :
+        m_name     {name},
+        m_recording{getRingBuffer().enabled.load(std::memory_order_relaxed)}
+    {
+        m_widgetType[0] = '\0';
+        m_widgetName[0] = '\0';
+
+        if (m_recording)
+            m_startTime = Clock::now();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Profiler::Zone::Zone(const char* name, const Widget* widget, const sf::String& widgetName) :
+        m_name     {name},
+        m_recording{getRingBuffer().enabled.load(std::memory_order_relaxed)}
+    {
+        m_widgetType[0] = '\0';
+        m_widgetName[0] = '\0';
+
+        if (m_recording)
+        {
+            if (widget)
+                copyTag(m_widgetType, widget->getWidgetType());
+
+            copyTag(m_widgetName, widgetName);
+            m_startTime = Clock::now();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Profiler::Zone::~Zone()
+    {
+        if (!m_recording)
+            return;
+
+        const auto endTime = Clock::now();
+        RingBuffer& buffer = getRingBuffer();
+
+        const std::uint64_t index = buffer.writeIndex.fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = buffer.slots[index & (buffer.capacity - 1)];
+
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot.name = m_name;
+        std::memcpy(slot.widgetType, m_widgetType, sizeof(m_widgetType));
+        std::memcpy(slot.widgetName, m_widgetName, sizeof(m_widgetName));
+        slot.start = std::chrono::duration_cast<std::chrono::nanoseconds>(m_startTime - buffer.epoch).count();
+        slot.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - m_startTime).count();
+        slot.threadId = getThreadId();
+
+        slot.sequence.store(2 * index + 2, std::memory_order_release);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Profiler::isInstrumented()
+    {
+    #ifdef TGUI_ENABLE_PROFILING
+        return true;
+    #else
+        return false;
+    #endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::setEnabled(bool enabled)
+    {
+        getRingBuffer().enabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Profiler::isEnabled()
+    {
+        return getRingBuffer().enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::setCapacity(std::size_t capacity)
+    {
+        getRingBuffer().resize(std::max<std::size_t>(capacity, 1));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Profiler::getCapacity()
+    {
+        return getRingBuffer().capacity;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::clear()
+    {
+        RingBuffer& buffer = getRingBuffer();
+        for (std::size_t i = 0; i < buffer.capacity; ++i)
+            buffer.slots[i].sequence = 0;
+
+        buffer.writeIndex = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Profiler::Event> Profiler::getEvents()
+    {
+        RingBuffer& buffer = getRingBuffer();
+        const std::uint64_t endIndex = buffer.writeIndex.load(std::memory_order_acquire);
+        const std::uint64_t startIndex = (endIndex > buffer.capacity) ? (endIndex - buffer.capacity) : 0;
+
+        std::vector<Event> events;
+        events.reserve(static_cast<std::size_t>(endIndex - startIndex));
+        for (std::uint64_t index = startIndex; index < endIndex; ++index)
+        {
+            const Slot& slot = buffer.slots[index & (buffer.capacity - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != 2 * index + 2)
+                continue;
+
+            Event event;
+            event.name = slot.name;
+            event.widgetType = slot.widgetType;
+            event.widgetName = slot.widgetName;
+            event.start = slot.start / 1000.0;
+            event.duration = slot.duration / 1000.0;
+            event.threadId = slot.threadId;
+
+            // Drop the event if another thread started overwriting the slot while it was being copied
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != 2 * index + 2)
+                continue;
+
+            events.push_back(std::move(event));
+        }
+
+        return events;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::exportChromeTrace(std::ostream& stream)
+    {
+        const auto events = getEvents();
+
+        // Timestamps are written in microseconds with nanosecond precision
+        const auto oldFlags = stream.flags();
+        const auto oldPrecision = stream.precision();
+        stream << std::fixed << std::setprecision(3);
+
+        stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            const Event& event = events[i];
+            if (i > 0)
+                stream << ",";
+
+            stream << "\n{\"name\":\"" << escapeJson(event.name) << "\",\"cat\":\"tgui\",\"ph\":\"X\",\"pid\":1"
+                   << ",\"tid\":" << event.threadId << ",\"ts\":" << event.start << ",\"dur\":" << event.duration;
+
+            if (!event.widgetType.empty() || !event.widgetName.empty())
+            {
+                stream << ",\"args\":{\"type\":\"" << escapeJson(event.widgetType)
+                       << "\",\"widget\":\"" << escapeJson(event.widgetName) << "\"}";
+            }
+
+            stream << "}";
+        }
+
+        stream << "\n]}\n";
+
+        stream.flags(oldFlags);
+        stream.precision(oldPrecision);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Profiler::saveChromeTrace(const std::string& filename)
+    {
+        std::ofstream file{filename};
+        if (!file.is_open())
+            return false;
+
+        exportChromeTrace(file);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
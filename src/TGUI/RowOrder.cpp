@@ -0,0 +1,187 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/RowOrder.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The cancel flag is only checked once every this many calls to the comparator or predicate
+    const std::size_t CancelCheckInterval = 4096;
+
+    struct Cancelled {};
+
+    std::vector<std::size_t> calculateOrder(std::size_t rowCount,
+                                            const tgui::priv::RowOrderTask::Predicate& filter,
+                                            const tgui::priv::RowOrderTask::Comparator& comparator,
+                                            const std::atomic<bool>* cancelled)
+    {
+        std::size_t calls = 0;
+        auto checkCancelled = [&]{
+            if (cancelled && ((++calls % CancelCheckInterval) == 0) && cancelled->load(std::memory_order_relaxed))
+                throw Cancelled{};
+        };
+
+        // Even filling the vector is checked for cancellation, as touching the memory of millions of rows takes milliseconds
+        std::vector<std::size_t> order;
+        order.reserve(rowCount);
+        for (std::size_t row = 0; row < rowCount; ++row)
+        {
+            checkCancelled();
+            if (!filter || filter(row))
+                order.push_back(row);
+        }
+
+        // A stable sort is used so that rows which compare equal remain in the order of the data
+        if (comparator)
+        {
+            std::stable_sort(order.begin(), order.end(), [&](std::size_t left, std::size_t right) {
+                checkCancelled();
+                return comparator(left, right);
+            });
+        }
+
+        return order;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        struct RowOrderTask::State
+        {
+            std::atomic<bool> cancelled{false};
+            std::atomic<bool> finished{false};
+            std::vector<std::size_t> result;
+            std::exception_ptr error;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        RowOrderTask::~RowOrderTask()
+        {
+            cancel();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        RowOrderTask::RowOrderTask(const RowOrderTask&)
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        RowOrderTask& RowOrderTask::operator=(const RowOrderTask&)
+        {
+            cancel();
+            return *this;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RowOrderTask::start(std::size_t rowCount, Predicate filter, Comparator comparator)
+        {
+            cancel();
+
+            auto state = std::make_shared<State>();
+            m_state = state;
+            m_thread = std::thread([state, rowCount, filter, comparator]{
+                try
+                {
+                    state->result = calculateOrder(rowCount, filter, comparator, &state->cancelled);
+                }
+                catch (const Cancelled&)
+                {
+                }
+                catch (...)
+                {
+                    state->error = std::current_exception();
+                }
+
+                state->finished.store(true, std::memory_order_release);
+            });
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RowOrderTask::cancel()
+        {
+            if (m_state)
+            {
+                m_state->cancelled = true;
+                m_state = nullptr;
+            }
+
+            if (m_thread.joinable())
+                m_thread.join();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool RowOrderTask::isPending() const
+        {
+            return m_state != nullptr;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool RowOrderTask::takeResult(std::vector<std::size_t>& order)
+        {
+            if (!m_state || !m_state->finished.load(std::memory_order_acquire))
+                return false;
+
+            m_thread.join();
+
+            const auto state = std::move(m_state);
+            if (state->error)
+                std::rethrow_exception(state->error);
+
+            order = std::move(state->result);
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::vector<std::size_t> RowOrderTask::calculate(std::size_t rowCount, const Predicate& filter, const Comparator& comparator)
+        {
+            return calculateOrder(rowCount, filter, comparator, nullptr);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Signal.hpp>
+#include <TGUI/MemoryUsage.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -51,7 +52,7 @@ namespace tgui
 
     bool Signal::disconnect(unsigned int id)
     {
-        return !!m_functions.erase(id) || !!m_functionsEx.erase(id);
+        return !!m_functions.erase(id) || !!m_functionsEx.erase(id) || !!m_deferredFunctions.erase(id);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -60,6 +61,8 @@ namespace tgui
     {
         m_functions.clear();
         m_functionsEx.clear();
+        m_deferredFunctions.clear();
+        m_lastArguments = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -71,6 +74,188 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Signal::hasCallbackFunctions() const
+    {
+        return !m_functionsEx.empty() || hasDeferredCallbackFunctions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Signal::setDeliveryPolicy(unsigned int id, const DeliveryPolicy& policy)
+    {
+        auto deferredIt = m_deferredFunctions.find(id);
+        if (deferredIt != m_deferredFunctions.end())
+        {
+            if (policy.type != DeliveryPolicy::Type::Immediate)
+            {
+                deferredIt->second.policy = policy;
+                return true;
+            }
+
+            // Move the function back to the functions that are called while the signal is being sent
+            if (deferredIt->second.function)
+                m_functions[id] = std::move(deferredIt->second.function);
+            else
+                m_functionsEx[id] = std::move(deferredIt->second.functionEx);
+
+            m_deferredFunctions.erase(deferredIt);
+            return true;
+        }
+
+        auto functionIt = m_functions.find(id);
+        if (functionIt != m_functions.end())
+        {
+            if (policy.type != DeliveryPolicy::Type::Immediate)
+            {
+                DeferredFunction& deferred = m_deferredFunctions[id];
+                deferred.policy = policy;
+                deferred.function = std::move(functionIt->second);
+                m_functions.erase(functionIt);
+            }
+
+            return true;
+        }
+
+        auto functionExIt = m_functionsEx.find(id);
+        if (functionExIt != m_functionsEx.end())
+        {
+            if (policy.type != DeliveryPolicy::Type::Immediate)
+            {
+                DeferredFunction& deferred = m_deferredFunctions[id];
+                deferred.policy = policy;
+                deferred.functionEx = std::move(functionExIt->second);
+                m_functionsEx.erase(functionExIt);
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Signal::sendDeferred(sf::Time time)
+    {
+        // The called functions may disconnect themselves, so the id is used to find the next function
+        bool pending = false;
+        auto it = m_deferredFunctions.begin();
+        while (it != m_deferredFunctions.end())
+        {
+            const unsigned int id = it->first;
+            DeferredFunction& deferred = it->second;
+            if ((deferred.policy.type == DeliveryPolicy::Type::RateLimited)
+             && (!deferred.delivered || (time - deferred.lastDelivery >= deferred.policy.interval)))
+            {
+                deliver(deferred, time);
+            }
+            else
+            {
+                deferred.pending = true;
+                pending = true;
+            }
+
+            it = m_deferredFunctions.upper_bound(id);
+        }
+
+        return pending;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Signal::deliverPending(sf::Time time)
+    {
+        bool pending = false;
+        auto it = m_deferredFunctions.begin();
+        while (it != m_deferredFunctions.end())
+        {
+            const unsigned int id = it->first;
+            DeferredFunction& deferred = it->second;
+            if (deferred.pending)
+            {
+                if ((deferred.policy.type == DeliveryPolicy::Type::RateLimited) && (time - deferred.lastDelivery < deferred.policy.interval))
+                    pending = true;
+                else
+                    deliver(deferred, time);
+            }
+
+            it = m_deferredFunctions.upper_bound(id);
+        }
+
+        return pending;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Signal::clearPending()
+    {
+        for (auto& deferred : m_deferredFunctions)
+            deferred.second.pending = false;
+
+        m_lastArguments = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Signal::hasDeferredCallbackFunctions() const
+    {
+        for (const auto& deferred : m_deferredFunctions)
+        {
+            if (!deferred.second.function)
+                return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Signal::deliver(DeferredFunction& deferred, sf::Time time)
+    {
+        deferred.pending = false;
+        deferred.delivered = true;
+        deferred.lastDelivery = time;
+
+        // Copies are made because the function may disconnect itself or send the signal again while it is running
+        if (deferred.function)
+        {
+            const auto arguments = m_lastArguments;
+            const auto function = deferred.function;
+            if (arguments)
+                arguments->setData();
+
+            function();
+        }
+        else
+        {
+            const auto function = deferred.functionEx;
+            const Callback callback = m_lastCallback;
+            function(callback);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Signal::getMemoryUsage() const
+    {
+        std::size_t usage = sizeof(Signal)
+                          + m_functions.size() * (priv::MapNodeOverhead + sizeof(decltype(m_functions)::value_type))
+                          + m_functionsEx.size() * (priv::MapNodeOverhead + sizeof(decltype(m_functionsEx)::value_type))
+                          + m_deferredFunctions.size() * (priv::MapNodeOverhead + sizeof(decltype(m_deferredFunctions)::value_type))
+                          + m_allowedTypes.capacity() * sizeof(std::vector<std::string>);
+
+        for (const auto& types : m_allowedTypes)
+        {
+            usage += types.capacity() * sizeof(std::string);
+            for (const auto& type : types)
+                usage += priv::getHeapMemoryUsage(type);
+        }
+
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Signal::operator()(unsigned int)
     {
         for (auto& function : m_functions)
@@ -83,7 +268,10 @@ namespace tgui
     SignalWidgetBase::SignalWidgetBase(const SignalWidgetBase& copy)
     {
         for (auto& signal : copy.m_signals)
+        {
             m_signals[signal.first] = std::make_shared<Signal>(*signal.second);
+            m_signals[signal.first]->clearPending();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -93,7 +281,12 @@ namespace tgui
         if (this != &right)
         {
             for (auto& signal : right.m_signals)
+            {
                 m_signals[signal.first] = std::make_shared<Signal>(*signal.second);
+                m_signals[signal.first]->clearPending();
+            }
+
+            m_signalsPending = false;
         }
 
         return *this;
@@ -101,6 +294,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void SignalWidgetBase::setDeliveryPolicy(unsigned int id, const DeliveryPolicy& policy)
+    {
+        for (auto& signal : m_signals)
+        {
+            if (signal.second->setDeliveryPolicy(id, policy))
+                return;
+        }
+
+        throw Exception{"Failed to change delivery policy. There is no function bound to the given id " + tgui::to_string(id) + "."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void SignalWidgetBase::disconnect(unsigned int id)
     {
         for (auto& signal : m_signals)
@@ -133,7 +339,51 @@ namespace tgui
     bool SignalWidgetBase::isSignalBound(std::string&& name)
     {
         assert(m_signals[toLower(name)]);
-        return !m_signals[toLower(name)]->isEmpty() || !m_signals[toLower(name)]->m_functionsEx.empty();
+        return !m_signals[toLower(name)]->isEmpty() || !m_signals[toLower(name)]->m_functionsEx.empty()
+            || m_signals[toLower(name)]->hasDeferredFunctions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool SignalWidgetBase::isCallbackBound(std::string&& name)
+    {
+        auto signalIt = m_signals.find(toLower(name));
+        assert(signalIt != m_signals.end());
+        return signalIt->second->hasCallbackFunctions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SignalWidgetBase::deliverPendingSignals(sf::Time elapsedTime)
+    {
+        m_signalTime += elapsedTime;
+        if (!m_signalsPending)
+            return;
+
+        m_signalsPending = false;
+        for (auto& signal : m_signals)
+        {
+            if (signal.second->hasDeferredFunctions() && signal.second->deliverPending(m_signalTime))
+                m_signalsPending = true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SignalWidgetBase::getSignalsMemoryUsage() const
+    {
+        std::size_t usage = priv::getHeapMemoryUsage(m_callback.trigger)
+                          + priv::getHeapMemoryUsage(m_callback.text)
+                          + priv::getHeapMemoryUsage(m_callback.itemId);
+
+        // Every signal is stored in a map node and has its own shared pointer control block
+        for (const auto& signal : m_signals)
+        {
+            usage += priv::MapNodeOverhead + sizeof(decltype(m_signals)::value_type) + priv::getHeapMemoryUsage(signal.first)
+                   + priv::SharedPtrOverhead + signal.second->getMemoryUsage();
+        }
+
+        return usage;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,501 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+#include <TGUI/TextLayout.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Global.hpp>
+#include <TGUI/Profiler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Below this amount of labels the cost of starting threads is higher than what is gained by them
+    const std::size_t MinimumLabelsPerThread = 64;
+
+    thread_local unsigned int batchDepth = 0;
+    thread_local std::vector<tgui::Label*>* pendingLabels = nullptr;
+
+    std::atomic<unsigned int> maximumThreadCount{0};
+
+    // Gives access to the glyphs directly through the font. Only usable on the gui thread.
+    struct FontMetrics
+    {
+        const sf::Font& font;
+        unsigned int characterSize;
+        bool bold;
+
+        float getWidth(sf::Uint32 character) const
+        {
+            return static_cast<float>(font.getGlyph(character, characterSize, bold).textureRect.width);
+        }
+
+        float getAdvance(sf::Uint32 character) const
+        {
+            return static_cast<float>(font.getGlyph(character, characterSize, bold).advance);
+        }
+
+        float getKerning(sf::Uint32 first, sf::Uint32 second) const
+        {
+            return static_cast<float>(font.getKerning(first, second, characterSize));
+        }
+    };
+
+    template <typename Metrics>
+    tgui::priv::TextLayoutResult wrapTextImpl(const sf::String& text, float maxWidth, const Metrics& metrics)
+    {
+        tgui::priv::TextLayoutResult result;
+
+        const std::size_t textLength = text.getSize();
+        std::size_t index = 0;
+        while (index < textLength)
+        {
+            const std::size_t oldIndex = index;
+
+            float width = 0;
+            sf::Uint32 prevChar = 0;
+            for (std::size_t i = index; i < textLength; ++i)
+            {
+                float charWidth;
+                const sf::Uint32 curChar = text[i];
+                if (curChar == '\n')
+                {
+                    index++;
+                    break;
+                }
+                else if (curChar == '\t')
+                    charWidth = metrics.getWidth(' ') * 4;
+                else
+                    charWidth = metrics.getWidth(curChar);
+
+                const float kerning = metrics.getKerning(prevChar, curChar);
+                if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
+                {
+                    if (curChar == '\t')
+                        width += (metrics.getAdvance(' ') * 4) + kerning;
+                    else
+                        width += metrics.getAdvance(curChar) + kerning;
+
+                    index++;
+                }
+                else
+                    break;
+
+                prevChar = curChar;
+            }
+
+            result.width = std::max(result.width, width);
+
+            // Every line contains at least one character
+            if (index == oldIndex)
+                index++;
+
+            // Implement the word-wrap
+            if (text[index-1] != '\n')
+            {
+                const std::size_t indexWithoutWordWrap = index;
+
+                if ((index < textLength) && (!tgui::isWhitespace(text[index])))
+                {
+                    std::size_t wordWrapCorrection = 0;
+                    while ((index > oldIndex) && (!tgui::isWhitespace(text[index - 1])))
+                    {
+                        wordWrapCorrection++;
+                        index--;
+                    }
+
+                    // The word can't be split but there is no other choice, it does not fit on the line
+                    if ((index - oldIndex) <= wordWrapCorrection)
+                        index = indexWithoutWordWrap;
+                }
+            }
+
+            result.lines.push_back({oldIndex, index - oldIndex, (index < textLength) && (text[index-1] != '\n')});
+
+            // If the next line starts with just a space, then the space need not be visible
+            if ((index < textLength) && (text[index] == ' '))
+            {
+                if ((index == 0) || (!tgui::isWhitespace(text[index-1])))
+                {
+                    // But two or more spaces indicate that it is not a normal text and the spaces should not be ignored
+                    if (((index + 1 < textLength) && (!tgui::isWhitespace(text[index + 1]))) || (index + 1 == textLength))
+                        index++;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    // Threads that are kept alive between batches, so that flushing a batch doesn't have to create new threads each time
+    class WorkerPool
+    {
+    public:
+
+        ~WorkerPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                m_stopping = true;
+            }
+            m_workAvailable.notify_all();
+
+            for (auto& thread : m_threads)
+                thread.join();
+        }
+
+        // Calls the function for every index, spread over the given amount of threads. The calling thread also does work.
+        // The first exception thrown by the function is rethrown here after all threads have stopped using the function.
+        void run(std::size_t count, unsigned int threadCount, const std::function<void(std::size_t)>& function)
+        {
+            std::lock_guard<std::mutex> runLock{m_runMutex};
+
+            {
+                std::unique_lock<std::mutex> lock{m_mutex};
+                while (m_threads.size() + 1 < threadCount)
+                    m_threads.emplace_back(&WorkerPool::workerLoop, this);
+
+                m_function = &function;
+                m_count = count;
+                m_nextIndex = 0;
+                m_exception = nullptr;
+                m_freeSlots = threadCount - 1;
+            }
+            m_workAvailable.notify_all();
+
+            work();
+
+            // Workers that didn't start yet are no longer needed, the ones that did are waited for
+            std::exception_ptr exception;
+            {
+                std::unique_lock<std::mutex> lock{m_mutex};
+                m_freeSlots = 0;
+                m_workFinished.wait(lock, [this]{ return m_busyWorkers == 0; });
+
+                m_function = nullptr;
+                std::swap(exception, m_exception);
+            }
+
+            if (exception)
+                std::rethrow_exception(exception);
+        }
+
+    private:
+
+        void workerLoop()
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            while (true)
+            {
+                m_workAvailable.wait(lock, [this]{ return m_stopping || (m_freeSlots > 0); });
+                if (m_stopping)
+                    return;
+
+                --m_freeSlots;
+                ++m_busyWorkers;
+                lock.unlock();
+
+                work();
+
+                lock.lock();
+                if (--m_busyWorkers == 0)
+                    m_workFinished.notify_all();
+            }
+        }
+
+        void work()
+        {
+            std::size_t index;
+            while ((index = m_nextIndex.fetch_add(1, std::memory_order_relaxed)) < m_count)
+            {
+                try
+                {
+                    (*m_function)(index);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    if (!m_exception)
+                        m_exception = std::current_exception();
+
+                    // Let the other threads stop as well
+                    m_nextIndex = m_count;
+                }
+            }
+        }
+
+    private:
+
+        std::mutex m_runMutex;
+        std::mutex m_mutex;
+        std::condition_variable m_workAvailable;
+        std::condition_variable m_workFinished;
+        std::vector<std::thread> m_threads;
+        bool m_stopping = false;
+        unsigned int m_freeSlots = 0;
+        unsigned int m_busyWorkers = 0;
+
+        const std::function<void(std::size_t)>* m_function = nullptr;
+        std::size_t m_count = 0;
+        std::atomic<std::size_t> m_nextIndex{0};
+        std::exception_ptr m_exception;
+    };
+
+    void parallelFor(std::size_t count, unsigned int threadCount, const std::function<void(std::size_t)>& function)
+    {
+        if (threadCount <= 1)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                function(i);
+        }
+        else
+        {
+            static WorkerPool pool;
+            pool.run(count, threadCount, function);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        GlyphMetrics::GlyphMetrics(const sf::Font& font, unsigned int characterSize, bool bold) :
+            m_font         (font),
+            m_characterSize{characterSize},
+            m_bold         {bold}
+        {
+            prepare(" ");
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void GlyphMetrics::prepare(const sf::String& text)
+        {
+            sf::Uint32 prevChar = 0;
+            for (const sf::Uint32 curChar : text)
+            {
+                if (m_glyphs.find(curChar) == m_glyphs.end())
+                {
+                    const sf::Glyph& glyph = m_font.getGlyph(curChar, m_characterSize, m_bold);
+                    m_glyphs[curChar] = {static_cast<float>(glyph.textureRect.width), static_cast<float>(glyph.advance)};
+                }
+
+                if (prevChar != 0)
+                {
+                    const std::uint64_t key = (static_cast<std::uint64_t>(prevChar) << 32) | curChar;
+                    if (m_kerning.find(key) == m_kerning.end())
+                        m_kerning[key] = static_cast<float>(m_font.getKerning(prevChar, curChar, m_characterSize));
+                }
+
+                prevChar = curChar;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float GlyphMetrics::getWidth(sf::Uint32 character) const
+        {
+            auto it = m_glyphs.find(character);
+            return (it != m_glyphs.end()) ? it->second.width : 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float GlyphMetrics::getAdvance(sf::Uint32 character) const
+        {
+            auto it = m_glyphs.find(character);
+            return (it != m_glyphs.end()) ? it->second.advance : 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float GlyphMetrics::getKerning(sf::Uint32 first, sf::Uint32 second) const
+        {
+            if (first == 0)
+                return 0;
+
+            auto it = m_kerning.find((static_cast<std::uint64_t>(first) << 32) | second);
+            return (it != m_kerning.end()) ? it->second : 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TextLayoutResult wrapText(const sf::String& text, float maxWidth, const sf::Font& font, unsigned int characterSize, bool bold)
+        {
+            return wrapTextImpl(text, maxWidth, FontMetrics{font, characterSize, bold});
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TextLayoutResult wrapText(const sf::String& text, float maxWidth, const GlyphMetrics& metrics)
+        {
+            return wrapTextImpl(text, maxWidth, metrics);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextLayoutBatch::TextLayoutBatch()
+    {
+        if (batchDepth++ == 0)
+            pendingLabels = new std::vector<Label*>();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextLayoutBatch::~TextLayoutBatch()
+    {
+        if (--batchDepth > 0)
+            return;
+
+        // Labels that change while the batch is being flushed are laid out immediately
+        std::unique_ptr<std::vector<Label*>> labels{pendingLabels};
+        pendingLabels = nullptr;
+        flush(*labels);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextLayoutBatch::isActive()
+    {
+        return batchDepth > 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayoutBatch::setThreadCount(unsigned int threads)
+    {
+        maximumThreadCount = threads;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextLayoutBatch::getThreadCount()
+    {
+        if (maximumThreadCount > 0)
+            return maximumThreadCount;
+        else
+            return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextLayoutBatch::postpone(Label* label)
+    {
+        if (!pendingLabels)
+            return false;
+
+        if (!label->m_textLayoutPending)
+            pendingLabels->push_back(label);
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayoutBatch::cancel(Label* label)
+    {
+        if (!pendingLabels)
+            return;
+
+        auto it = std::find(pendingLabels->begin(), pendingLabels->end(), label);
+        if (it != pendingLabels->end())
+            *it = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayoutBatch::flush(std::vector<Label*>& pending)
+    {
+        TGUI_PROFILE_ZONE("TextLayoutBatch::flush");
+
+        // Labels that were laid out or destroyed in the meantime were replaced by a null pointer
+        std::vector<Label*> labels;
+        labels.reserve(pending.size());
+        for (Label* label : pending)
+        {
+            if (label && label->m_textLayoutPending && label->getFont())
+                labels.push_back(label);
+        }
+
+        if (labels.empty())
+            return;
+
+        // The font loads glyphs on demand, so everything that is needed from it is copied first.
+        // Labels that share the same font, text size and style also share their metrics.
+        using MetricsKey = std::tuple<const sf::Font*, unsigned int, bool>;
+        std::map<MetricsKey, std::unique_ptr<priv::GlyphMetrics>> metricsMap;
+        std::vector<const priv::GlyphMetrics*> labelMetrics(labels.size());
+        std::vector<float> maxWidths(labels.size());
+        for (std::size_t i = 0; i < labels.size(); ++i)
+        {
+            Label* label = labels[i];
+            const bool bold = (label->m_textStyle & sf::Text::Bold) != 0;
+            auto& metrics = metricsMap[MetricsKey{label->getFont().get(), label->m_textSize, bold}];
+            if (!metrics)
+                metrics = std::unique_ptr<priv::GlyphMetrics>(new priv::GlyphMetrics{*label->getFont(), label->m_textSize, bold});
+
+            metrics->prepare(label->m_string);
+            labelMetrics[i] = metrics.get();
+            maxWidths[i] = label->getTextMaxWidth();
+        }
+
+        // Split the texts in lines on all threads
+        std::vector<priv::TextLayoutResult> results(labels.size());
+        const unsigned int threadCount = static_cast<unsigned int>(
+            std::min<std::size_t>(getThreadCount(), (labels.size() + MinimumLabelsPerThread - 1) / MinimumLabelsPerThread));
+
+        parallelFor(labels.size(), threadCount, [&](std::size_t i){
+            results[i] = priv::wrapText(labels[i]->m_string, maxWidths[i], *labelMetrics[i]);
+        });
+
+        // Creating the texts and updating the widgets has to happen on this thread again
+        for (std::size_t i = 0; i < labels.size(); ++i)
+        {
+            if (labels[i]->m_textLayoutPending)
+                labels[i]->applyTextLayout(results[i], maxWidths[i]);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,109 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/VertexCache.hpp>
+
+#include <SFML/Graphics/RenderTarget.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool VertexCache::update(sf::Vector2f size, unsigned int state, float opacity)
+        {
+            if (m_valid && (m_size == size) && (m_state == state) && (m_opacity == opacity))
+                return false;
+
+            // The vector keeps its capacity, so rebuilding the geometry doesn't allocate memory
+            m_vertices.clear();
+            m_size = size;
+            m_state = state;
+            m_opacity = opacity;
+            m_valid = true;
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void VertexCache::invalidate()
+        {
+            m_valid = false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void VertexCache::addRect(sf::Vector2f position, sf::Vector2f size, const sf::Color& color)
+        {
+            if ((size.x <= 0) || (size.y <= 0) || (color.a == 0))
+                return;
+
+            const sf::Vector2f topRight{position.x + size.x, position.y};
+            const sf::Vector2f bottomLeft{position.x, position.y + size.y};
+            const sf::Vector2f bottomRight{position.x + size.x, position.y + size.y};
+
+            m_vertices.emplace_back(position, color);
+            m_vertices.emplace_back(topRight, color);
+            m_vertices.emplace_back(bottomLeft, color);
+            m_vertices.emplace_back(bottomLeft, color);
+            m_vertices.emplace_back(topRight, color);
+            m_vertices.emplace_back(bottomRight, color);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void VertexCache::addBorders(sf::Vector2f position, sf::Vector2f size, const Borders& borders, const sf::Color& color)
+        {
+            // Left, top, right and bottom border
+            addRect({position.x - borders.left, position.y - borders.top}, {borders.left, size.y + borders.top}, color);
+            addRect({position.x, position.y - borders.top}, {size.x + borders.right, borders.top}, color);
+            addRect({position.x + size.x, position.y}, {borders.right, size.y + borders.bottom}, color);
+            addRect({position.x - borders.left, position.y + size.y}, {size.x + borders.left, borders.bottom}, color);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void VertexCache::draw(sf::RenderTarget& target, sf::RenderStates states) const
+        {
+            if (!m_vertices.empty())
+                target.draw(m_vertices.data(), m_vertices.size(), sf::Triangles, states);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t getHeapMemoryUsage(const VertexCache& cache)
+        {
+            return cache.m_vertices.capacity() * sizeof(sf::Vertex);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
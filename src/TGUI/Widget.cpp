@@ -104,6 +104,7 @@ namespace tgui
         m_mouseDown      {false},
         m_focused        {false},
         m_allowFocus     {copy.m_allowFocus},
+        m_tabIndex       {copy.m_tabIndex},
         m_draggableWidget{copy.m_draggableWidget},
         m_containerWidget{copy.m_containerWidget},
         m_font           {copy.m_font}
@@ -149,6 +150,7 @@ namespace tgui
             m_mouseDown           = false;
             m_focused             = false;
             m_allowFocus          = right.m_allowFocus;
+            m_tabIndex            = right.m_tabIndex;
             m_draggableWidget     = right.m_draggableWidget;
             m_containerWidget     = right.m_containerWidget;
             m_font                = right.m_font;
@@ -179,6 +181,8 @@ namespace tgui
 
             m_size.y.getImpl()->parentWidget = this;
             m_size.y.getImpl()->recalculate();
+
+            invalidateAbsolutePosition();
         }
 
         return *this;
@@ -200,6 +204,7 @@ namespace tgui
         }
 
         Transformable::setPosition(position);
+        invalidateAbsolutePosition();
 
         m_callback.position = getPosition();
         sendSignal("PositionChanged", getPosition());
@@ -230,10 +235,17 @@ namespace tgui
 
     sf::Vector2f Widget::getAbsolutePosition() const
     {
-        if (m_parent)
-            return m_parent->getAbsolutePosition() + m_parent->getChildWidgetsOffset() + getPosition();
-        else
-            return getPosition();
+        if (!m_absolutePositionValid)
+        {
+            if (m_parent)
+                m_absolutePosition = m_parent->getAbsolutePosition() + m_parent->getChildWidgetsOffset() + getPosition();
+            else
+                m_absolutePosition = getPosition();
+
+            m_absolutePositionValid = true;
+        }
+
+        return m_absolutePosition;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -241,6 +253,7 @@ namespace tgui
     void Widget::show()
     {
         m_visible = true;
+        focusOrderChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -309,6 +322,7 @@ namespace tgui
     void Widget::hide()
     {
         m_visible = false;
+        focusOrderChanged();
 
         // If the widget is focused then it must be unfocused
         unfocus();
@@ -371,6 +385,7 @@ namespace tgui
     void Widget::enable()
     {
         m_enabled = true;
+        focusOrderChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -378,6 +393,7 @@ namespace tgui
     void Widget::disable()
     {
         m_enabled = false;
+        focusOrderChanged();
 
         // Change the mouse button state.
         m_mouseHover = false;
@@ -406,6 +422,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::setTabIndex(int tabIndex)
+    {
+        if (m_tabIndex != tabIndex)
+        {
+            m_tabIndex = tabIndex;
+            focusOrderChanged();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setOpacity(float opacity)
     {
         if (opacity < 0)
@@ -473,9 +500,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage Widget::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.widget = sizeof(Widget)
+                     + priv::getHeapMemoryUsage(m_primaryLoadingParameter)
+                     + priv::getHeapMemoryUsage(m_secondaryLoadingParameter)
+                     + m_showAnimations.capacity() * sizeof(std::shared_ptr<priv::Animation>)
+                     + m_showAnimations.size() * sizeof(priv::Animation);
+
+        usage.signals = getSignalsMemoryUsage();
+
+        if (m_renderer)
+            usage += m_renderer->getMemoryUsage();
+
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setParent(Container* parent)
     {
         m_parent = parent;
+        invalidateAbsolutePosition();
         if (m_parent)
         {
             m_position.x.getImpl()->recalculate();
@@ -498,6 +545,9 @@ namespace tgui
             else
                 i++;
         }
+
+        // Signals that were sent during the last frame to functions that are only called once per frame
+        deliverPendingSignals(elapsedTime);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -540,6 +590,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::focusOrderChanged()
+    {
+        if (m_parent)
+            m_parent->invalidateFocusOrder();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidateAbsolutePosition()
+    {
+        m_absolutePositionValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::widgetFocused()
     {
         sendSignal("Focused");
@@ -646,6 +711,15 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MemoryUsage WidgetRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(WidgetRenderer);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,188 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+#include <TGUI/WidgetType.hpp>
+#include <TGUI/Global.hpp>
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        struct WidgetTypeEntry
+        {
+            std::string name;
+            std::string lowercaseName;
+            unsigned int id;
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The entries are stored in a deque so that pointers to them remain valid when new types are registered.
+    // Only registering needs the lock, entries are never changed once they are created.
+    struct Registry
+    {
+        std::mutex mutex;
+        std::deque<tgui::priv::WidgetTypeEntry> entries;
+        std::unordered_map<std::string, const tgui::priv::WidgetTypeEntry*> entriesByName;
+        std::unordered_map<std::string, const tgui::priv::WidgetTypeEntry*> entriesByLowercaseName;
+
+        Registry()
+        {
+            // The built-in types are registered up front so that their ids don't depend on the order of construction
+            for (const char* name : {"Unknown", "ClickableWidget", "GuiContainer", "Panel",
+                                     "HorizontalLayout", "VerticalLayout", "Grid", "ChildWindow", "MessageBox",
+                                     "Button", "Canvas", "ChatBox", "CheckBox", "ComboBox", "EditBox", "Knob", "Label",
+                                     "ListBox", "MenuBar", "Picture", "ProgressBar", "RadioButton", "Scrollbar", "Slider",
+                                     "SpinButton", "Tab", "TextBox", "Table", "TableRow", "TableItem", "RichTextLabel"})
+            {
+                add(name);
+            }
+        }
+
+        const tgui::priv::WidgetTypeEntry* add(const std::string& name)
+        {
+            entries.push_back({name, tgui::toLower(name), static_cast<unsigned int>(entries.size())});
+            entriesByName[name] = &entries.back();
+
+            // When names only differ in case, the lowercase name keeps referring to the type that was registered first
+            entriesByLowercaseName.emplace(entries.back().lowercaseName, &entries.back());
+            return &entries.back();
+        }
+
+        const tgui::priv::WidgetTypeEntry* get(const std::string& name)
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+
+            const auto it = entriesByName.find(name);
+            if (it != entriesByName.end())
+                return it->second;
+            else
+                return add(name);
+        }
+
+        const tgui::priv::WidgetTypeEntry* findLowercase(const std::string& lowercaseName)
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+
+            const auto it = entriesByLowercaseName.find(lowercaseName);
+            if (it != entriesByLowercaseName.end())
+                return it->second;
+            else
+                return &entries.front();
+        }
+    };
+
+    Registry& getRegistry()
+    {
+        static Registry registry;
+        return registry;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetType::WidgetType() :
+        m_entry{&getRegistry().entries.front()}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetType::WidgetType(const std::string& name) :
+        m_entry{getRegistry().get(name)}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetType::WidgetType(const char* name) :
+        m_entry{getRegistry().get(name)}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetType::WidgetType(const priv::WidgetTypeEntry* entry) :
+        m_entry{entry}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int WidgetType::getId() const
+    {
+        return m_entry->id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& WidgetType::getName() const
+    {
+        return m_entry->name;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& WidgetType::getLowercaseName() const
+    {
+        return m_entry->lowercaseName;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetType WidgetType::findByLowercaseName(const std::string& lowercaseName)
+    {
+        return WidgetType{getRegistry().findLowercase(lowercaseName)};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int WidgetType::getTypeCount()
+    {
+        Registry& registry = getRegistry();
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        return static_cast<unsigned int>(registry.entries.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
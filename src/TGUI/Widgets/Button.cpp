@@ -242,6 +242,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage Button::getMemoryUsage() const
+    {
+        auto usage = ClickableWidget::getMemoryUsage();
+        usage.widget += sizeof(Button) - sizeof(ClickableWidget);
+
+        usage.text += priv::getHeapMemoryUsage(m_string);
+        usage += priv::getEmbeddedMemoryUsage(m_text);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Button::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setBorders({2, 2, 2, 2});
@@ -264,7 +276,10 @@ namespace tgui
 
             // The widget can only be focused when there is an image available for this phase
             if (getRenderer()->m_textureFocused.isLoaded())
+            {
                 m_allowFocus = true;
+                focusOrderChanged();
+            }
 
             if (force)
             {
@@ -469,6 +484,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage ButtonRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(ButtonRenderer);
+        usage.textures = priv::getHeapMemoryUsage(m_textureNormal)
+                       + priv::getHeapMemoryUsage(m_textureHover)
+                       + priv::getHeapMemoryUsage(m_textureDown)
+                       + priv::getHeapMemoryUsage(m_textureFocused)
+                       + priv::getHeapMemoryUsage(m_geometry);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ButtonRenderer::setTextColor(const Color& color)
     {
         setTextColorNormal(color);
@@ -520,6 +549,7 @@ namespace tgui
     void ButtonRenderer::setBackgroundColorNormal(const Color& color)
     {
         m_backgroundColorNormal = color;
+        m_geometry.invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -527,6 +557,7 @@ namespace tgui
     void ButtonRenderer::setBackgroundColorHover(const Color& color)
     {
         m_backgroundColorHover = color;
+        m_geometry.invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -534,6 +565,7 @@ namespace tgui
     void ButtonRenderer::setBackgroundColorDown(const Color& color)
     {
         m_backgroundColorDown = color;
+        m_geometry.invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -541,6 +573,7 @@ namespace tgui
     void ButtonRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+        m_geometry.invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -548,6 +581,7 @@ namespace tgui
     void ButtonRenderer::setNormalTexture(const Texture& texture)
     {
         m_textureNormal = texture;
+        m_geometry.invalidate();
         if (m_textureNormal.isLoaded())
         {
             m_textureNormal.setPosition(m_button->getPosition());
@@ -597,6 +631,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ButtonRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+        m_geometry.invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ButtonRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         // Check if there is a background texture
@@ -618,51 +660,34 @@ namespace tgui
             if (m_button->m_focused && m_textureFocused.isLoaded())
                 target.draw(m_textureFocused, states);
         }
-        else // There is no background texture
+
+        // The background color and borders are only recalculated when something changed since the previous frame
+        unsigned int state = 0;
+        if (m_button->m_mouseHover)
+            state = m_button->m_mouseDown ? 2 : 1;
+
+        if (m_geometry.update(m_button->getSize(), state, m_button->getOpacity()))
         {
-            sf::RectangleShape button(m_button->getSize());
-            button.setPosition(m_button->getPosition());
+            const sf::Vector2f size = m_button->getSize();
 
-            if (m_button->m_mouseHover)
+            // There is no background texture
+            if (!m_textureNormal.isLoaded())
             {
-                if (m_button->m_mouseDown)
-                    button.setFillColor(calcColorOpacity(m_backgroundColorDown, m_button->getOpacity()));
+                if (state == 2)
+                    m_geometry.addRect({0, 0}, size, calcColorOpacity(m_backgroundColorDown, m_button->getOpacity()));
+                else if (state == 1)
+                    m_geometry.addRect({0, 0}, size, calcColorOpacity(m_backgroundColorHover, m_button->getOpacity()));
                 else
-                    button.setFillColor(calcColorOpacity(m_backgroundColorHover, m_button->getOpacity()));
+                    m_geometry.addRect({0, 0}, size, calcColorOpacity(m_backgroundColorNormal, m_button->getOpacity()));
             }
-            else
-                button.setFillColor(calcColorOpacity(m_backgroundColorNormal, m_button->getOpacity()));
 
-            target.draw(button, states);
+            // The borders around the button
+            if (m_borders != Borders{0, 0, 0, 0})
+                m_geometry.addBorders({0, 0}, size, m_borders, calcColorOpacity(m_borderColor, m_button->getOpacity()));
         }
 
-        // Draw the borders around the button
-        if (m_borders != Borders{0, 0, 0, 0})
-        {
-            sf::Vector2f position = m_button->getPosition();
-            sf::Vector2f size = m_button->getSize();
-
-            // Draw left border
-            sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
-            border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
-            border.setFillColor(calcColorOpacity(m_borderColor, m_button->getOpacity()));
-            target.draw(border, states);
-
-            // Draw top border
-            border.setSize({size.x + m_borders.right, m_borders.top});
-            border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
-
-            // Draw right border
-            border.setSize({m_borders.right, size.y + m_borders.bottom});
-            border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
-
-            // Draw bottom border
-            border.setSize({size.x + m_borders.left, m_borders.bottom});
-            border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
-        }
+        states.transform.translate(m_button->getPosition());
+        target.draw(m_geometry, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
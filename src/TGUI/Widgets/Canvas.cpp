@@ -108,6 +108,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage Canvas::getMemoryUsage() const
+    {
+        auto usage = ClickableWidget::getMemoryUsage();
+        usage.widget += sizeof(Canvas) - sizeof(ClickableWidget);
+
+        usage.textures += m_renderTexture.getSize().x * m_renderTexture.getSize().y * 4;
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Canvas::draw(const sf::Drawable& drawable, const sf::RenderStates& states)
     {
         m_renderTexture.draw(drawable, states);
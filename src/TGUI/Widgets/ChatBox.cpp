@@ -773,6 +773,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage ChatBox::getMemoryUsage() const
+    {
+        auto usage = Widget::getMemoryUsage();
+        usage.widget += sizeof(ChatBox) - sizeof(Widget);
+
+        usage.widget += m_lines.size() * sizeof(Line);
+        for (const auto& line : m_lines)
+            usage.text += priv::getHeapMemoryUsage(line.text) + priv::getHeapMemoryUsage(line.string);
+
+        usage += priv::getOwnedMemoryUsage(m_scroll);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setBorders({2, 2, 2, 2});
@@ -939,6 +954,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage ChatBoxRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(ChatBoxRenderer);
+        usage.textures = priv::getHeapMemoryUsage(m_backgroundTexture);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBoxRenderer::setBorderColor(const Color& borderColor)
     {
         m_borderColor = borderColor;
@@ -521,6 +521,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage ChildWindow::getMemoryUsage() const
+    {
+        auto usage = Container::getMemoryUsage();
+        usage.widget += sizeof(ChildWindow) - sizeof(Container);
+
+        usage.textures += priv::getHeapMemoryUsage(m_iconTexture);
+        usage += priv::getEmbeddedMemoryUsage(m_titleText);
+        usage += priv::getOwnedMemoryUsage(m_closeButton);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChildWindow::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         m_closeButton->reload();
@@ -547,6 +560,10 @@ namespace tgui
                     getRenderer()->m_titleBarHeight = getRenderer()->m_textureTitleBar.getImageSize().y;
                     getRenderer()->m_textureTitleBar.setSize({getRenderer()->m_textureTitleBar.getSize().x, getRenderer()->m_titleBarHeight});
 
+                    // The child widgets moved together with the bottom of the title bar
+                    invalidateAbsolutePosition();
+                    getRenderer()->m_geometry.invalidate();
+
                     if (m_closeButton->getRenderer()->m_textureNormal.isLoaded())
                         m_closeButton->setSize(m_closeButton->getRenderer()->m_textureNormal.getImageSize());
                 }
@@ -633,14 +650,16 @@ namespace tgui
 
         states.transform.translate(getPosition().x + getRenderer()->m_borders.left, getPosition().y + getRenderer()->m_titleBarHeight + getRenderer()->m_borders.top);
 
-        // Draw the background
-        if (getRenderer()->m_backgroundColor != sf::Color::Transparent)
+        // Draw the background, it is only recalculated when something changed since the previous frame
+        const auto renderer = getRenderer();
+        if (renderer->m_backgroundGeometry.update(getSize(), 0, getOpacity()))
         {
-            sf::RectangleShape background(getSize());
-            background.setFillColor(calcColorOpacity(getRenderer()->m_backgroundColor, getOpacity()));
-            target.draw(background, states);
+            if (renderer->m_backgroundColor != sf::Color::Transparent)
+                renderer->m_backgroundGeometry.addRect({0, 0}, getSize(), calcColorOpacity(renderer->m_backgroundColor, getOpacity()));
         }
 
+        target.draw(renderer->m_backgroundGeometry, states);
+
         // Calculate the clipping area
         GLint scissorLeft = std::max(static_cast<GLint>(topLeftPanelPosition.x * scaleViewX), scissor[0]);
         GLint scissorTop = std::max(static_cast<GLint>(topLeftPanelPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
@@ -834,9 +853,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage ChildWindowRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(ChildWindowRenderer);
+        usage.text = priv::getHeapMemoryUsage(m_closeButtonClassName);
+        usage.textures = priv::getHeapMemoryUsage(m_textureTitleBar);
+        usage.renderer += priv::getHeapMemoryUsage(m_geometry) + priv::getHeapMemoryUsage(m_backgroundGeometry);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChildWindowRenderer::setTitleBarColor(const Color& color)
     {
         m_titleBarColor = color;
+        m_geometry.invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -844,6 +876,7 @@ namespace tgui
     void ChildWindowRenderer::setTitleBarHeight(float height)
     {
         m_titleBarHeight = height;
+        m_geometry.invalidate();
 
         // Set the size of the close button
         if (m_textureTitleBar.isLoaded() && m_childWindow->m_closeButton->getRenderer()->m_textureNormal.isLoaded())
@@ -876,6 +909,7 @@ namespace tgui
     void ChildWindowRenderer::setBorderColor(const Color& borderColor)
     {
         m_borderColor = borderColor;
+        m_geometry.invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -883,6 +917,7 @@ namespace tgui
     void ChildWindowRenderer::setBorders(const Borders& borders)
     {
         WidgetBorders::setBorders(borders);
+        m_geometry.invalidate();
 
         m_textureTitleBar.setSize({m_childWindow->getSize().x + borders.left + borders.right, m_titleBarHeight});
 
@@ -905,6 +940,7 @@ namespace tgui
     void ChildWindowRenderer::setBackgroundColor(const Color& backgroundColor)
     {
         m_backgroundColor = backgroundColor;
+        m_backgroundGeometry.invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -912,6 +948,8 @@ namespace tgui
     void ChildWindowRenderer::setTitleBarTexture(const Texture& texture)
     {
         m_textureTitleBar = texture;
+        m_geometry.invalidate();
+
         if (m_textureTitleBar.isLoaded())
         {
             m_textureTitleBar.setPosition(m_childWindow->getPosition());
@@ -933,47 +971,36 @@ namespace tgui
 
     void ChildWindowRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        // Draw the title bar
+        // Draw the title bar texture
         if (m_textureTitleBar.isLoaded())
             target.draw(m_textureTitleBar, states);
-        else
+
+        // The title bar color and the borders are only recalculated when something changed since the previous frame
+        if (m_geometry.update(m_childWindow->getSize(), 0, m_childWindow->getOpacity()))
         {
-            sf::RectangleShape titleBar{{m_childWindow->getSize().x + m_borders.left + m_borders.right, m_titleBarHeight}};
-            titleBar.setPosition({m_childWindow->getPosition().x, m_childWindow->getPosition().y});
-            titleBar.setFillColor(calcColorOpacity(m_titleBarColor, m_childWindow->getOpacity()));
-            target.draw(titleBar, states);
+            const sf::Vector2f size = m_childWindow->getSize();
+
+            if (!m_textureTitleBar.isLoaded())
+            {
+                m_geometry.addRect({0, 0}, {size.x + m_borders.left + m_borders.right, m_titleBarHeight},
+                                   calcColorOpacity(m_titleBarColor, m_childWindow->getOpacity()));
+            }
+
+            // The borders are placed below the title bar
+            if (m_borders != Borders{0, 0, 0, 0})
+            {
+                m_geometry.addBorders({m_borders.left, m_titleBarHeight + m_borders.top}, size, m_borders,
+                                      calcColorOpacity(m_borderColor, m_childWindow->getOpacity()));
+            }
         }
 
+        // The borders don't overlap with the title bar, so they can be drawn together before the close button
+        sf::RenderStates geometryStates = states;
+        geometryStates.transform.translate(m_childWindow->getPosition());
+        target.draw(m_geometry, geometryStates);
+
         // Draw the close button
         target.draw(*m_childWindow->m_closeButton, states);
-
-        // Draw the borders
-        if (m_borders != Borders{0, 0, 0, 0})
-        {
-            sf::Vector2f size = m_childWindow->getSize();
-            sf::Vector2f position = {m_childWindow->getPosition().x, m_childWindow->getPosition().y + m_titleBarHeight};
-
-            // Draw left border
-            sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
-            border.setPosition(position.x, position.y);
-            border.setFillColor(calcColorOpacity(m_borderColor, m_childWindow->getOpacity()));
-            target.draw(border, states);
-
-            // Draw top border
-            border.setSize({size.x + m_borders.right, m_borders.top});
-            border.setPosition(position.x + m_borders.left, position.y);
-            target.draw(border, states);
-
-            // Draw right border
-            border.setSize({m_borders.right, size.y + m_borders.bottom});
-            border.setPosition(position.x + size.x + m_borders.left, position.y + m_borders.top);
-            target.draw(border, states);
-
-            // Draw bottom border
-            border.setSize({size.x + m_borders.left, m_borders.bottom});
-            border.setPosition(position.x, position.y + size.y + m_borders.top);
-            target.draw(border, states);
-        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
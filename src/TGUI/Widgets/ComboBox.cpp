@@ -497,6 +497,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage ComboBox::getMemoryUsage() const
+    {
+        auto usage = Widget::getMemoryUsage();
+        usage.widget += sizeof(ComboBox) - sizeof(Widget);
+
+        usage += priv::getEmbeddedMemoryUsage(m_text);
+
+        // While the list is open it is part of a container and the memory is reported there
+        if (!m_listBox->getParent())
+            usage += priv::getOwnedMemoryUsage(m_listBox);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ComboBox::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         m_listBox->reload();
@@ -859,6 +874,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage ComboBoxRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(ComboBoxRenderer);
+        usage.textures = priv::getHeapMemoryUsage(m_backgroundTexture)
+                       + priv::getHeapMemoryUsage(m_textureArrowUpNormal)
+                       + priv::getHeapMemoryUsage(m_textureArrowUpHover)
+                       + priv::getHeapMemoryUsage(m_textureArrowDownNormal)
+                       + priv::getHeapMemoryUsage(m_textureArrowDownHover);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ComboBoxRenderer::setBackgroundColor(const Color& backgroundColor)
     {
         getListBox()->setBackgroundColor(backgroundColor);
@@ -30,10 +30,151 @@
 
 #include <SFML/OpenGL.hpp>
 
+#include <algorithm>
+#include <cctype>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    bool isDigit(sf::Uint32 character)
+    {
+        return (character >= '0') && (character <= '9');
+    }
+
+    bool isHexDigit(sf::Uint32 character)
+    {
+        return isDigit(character) || ((character >= 'a') && (character <= 'f')) || ((character >= 'A') && (character <= 'F'));
+    }
+
+    // Characters that have to be escaped inside a regex character class
+    bool isSpecialCharacter(sf::Uint32 character)
+    {
+        return (character == '\\') || (character == ']') || (character == '[') || (character == '^') || (character == '-');
+    }
+
+    // Adds a character to a regex character class. Only printable ascii characters are written directly, all other
+    // characters are written as \uXXXX (as UTF-16 surrogate pair when needed) so that the regex string remains ascii.
+    void appendRegexCharacter(std::string& regex, sf::Uint32 character)
+    {
+        if ((character >= 0x20) && (character < 0x7F))
+        {
+            if (isSpecialCharacter(character))
+                regex += '\\';
+            regex += static_cast<char>(character);
+            return;
+        }
+
+        auto appendCodeUnit = [&regex](sf::Uint32 codeUnit)
+            {
+                const char* digits = "0123456789ABCDEF";
+                regex += "\\u";
+                for (int shift = 12; shift >= 0; shift -= 4)
+                    regex += digits[(codeUnit >> shift) & 0xF];
+            };
+
+        if (character > 0xFFFF)
+        {
+            appendCodeUnit(0xD800 + ((character - 0x10000) >> 10));
+            appendCodeUnit(0xDC00 + ((character - 0x10000) & 0x3FF));
+        }
+        else
+            appendCodeUnit(character);
+    }
+
+    // Reads a \uXXXX escape sequence at the given position
+    bool parseCodeUnit(const std::string& regex, std::size_t& pos, sf::Uint32& codeUnit)
+    {
+        if ((pos + 6 > regex.size()) || (regex[pos] != '\\') || (regex[pos+1] != 'u'))
+            return false;
+
+        codeUnit = 0;
+        for (std::size_t i = pos + 2; i < pos + 6; ++i)
+        {
+            const auto digit = static_cast<unsigned char>(regex[i]);
+            if (!isHexDigit(digit))
+                return false;
+
+            if (isDigit(digit))
+                codeUnit = codeUnit * 16 + (digit - '0');
+            else
+                codeUnit = codeUnit * 16 + (std::tolower(digit) - 'a' + 10);
+        }
+
+        pos += 6;
+        return true;
+    }
+
+    // Recognizes a regex in the form that is created by setAllowedCharacters, which is how the character set is stored
+    // when the edit box is saved. The characters aren't sorted or made unique here.
+    bool parseCharacterSet(const std::string& regex, std::basic_string<sf::Uint32>& characters, std::size_t& maxLength)
+    {
+        if (regex.empty() || (regex[0] != '['))
+            return false;
+
+        characters.clear();
+        std::size_t pos = 1;
+        while ((pos < regex.size()) && (regex[pos] != ']'))
+        {
+            sf::Uint32 codeUnit;
+            if (parseCodeUnit(regex, pos, codeUnit))
+            {
+                if ((codeUnit >= 0xD800) && (codeUnit < 0xDC00))
+                {
+                    sf::Uint32 lowSurrogate;
+                    if (!parseCodeUnit(regex, pos, lowSurrogate) || (lowSurrogate < 0xDC00) || (lowSurrogate > 0xDFFF))
+                        return false;
+
+                    codeUnit = 0x10000 + ((codeUnit - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+                }
+
+                characters += codeUnit;
+            }
+            else if (regex[pos] == '\\')
+            {
+                if ((pos + 1 >= regex.size()) || !isSpecialCharacter(static_cast<unsigned char>(regex[pos+1])))
+                    return false;
+
+                characters += static_cast<unsigned char>(regex[pos+1]);
+                pos += 2;
+            }
+            else
+            {
+                // Unescaped special characters would give the class a different meaning, e.g. a range
+                const auto character = static_cast<unsigned char>(regex[pos]);
+                if (isSpecialCharacter(character) || (character < 0x20) || (character >= 0x7F))
+                    return false;
+
+                characters += character;
+                pos++;
+            }
+        }
+
+        if (pos >= regex.size())
+            return false;
+
+        const std::string quantifier = regex.substr(pos + 1);
+        if (quantifier == "*")
+        {
+            maxLength = 0;
+            return true;
+        }
+
+        if ((quantifier.size() < 5) || (quantifier.compare(0, 3, "{0,") != 0) || (quantifier.back() != '}'))
+            return false;
+
+        const std::string length = quantifier.substr(3, quantifier.size() - 4);
+        if (!std::all_of(length.begin(), length.end(), [](char c){ return isDigit(static_cast<unsigned char>(c)); }))
+            return false;
+
+        maxLength = static_cast<std::size_t>(std::stoul(length));
+        return maxLength > 0;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,6 +182,7 @@ namespace tgui
     std::string EditBox::Validator::Int   = "[+-]?[0-9]*";
     std::string EditBox::Validator::UInt  = "[0-9]*";
     std::string EditBox::Validator::Float = "[+-]?[0-9]*\\.?[0-9]*";
+    std::string EditBox::Validator::Hex   = "[0-9a-fA-F]*";
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -158,12 +300,12 @@ namespace tgui
         }
 
         // Change the text if allowed
-        if (m_regexString == ".*")
-            m_text = text;
-        else if (std::regex_match(text.toAnsiString(), m_regex))
-            m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
-        else // Clear the text
+        if (!isValidText(text))
             m_text = "";
+        else if (m_validatorType == ValidatorType::Regex)
+            m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
+        else
+            m_text = text;
 
         m_displayedText = m_text;
 
@@ -385,7 +527,60 @@ namespace tgui
     void EditBox::setInputValidator(const std::string& regex)
     {
         m_regexString = regex;
-        m_regex = m_regexString;
+        m_regex = std::regex{};
+        m_allowedCharacters.clear();
+        m_allowedLength = 0;
+
+        if (regex == ".*")
+            m_validatorType = ValidatorType::None;
+        else if (regex == Validator::Int)
+            m_validatorType = ValidatorType::Int;
+        else if (regex == Validator::UInt)
+            m_validatorType = ValidatorType::UInt;
+        else if (regex == Validator::Float)
+            m_validatorType = ValidatorType::Float;
+        else if (regex == Validator::Hex)
+            m_validatorType = ValidatorType::Hex;
+        else
+        {
+            // A character set is checked without regex, which also works for characters that don't fit in a char
+            std::basic_string<sf::Uint32> characters;
+            std::size_t maxLength;
+            if (parseCharacterSet(regex, characters, maxLength))
+            {
+                setAllowedCharacters(sf::String{characters}, maxLength);
+                m_regexString = regex;
+                return;
+            }
+
+            m_validatorType = ValidatorType::Regex;
+            m_regex = std::regex{m_regexString, std::regex::ECMAScript | std::regex::optimize};
+        }
+
+        setText(m_text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::setAllowedCharacters(const sf::String& allowedCharacters, std::size_t maxLength)
+    {
+        m_validatorType = ValidatorType::CharacterSet;
+        m_regex = std::regex{};
+        m_allowedLength = maxLength;
+
+        m_allowedCharacters = allowedCharacters.toUtf32();
+        std::sort(m_allowedCharacters.begin(), m_allowedCharacters.end());
+        m_allowedCharacters.erase(std::unique(m_allowedCharacters.begin(), m_allowedCharacters.end()), m_allowedCharacters.end());
+
+        // Build the regex that describes the same input, so that it can still be retrieved with getInputValidator
+        std::string characters;
+        for (const auto character : m_allowedCharacters)
+            appendRegexCharacter(characters, character);
+
+        if (maxLength > 0)
+            m_regexString = "[" + characters + "]{0," + std::to_string(maxLength) + "}";
+        else
+            m_regexString = "[" + characters + "]*";
 
         setText(m_text);
     }
@@ -674,8 +869,9 @@ namespace tgui
         }
         else if (event.code == sf::Keyboard::Return)
         {
-            m_callback.text = m_text;
-            sendSignal("ReturnKeyPressed", getText());
+            if (isCallbackBound("ReturnKeyPressed"))
+                m_callback.text = m_text;
+            sendSignal("ReturnKeyPressed", m_text);
         }
         else if (event.code == sf::Keyboard::BackSpace)
         {
@@ -714,8 +910,9 @@ namespace tgui
             m_caretVisible = true;
             m_animationTimeElapsed = {};
 
-            m_callback.text = m_text;
-            sendSignal("TextChanged", getText());
+            if (isCallbackBound("TextChanged"))
+                m_callback.text = m_text;
+            sendSignal("TextChanged", m_text);
         }
         else if (event.code == sf::Keyboard::Delete)
         {
@@ -753,8 +950,9 @@ namespace tgui
             m_caretVisible = true;
             m_animationTimeElapsed = {};
 
-            m_callback.text = m_text;
-            sendSignal("TextChanged", getText());
+            if (isCallbackBound("TextChanged"))
+                m_callback.text = m_text;
+            sendSignal("TextChanged", m_text);
         }
         else
         {
@@ -783,8 +981,9 @@ namespace tgui
 
                         setCaretPosition(oldCaretPos + clipboardContents.getSize());
 
-                        m_callback.text = m_text;
-                        sendSignal("TextChanged", getText());
+                        if (isCallbackBound("TextChanged"))
+                            m_callback.text = m_text;
+                        sendSignal("TextChanged", m_text);
                     }
                 }
                 else if (event.code == sf::Keyboard::X)
@@ -804,16 +1003,9 @@ namespace tgui
 
     void EditBox::textEntered(sf::Uint32 key)
     {
-        // Only add the character when the regex matches
-        if (m_regexString != ".*")
-        {
-            sf::String text = m_text;
-            text.insert(m_selEnd, key);
-
-            // The character has to match the regex
-            if (!std::regex_match(text.toAnsiString(), m_regex))
-                return;
-        }
+        // Only add the character when the input validator accepts it
+        if ((m_validatorType != ValidatorType::None) && !isValidInsertion(key, m_selEnd))
+            return;
 
         // If there are selected characters then delete them first
         if (m_selChars > 0)
@@ -855,8 +1047,9 @@ namespace tgui
         m_caretVisible = true;
         m_animationTimeElapsed = {};
 
-        m_callback.text = m_text;
-        sendSignal("TextChanged", getText());
+        if (isCallbackBound("TextChanged"))
+            m_callback.text = m_text;
+        sendSignal("TextChanged", m_text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -887,6 +1080,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage EditBox::getMemoryUsage() const
+    {
+        auto usage = ClickableWidget::getMemoryUsage();
+        usage.widget += sizeof(EditBox) - sizeof(ClickableWidget);
+
+        usage.text += priv::getHeapMemoryUsage(m_displayedText)
+                    + priv::getHeapMemoryUsage(m_text)
+                    + priv::getHeapMemoryUsage(m_textBeforeSelection)
+                    + priv::getHeapMemoryUsage(m_textSelection)
+                    + priv::getHeapMemoryUsage(m_textAfterSelection)
+                    + priv::getHeapMemoryUsage(m_textFull)
+                    + priv::getHeapMemoryUsage(m_defaultText);
+
+        usage.widget += priv::getHeapMemoryUsage(m_regexString) + m_allowedCharacters.capacity() * sizeof(sf::Uint32);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         m_textBeforeSelection.setColor({0, 0, 0});
@@ -1063,6 +1275,109 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool EditBox::isValidInsertion(sf::Uint32 key, std::size_t position) const
+    {
+        // The current text is always valid, so the predefined validators only have to look at the new character and
+        // where it is placed, instead of checking the entire text again.
+        switch (m_validatorType)
+        {
+            case ValidatorType::None:
+                return true;
+
+            case ValidatorType::Int:
+            case ValidatorType::Float:
+            {
+                const bool signInFront = !m_text.isEmpty() && ((m_text[0] == '+') || (m_text[0] == '-'));
+                if ((key == '+') || (key == '-'))
+                    return (position == 0) && !signInFront;
+
+                // Nothing can be placed in front of the sign
+                if ((position == 0) && signInFront)
+                    return false;
+
+                if (isDigit(key))
+                    return true;
+
+                // There can only be a single decimal point. Finding it requires a search, but only when typing a point.
+                if ((m_validatorType == ValidatorType::Float) && (key == '.'))
+                    return m_text.find('.') == sf::String::InvalidPos;
+
+                return false;
+            }
+
+            case ValidatorType::UInt:
+                return isDigit(key);
+
+            case ValidatorType::Hex:
+                return isHexDigit(key);
+
+            case ValidatorType::CharacterSet:
+                if ((m_allowedLength > 0) && (m_text.getSize() >= m_allowedLength))
+                    return false;
+
+                return std::binary_search(m_allowedCharacters.begin(), m_allowedCharacters.end(), key);
+
+            case ValidatorType::Regex:
+            default:
+            {
+                // A regex can't be checked incrementally, the text with the new character has to match as a whole
+                std::string text = m_text.toAnsiString();
+                text.insert(std::min(position, text.size()), sf::String{key}.toAnsiString());
+                return std::regex_match(text, m_regex);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool EditBox::isValidText(const sf::String& text) const
+    {
+        switch (m_validatorType)
+        {
+            case ValidatorType::None:
+                return true;
+
+            case ValidatorType::Int:
+            case ValidatorType::Float:
+            {
+                // Integers are treated as if they already contain a decimal point, so that no other point is accepted
+                bool decimalPointFound = (m_validatorType == ValidatorType::Int);
+                for (std::size_t i = 0; i < text.getSize(); ++i)
+                {
+                    if (isDigit(text[i]))
+                        continue;
+                    else if ((i == 0) && ((text[i] == '+') || (text[i] == '-')))
+                        continue;
+                    else if ((text[i] == '.') && !decimalPointFound)
+                        decimalPointFound = true;
+                    else
+                        return false;
+                }
+
+                return true;
+            }
+
+            case ValidatorType::UInt:
+                return std::all_of(text.begin(), text.end(), isDigit);
+
+            case ValidatorType::Hex:
+                return std::all_of(text.begin(), text.end(), isHexDigit);
+
+            case ValidatorType::CharacterSet:
+                if ((m_allowedLength > 0) && (text.getSize() > m_allowedLength))
+                    return false;
+
+                return std::all_of(text.begin(), text.end(), [this](sf::Uint32 character)
+                    { return std::binary_search(m_allowedCharacters.begin(), m_allowedCharacters.end(), character); });
+
+            case ValidatorType::Regex:
+            default:
+                return std::regex_match(text.toAnsiString(), m_regex);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::recalculateTextPositions()
     {
         Padding padding = getRenderer()->getScaledPadding();
@@ -1385,6 +1700,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage EditBoxRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(EditBoxRenderer);
+        usage.textures = priv::getHeapMemoryUsage(m_textureNormal)
+                       + priv::getHeapMemoryUsage(m_textureHover)
+                       + priv::getHeapMemoryUsage(m_textureFocused);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBoxRenderer::setPadding(const Padding& padding)
     {
         WidgetPadding::setPadding(padding);
@@ -25,6 +25,28 @@
 
 #include <TGUI/Widgets/Grid.hpp>
 
+#include <limits>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Returns where each row or column starts when each of them gets the extra space on both sides
+    std::vector<float> getCellStarts(const std::vector<float>& sizes, float extraSpace)
+    {
+        std::vector<float> starts(sizes.size());
+
+        float position = 0;
+        for (std::size_t i = 0; i < sizes.size(); ++i)
+        {
+            starts[i] = position;
+            position += sizes[i] + 2 * extraSpace;
+        }
+
+        return starts;
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -42,20 +64,14 @@ namespace tgui
         Container {gridToCopy},
         m_realSize{gridToCopy.m_realSize}
     {
-        const std::vector<Widget::Ptr>& widgets = gridToCopy.m_widgets;
+        // The cells are only calculated once after all widgets were placed in the grid
+        UpdateGuard guard{*this};
 
-        for (unsigned int row = 0; row < gridToCopy.m_gridWidgets.size(); ++row)
+        for (const auto& pair : gridToCopy.m_widgetCells)
         {
-            for (unsigned int col = 0; col < gridToCopy.m_gridWidgets[row].size(); ++col)
-            {
-                // Find the widget that belongs in this square
-                for (unsigned int i = 0; i < widgets.size(); ++i)
-                {
-                    // If a widget matches then add it to the grid
-                    if (widgets[i] == gridToCopy.m_gridWidgets[row][col])
-                        addWidget(m_widgets[i], row, col, gridToCopy.m_objBorders[row][col], gridToCopy.m_objAlignment[row][col]);
-                }
-            }
+            const Cell& cell = pair.second;
+            const std::size_t index = gridToCopy.m_widgetIndices.at(pair.first);
+            addWidget(m_widgets[index], cell.row, cell.column, gridToCopy.m_objBorders[cell.row][cell.column], gridToCopy.m_objAlignment[cell.row][cell.column]);
         }
     }
 
@@ -69,12 +85,14 @@ namespace tgui
             Grid temp{right};
             Container::operator=(right);
 
-            std::swap(m_gridWidgets,  temp.m_gridWidgets);
-            std::swap(m_objBorders,   temp.m_objBorders);
-            std::swap(m_objAlignment, temp.m_objAlignment);
-            std::swap(m_rowHeight,    temp.m_rowHeight);
-            std::swap(m_columnWidth,  temp.m_columnWidth);
-            std::swap(m_realSize,     temp.m_realSize);
+            std::swap(m_gridWidgets,      temp.m_gridWidgets);
+            std::swap(m_objBorders,       temp.m_objBorders);
+            std::swap(m_objAlignment,     temp.m_objAlignment);
+            std::swap(m_rowHeight,        temp.m_rowHeight);
+            std::swap(m_columnWidth,      temp.m_columnWidth);
+            std::swap(m_widgetCells,      temp.m_widgetCells);
+            std::swap(m_availSpaceOffset, temp.m_availSpaceOffset);
+            std::swap(m_realSize,         temp.m_realSize);
         }
 
         return *this;
@@ -105,52 +123,68 @@ namespace tgui
     {
         auto callbackIt = m_connectedCallbacks.find(widget);
         if (callbackIt != m_connectedCallbacks.end())
+        {
+            widget->disconnect(callbackIt->second);
             m_connectedCallbacks.erase(callbackIt);
+        }
 
-        // Find the widget in the grid
-        for (unsigned int row = 0; row < m_gridWidgets.size(); ++row)
+        auto cellIt = m_widgetCells.find(widget.get());
+        if (cellIt != m_widgetCells.end())
         {
-            for (unsigned int col = 0; col < m_gridWidgets[row].size(); ++col)
+            const unsigned int row = cellIt->second.row;
+            const unsigned int col = cellIt->second.column;
+            m_widgetCells.erase(cellIt);
+
+            // Remove the widget from the grid, the widgets behind it in the same row move one column to the left
+            m_gridWidgets[row].erase(m_gridWidgets[row].begin() + col);
+            m_objBorders[row].erase(m_objBorders[row].begin() + col);
+            m_objAlignment[row].erase(m_objAlignment[row].begin() + col);
+
+            for (unsigned int i = col; i < m_gridWidgets[row].size(); ++i)
             {
-                if (m_gridWidgets[row][col] == widget)
-                {
-                    // Remove the widget from the grid
-                    m_gridWidgets[row].erase(m_gridWidgets[row].begin() + col);
-                    m_objBorders[row].erase(m_objBorders[row].begin() + col);
-                    m_objAlignment[row].erase(m_objAlignment[row].begin() + col);
+                if (m_gridWidgets[row][i] != nullptr)
+                    m_widgetCells[m_gridWidgets[row][i].get()].column = i;
+            }
 
-                    // Check if this is the last column
-                    if (m_columnWidth.size() == m_gridWidgets[row].size() + 1)
+            // Check if this is the last column
+            if (m_columnWidth.size() == m_gridWidgets[row].size() + 1)
+            {
+                // Check if there is another row with this many columns
+                bool rowFound = false;
+                for (unsigned int i = 0; i < m_gridWidgets.size(); ++i)
+                {
+                    if (m_gridWidgets[i].size() >= m_columnWidth.size())
                     {
-                        // Check if there is another row with this many columns
-                        bool rowFound = false;
-                        for (unsigned int i = 0; i < m_gridWidgets.size(); ++i)
-                        {
-                            if (m_gridWidgets[i].size() >= m_columnWidth.size())
-                            {
-                                rowFound = true;
-                                break;
-                            }
-                        }
-
-                        // Erase the last column if no other row is using it
-                        if (!rowFound)
-                            m_columnWidth.erase(m_columnWidth.end()-1);
+                        rowFound = true;
+                        break;
                     }
+                }
+
+                // Erase the last column if no other row is using it
+                if (!rowFound)
+                    m_columnWidth.erase(m_columnWidth.end()-1);
+            }
+
+            // If the row is empty then remove it as well
+            if (m_gridWidgets[row].empty())
+            {
+                m_gridWidgets.erase(m_gridWidgets.begin() + row);
+                m_objBorders.erase(m_objBorders.begin() + row);
+                m_objAlignment.erase(m_objAlignment.begin() + row);
+                m_rowHeight.erase(m_rowHeight.begin() + row);
 
-                    // If the row is empty then remove it as well
-                    if (m_gridWidgets[row].empty())
+                for (unsigned int i = row; i < m_gridWidgets.size(); ++i)
+                {
+                    for (const auto& cellWidget : m_gridWidgets[i])
                     {
-                        m_gridWidgets.erase(m_gridWidgets.begin() + row);
-                        m_objBorders.erase(m_objBorders.begin() + row);
-                        m_objAlignment.erase(m_objAlignment.begin() + row);
-                        m_rowHeight.erase(m_rowHeight.begin() + row);
+                        if (cellWidget != nullptr)
+                            m_widgetCells[cellWidget.get()].row = i;
                     }
-
-                    // Update the positions of all remaining widgets
-                    updatePositionsOfAllWidgets();
                 }
             }
+
+            // The widgets that moved to another column may change the column widths
+            updateWidgets();
         }
 
         return Container::remove(widget);
@@ -160,6 +194,9 @@ namespace tgui
 
     void Grid::removeAllWidgets()
     {
+        for (const auto& pair : m_connectedCallbacks)
+            pair.first->disconnect(pair.second);
+
         m_gridWidgets.clear();
         m_objBorders.clear();
         m_objAlignment.clear();
@@ -168,6 +205,7 @@ namespace tgui
         m_columnWidth.clear();
 
         m_connectedCallbacks.clear();
+        m_widgetCells.clear();
 
         Container::removeAllWidgets();
 
@@ -180,9 +218,14 @@ namespace tgui
                          const Borders& borders, Alignment alignment)
     {
         // If the widget hasn't already been added then add it now
-        if (std::find(getWidgets().begin(), getWidgets().end(), widget) == getWidgets().end())
+        if (m_widgetIndices.find(widget.get()) == m_widgetIndices.end())
             add(widget);
 
+        // A widget can only be in one cell at a time
+        auto cellIt = m_widgetCells.find(widget.get());
+        if (cellIt != m_widgetCells.end())
+            m_gridWidgets[cellIt->second.row][cellIt->second.column] = nullptr;
+
         // Create the row if it did not exist yet
         if (m_gridWidgets.size() < row + 1)
         {
@@ -207,16 +250,25 @@ namespace tgui
         if (m_columnWidth.size() < col + 1)
             m_columnWidth.resize(col + 1, 0);
 
+        // A widget that was in the cell before remains in the container, but is no longer part of the grid
+        if ((m_gridWidgets[row][col] != nullptr) && (m_gridWidgets[row][col] != widget))
+            m_widgetCells.erase(m_gridWidgets[row][col].get());
+
         // Add the widget to the grid
         m_gridWidgets[row][col] = widget;
         m_objBorders[row][col] = borders;
         m_objAlignment[row][col] = alignment;
+        m_widgetCells[widget.get()] = {row, col};
 
         // Update the widgets
         updateWidgets();
 
         // Automatically update the widgets when their size changes
-        m_connectedCallbacks[widget] = widget->connect("SizeChanged", &Grid::updateWidgets, this);
+        if (m_connectedCallbacks.find(widget) == m_connectedCallbacks.end())
+        {
+            const Widget* widgetPtr = widget.get();
+            m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this, widgetPtr]{ updateCellSize(widgetPtr); });
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -233,30 +285,15 @@ namespace tgui
 
     void Grid::updateWidgets()
     {
-        // Reset the column widths
-        for (auto it = m_columnWidth.begin(); it != m_columnWidth.end(); ++it)
-            *it = 0;
-
-        // Loop through all widgets
-        for (unsigned int row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            // Reset the row height
-            m_rowHeight[row] = 0;
+        // Inside a batch started with beginUpdate, the grid is only updated once when the batch ends
+        if (postponeUpdate())
+            return;
 
-            for (unsigned int col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col].get() == nullptr)
-                    continue;
-
-                // Remember the biggest column width
-                if (m_columnWidth[col] < m_gridWidgets[row][col]->getFullSize().x + m_objBorders[row][col].left + m_objBorders[row][col].right)
-                    m_columnWidth[col] = m_gridWidgets[row][col]->getFullSize().x + m_objBorders[row][col].left + m_objBorders[row][col].right;
+        for (unsigned int col = 0; col < m_columnWidth.size(); ++col)
+            updateColumnWidth(col);
 
-                // Remember the biggest row height
-                if (m_rowHeight[row] < m_gridWidgets[row][col]->getFullSize().y + m_objBorders[row][col].top + m_objBorders[row][col].bottom)
-                    m_rowHeight[row] = m_gridWidgets[row][col]->getFullSize().y + m_objBorders[row][col].top + m_objBorders[row][col].bottom;
-            }
-        }
+        for (unsigned int row = 0; row < m_rowHeight.size(); ++row)
+            updateRowHeight(row);
 
         // Reposition all widgets
         updatePositionsOfAllWidgets();
@@ -266,113 +303,37 @@ namespace tgui
 
     void Grid::changeWidgetBorders(const Widget::Ptr& widget, const Borders& borders)
     {
-        // Find the widget in the grid
-        for (unsigned int row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (unsigned int col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                {
-                    // Change borders of the widget
-                    m_objBorders[row][col] = borders;
+        auto cellIt = m_widgetCells.find(widget.get());
+        if (cellIt == m_widgetCells.end())
+            return;
 
-                    // Update all widgets
-                    updateWidgets();
-                }
-            }
-        }
+        m_objBorders[cellIt->second.row][cellIt->second.column] = borders;
+        updateCellSize(widget.get());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Grid::changeWidgetAlignment(const Widget::Ptr& widget, Alignment alignment)
     {
-        // Find the widget in the grid
-        for (unsigned int row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (unsigned int col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                {
-                    // Change the alignment of the widget
-                    m_objAlignment[row][col] = alignment;
+        auto cellIt = m_widgetCells.find(widget.get());
+        if (cellIt == m_widgetCells.end())
+            return;
 
-                    // Recalculate the position of the widget
-                    {
-                        // Calculate the available space which is distributed when widgets are positionned.
-                        sf::Vector2f availableSpace;
-                        sf::Vector2f minSize = getMinSize();
-
-                        if (m_realSize.x > minSize.x)
-                            availableSpace.x = m_realSize.x - minSize.x;
-                        if (m_realSize.y > minSize.y)
-                            availableSpace.y = m_realSize.y - minSize.y;
-
-                        sf::Vector2f availSpaceOffset{0.5f * availableSpace.x / m_columnWidth.size(),
-                                                      0.5f * availableSpace.y / m_rowHeight.size()};
-
-                        float left = 0;
-                        float top = 0;
-
-                        for (unsigned int i = 0; i < row; ++i)
-                            top += m_rowHeight[i] + 2 * availSpaceOffset.y;
-
-                        for (unsigned int i = 0; i < col; ++i)
-                            left += m_columnWidth[i] + 2 * availSpaceOffset.x;
-
-                        switch (m_objAlignment[row][col])
-                        {
-                        case Alignment::UpperLeft:
-                            left += m_objBorders[row][col].left + availSpaceOffset.x;
-                            top += m_objBorders[row][col].top + availSpaceOffset.y;
-                            break;
-
-                        case Alignment::Up:
-                            left += m_objBorders[row][col].left + (((m_columnWidth[col] - m_objBorders[row][col].left - m_objBorders[row][col].right) - m_gridWidgets[row][col]->getFullSize().x) / 2.f) + availSpaceOffset.x;
-                            top += m_objBorders[row][col].top + availSpaceOffset.y;
-                            break;
-
-                        case Alignment::UpperRight:
-                            left += m_columnWidth[col] - m_objBorders[row][col].right - m_gridWidgets[row][col]->getFullSize().x + availSpaceOffset.x;
-                            top += m_objBorders[row][col].top + availSpaceOffset.y;
-                            break;
-
-                        case Alignment::Right:
-                            left += m_columnWidth[col] - m_objBorders[row][col].right - m_gridWidgets[row][col]->getFullSize().x + availSpaceOffset.x;
-                            top += m_objBorders[row][col].top + (((m_rowHeight[row] - m_objBorders[row][col].top - m_objBorders[row][col].bottom) - m_gridWidgets[row][col]->getFullSize().y) / 2.f) + availSpaceOffset.y;
-                            break;
-
-                        case Alignment::BottomRight:
-                            left += m_columnWidth[col] - m_objBorders[row][col].right - m_gridWidgets[row][col]->getFullSize().x + availSpaceOffset.x;
-                            top += m_rowHeight[row] - m_objBorders[row][col].bottom - m_gridWidgets[row][col]->getFullSize().y + availSpaceOffset.y;
-                            break;
-
-                        case Alignment::Bottom:
-                            left += m_objBorders[row][col].left + (((m_columnWidth[col] - m_objBorders[row][col].left - m_objBorders[row][col].right) - m_gridWidgets[row][col]->getFullSize().x) / 2.f) + availSpaceOffset.x;
-                            top += m_rowHeight[row] - m_objBorders[row][col].bottom - m_gridWidgets[row][col]->getFullSize().y + availSpaceOffset.y;
-                            break;
-
-                        case Alignment::BottomLeft:
-                            left += m_objBorders[row][col].left + availSpaceOffset.x;
-                            top += m_rowHeight[row] - m_objBorders[row][col].bottom - m_gridWidgets[row][col]->getFullSize().y + availSpaceOffset.y;
-                            break;
-
-                        case Alignment::Left:
-                            left += m_objBorders[row][col].left + availSpaceOffset.x;
-                            top += m_objBorders[row][col].top + (((m_rowHeight[row] - m_objBorders[row][col].top - m_objBorders[row][col].bottom) - m_gridWidgets[row][col]->getFullSize().y) / 2.f) + availSpaceOffset.y;
-                            break;
-
-                        case Alignment::Center:
-                            left += m_objBorders[row][col].left + (((m_columnWidth[col] - m_objBorders[row][col].left - m_objBorders[row][col].right) - m_gridWidgets[row][col]->getFullSize().x) / 2.f) + availSpaceOffset.x;
-                            top += m_objBorders[row][col].top + (((m_rowHeight[row] - m_objBorders[row][col].top - m_objBorders[row][col].bottom) - m_gridWidgets[row][col]->getFullSize().y) / 2.f) + availSpaceOffset.y;
-                            break;
-                        }
-
-                        m_gridWidgets[row][col]->setPosition({left, top});
-                    }
-                }
-            }
-        }
+        const unsigned int row = cellIt->second.row;
+        const unsigned int col = cellIt->second.column;
+        m_objAlignment[row][col] = alignment;
+
+        // Only the widget itself has to be moved
+        float left = 0;
+        float top = 0;
+
+        for (unsigned int i = 0; i < row; ++i)
+            top += m_rowHeight[i] + 2 * m_availSpaceOffset.y;
+
+        for (unsigned int i = 0; i < col; ++i)
+            left += m_columnWidth[i] + 2 * m_availSpaceOffset.x;
+
+        updateWidgetPosition(row, col, {left, top});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -397,101 +358,201 @@ namespace tgui
 
     void Grid::updatePositionsOfAllWidgets()
     {
-        sf::Vector2f position;
-        sf::Vector2f previousPosition;
+        if (postponeUpdate())
+            return;
+
+        updateAvailableSpace();
+
+        const std::vector<float> columnStarts = getCellStarts(m_columnWidth, m_availSpaceOffset.x);
+        const std::vector<float> rowStarts = getCellStarts(m_rowHeight, m_availSpaceOffset.y);
+
+        for (unsigned int row = 0; row < m_gridWidgets.size(); ++row)
+        {
+            for (unsigned int col = 0; col < m_gridWidgets[row].size(); ++col)
+            {
+                if (m_gridWidgets[row][col] != nullptr)
+                    updateWidgetPosition(row, col, {columnStarts[col], rowStarts[row]});
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updateCellSize(const Widget* widget)
+    {
+        // Inside a batch started with beginUpdate, the grid is only updated once when the batch ends
+        if (postponeUpdate())
+            return;
+
+        auto cellIt = m_widgetCells.find(widget);
+        if (cellIt == m_widgetCells.end())
+            return;
+
+        const unsigned int row = cellIt->second.row;
+        const unsigned int col = cellIt->second.column;
+
+        const float oldColumnWidth = m_columnWidth[col];
+        const float oldRowHeight = m_rowHeight[row];
+        updateColumnWidth(col);
+        updateRowHeight(row);
+
+        const bool columnChanged = (m_columnWidth[col] != oldColumnWidth);
+        const bool rowChanged = (m_rowHeight[row] != oldRowHeight);
+
+        // Recalculate the position of the widget
+        const sf::Vector2f oldAvailSpaceOffset = m_availSpaceOffset;
+        updateAvailableSpace();
+
+        // When the extra space per cell changed then every widget moves
+        if (m_availSpaceOffset != oldAvailSpaceOffset)
+        {
+            updatePositionsOfAllWidgets();
+            return;
+        }
+
+        const std::vector<float> columnStarts = getCellStarts(m_columnWidth, m_availSpaceOffset.x);
+        const std::vector<float> rowStarts = getCellStarts(m_rowHeight, m_availSpaceOffset.y);
+
+        if (!columnChanged && !rowChanged)
+        {
+            updateWidgetPosition(row, col, {columnStarts[col], rowStarts[row]});
+            return;
+        }
+
+        // The widgets in the changed row and column and the ones to the right of and below them have to be moved
+        const unsigned int firstRow = rowChanged ? row : static_cast<unsigned int>(m_gridWidgets.size());
+        const unsigned int firstColumn = columnChanged ? col : std::numeric_limits<unsigned int>::max();
+        for (unsigned int r = 0; r < m_gridWidgets.size(); ++r)
+        {
+            for (unsigned int c = (r >= firstRow) ? 0 : firstColumn; c < m_gridWidgets[r].size(); ++c)
+            {
+                if (m_gridWidgets[r][c] != nullptr)
+                    updateWidgetPosition(r, c, {columnStarts[c], rowStarts[r]});
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updateColumnWidth(unsigned int col)
+    {
+        m_columnWidth[col] = 0;
+        for (unsigned int row = 0; row < m_gridWidgets.size(); ++row)
+        {
+            if ((m_gridWidgets[row].size() <= col) || (m_gridWidgets[row][col] == nullptr))
+                continue;
+
+            // Remember the biggest column width
+            const float width = m_gridWidgets[row][col]->getFullSize().x + m_objBorders[row][col].left + m_objBorders[row][col].right;
+            if (m_columnWidth[col] < width)
+                m_columnWidth[col] = width;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updateRowHeight(unsigned int row)
+    {
+        m_rowHeight[row] = 0;
+        for (unsigned int col = 0; col < m_gridWidgets[row].size(); ++col)
+        {
+            if (m_gridWidgets[row][col] == nullptr)
+                continue;
+
+            // Remember the biggest row height
+            const float height = m_gridWidgets[row][col]->getFullSize().y + m_objBorders[row][col].top + m_objBorders[row][col].bottom;
+            if (m_rowHeight[row] < height)
+                m_rowHeight[row] = height;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Grid::updateAvailableSpace()
+    {
         // Calculate the size and the available space which will be distributed when widgets will be positionned.
         sf::Vector2f availableSpace;
         m_realSize = m_size.getValue();
         sf::Vector2f minSize = getMinSize();
 
-        if (getSize().x > minSize.x)
-            availableSpace.x = getSize().x - minSize.x;
+        if (m_realSize.x > minSize.x)
+            availableSpace.x = m_realSize.x - minSize.x;
         else
             m_realSize.x = minSize.x;
 
-        if (getSize().y > minSize.y)
-            availableSpace.y = getSize().y - minSize.y;
+        if (m_realSize.y > minSize.y)
+            availableSpace.y = m_realSize.y - minSize.y;
         else
             m_realSize.y = minSize.y;
 
-        sf::Vector2f availSpaceOffset{0.5f * availableSpace.x / m_columnWidth.size(),
-                                      0.5f * availableSpace.y / m_rowHeight.size()};
+        m_availSpaceOffset = {0.5f * availableSpace.x / m_columnWidth.size(),
+                              0.5f * availableSpace.y / m_rowHeight.size()};
+    }
 
-        // Loop through all rows
-        for (unsigned int row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            // Remember the current position
-            previousPosition = position;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Loop through all widgets in the row
-            for (unsigned int col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col].get() == nullptr)
-                {
-                    position.x += m_columnWidth[col] + 2 * availSpaceOffset.x;
-                    continue;
-                }
+    void Grid::updateWidgetPosition(unsigned int row, unsigned int col, sf::Vector2f cellPosition)
+    {
+        const Widget::Ptr& widget = m_gridWidgets[row][col];
+        const Borders& borders = m_objBorders[row][col];
+        const sf::Vector2f availSpaceOffset = m_availSpaceOffset;
 
-                sf::Vector2f cellPosition = position;
+        switch (m_objAlignment[row][col])
+        {
+        case Alignment::UpperLeft:
+            cellPosition.x += borders.left + availSpaceOffset.x;
+            cellPosition.y += borders.top + availSpaceOffset.y;
+            break;
+
+        case Alignment::Up:
+            cellPosition.x += borders.left + (((m_columnWidth[col] - borders.left - borders.right) - widget->getFullSize().x) / 2.f) + availSpaceOffset.x;
+            cellPosition.y += borders.top + availSpaceOffset.y;
+            break;
+
+        case Alignment::UpperRight:
+            cellPosition.x += m_columnWidth[col] - borders.right - widget->getFullSize().x + availSpaceOffset.x;
+            cellPosition.y += borders.top + availSpaceOffset.y;
+            break;
+
+        case Alignment::Right:
+            cellPosition.x += m_columnWidth[col] - borders.right - widget->getFullSize().x + availSpaceOffset.x;
+            cellPosition.y += borders.top + (((m_rowHeight[row] - borders.top - borders.bottom) - widget->getFullSize().y) / 2.f) + availSpaceOffset.y;
+            break;
+
+        case Alignment::BottomRight:
+            cellPosition.x += m_columnWidth[col] - borders.right - widget->getFullSize().x + availSpaceOffset.x;
+            cellPosition.y += m_rowHeight[row] - borders.bottom - widget->getFullSize().y + availSpaceOffset.y;
+            break;
+
+        case Alignment::Bottom:
+            cellPosition.x += borders.left + (((m_columnWidth[col] - borders.left - borders.right) - widget->getFullSize().x) / 2.f) + availSpaceOffset.x;
+            cellPosition.y += m_rowHeight[row] - borders.bottom - widget->getFullSize().y + availSpaceOffset.y;
+            break;
+
+        case Alignment::BottomLeft:
+            cellPosition.x += borders.left + availSpaceOffset.x;
+            cellPosition.y += m_rowHeight[row] - borders.bottom - widget->getFullSize().y + availSpaceOffset.y;
+            break;
+
+        case Alignment::Left:
+            cellPosition.x += borders.left + availSpaceOffset.x;
+            cellPosition.y += borders.top + (((m_rowHeight[row] - borders.top - borders.bottom) - widget->getFullSize().y) / 2.f) + availSpaceOffset.y;
+            break;
+
+        case Alignment::Center:
+            cellPosition.x += borders.left + (((m_columnWidth[col] - borders.left - borders.right) - widget->getFullSize().x) / 2.f) + availSpaceOffset.x;
+            cellPosition.y += borders.top + (((m_rowHeight[row] - borders.top - borders.bottom) - widget->getFullSize().y) / 2.f) + availSpaceOffset.y;
+            break;
+        }
 
-                // Place the next widget on the correct position
-                switch (m_objAlignment[row][col])
-                {
-                case Alignment::UpperLeft:
-                    cellPosition.x += m_objBorders[row][col].left + availSpaceOffset.x;
-                    cellPosition.y += m_objBorders[row][col].top + availSpaceOffset.y;
-                    break;
-
-                case Alignment::Up:
-                    cellPosition.x += m_objBorders[row][col].left + (((m_columnWidth[col] - m_objBorders[row][col].left - m_objBorders[row][col].right) - m_gridWidgets[row][col]->getFullSize().x) / 2.f) + availSpaceOffset.x;
-                    cellPosition.y += m_objBorders[row][col].top + availSpaceOffset.y;
-                    break;
-
-                case Alignment::UpperRight:
-                    cellPosition.x += m_columnWidth[col] - m_objBorders[row][col].right - m_gridWidgets[row][col]->getFullSize().x + availSpaceOffset.x;
-                    cellPosition.y += m_objBorders[row][col].top + availSpaceOffset.y;
-                    break;
-
-                case Alignment::Right:
-                    cellPosition.x += m_columnWidth[col] - m_objBorders[row][col].right - m_gridWidgets[row][col]->getFullSize().x + availSpaceOffset.x;
-                    cellPosition.y += m_objBorders[row][col].top + (((m_rowHeight[row] - m_objBorders[row][col].top - m_objBorders[row][col].bottom) - m_gridWidgets[row][col]->getFullSize().y) / 2.f) + availSpaceOffset.y;
-                    break;
-
-                case Alignment::BottomRight:
-                    cellPosition.x += m_columnWidth[col] - m_objBorders[row][col].right - m_gridWidgets[row][col]->getFullSize().x + availSpaceOffset.x;
-                    cellPosition.y += m_rowHeight[row] - m_objBorders[row][col].bottom - m_gridWidgets[row][col]->getFullSize().y + availSpaceOffset.y;
-                    break;
-
-                case Alignment::Bottom:
-                    cellPosition.x += m_objBorders[row][col].left + (((m_columnWidth[col] - m_objBorders[row][col].left - m_objBorders[row][col].right) - m_gridWidgets[row][col]->getFullSize().x) / 2.f) + availSpaceOffset.x;
-                    cellPosition.y += m_rowHeight[row] - m_objBorders[row][col].bottom - m_gridWidgets[row][col]->getFullSize().y + availSpaceOffset.y;
-                    break;
-
-                case Alignment::BottomLeft:
-                    cellPosition.x += m_objBorders[row][col].left + availSpaceOffset.x;
-                    cellPosition.y += m_rowHeight[row] - m_objBorders[row][col].bottom - m_gridWidgets[row][col]->getFullSize().y + availSpaceOffset.y;
-                    break;
-
-                case Alignment::Left:
-                    cellPosition.x += m_objBorders[row][col].left + availSpaceOffset.x;
-                    cellPosition.y += m_objBorders[row][col].top + (((m_rowHeight[row] - m_objBorders[row][col].top - m_objBorders[row][col].bottom) - m_gridWidgets[row][col]->getFullSize().y) / 2.f) + availSpaceOffset.y;
-                    break;
-
-                case Alignment::Center:
-                    cellPosition.x += m_objBorders[row][col].left + (((m_columnWidth[col] - m_objBorders[row][col].left - m_objBorders[row][col].right) - m_gridWidgets[row][col]->getFullSize().x) / 2.f) + availSpaceOffset.x;
-                    cellPosition.y += m_objBorders[row][col].top + (((m_rowHeight[row] - m_objBorders[row][col].top - m_objBorders[row][col].bottom) - m_gridWidgets[row][col]->getFullSize().y) / 2.f) + availSpaceOffset.y;
-                    break;
-                }
+        widget->setPosition(cellPosition);
+    }
 
-                m_gridWidgets[row][col]->setPosition(cellPosition);
-                position.x += m_columnWidth[col] + 2 * availSpaceOffset.x;
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Go to the next row
-            position = previousPosition;
-            position.y += m_rowHeight[row] + 2 * availSpaceOffset.y;
-        }
+    void Grid::applyPostponedUpdate()
+    {
+        updateWidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -503,6 +564,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage Grid::getMemoryUsage() const
+    {
+        auto usage = Container::getMemoryUsage();
+        usage.widget += sizeof(Grid) - sizeof(Container);
+
+        usage.widget += m_gridWidgets.capacity() * sizeof(std::vector<Widget::Ptr>)
+                      + m_objBorders.capacity() * sizeof(std::vector<Borders>)
+                      + m_objAlignment.capacity() * sizeof(std::vector<Alignment>)
+                      + (m_rowHeight.capacity() + m_columnWidth.capacity()) * sizeof(float)
+                      + m_connectedCallbacks.size() * (priv::MapNodeOverhead + sizeof(decltype(m_connectedCallbacks)::value_type))
+                      + m_widgetCells.bucket_count() * sizeof(void*)
+                      + m_widgetCells.size() * (2 * sizeof(void*) + sizeof(decltype(m_widgetCells)::value_type));
+
+        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        {
+            usage.widget += m_gridWidgets[row].capacity() * sizeof(Widget::Ptr)
+                          + m_objBorders[row].capacity() * sizeof(Borders)
+                          + m_objAlignment[row].capacity() * sizeof(Alignment);
+        }
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Grid::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
@@ -430,6 +430,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage Knob::getMemoryUsage() const
+    {
+        auto usage = Widget::getMemoryUsage();
+        usage.widget += sizeof(Knob) - sizeof(Widget);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Knob::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setBorders(5, 5, 5, 5);
@@ -581,6 +590,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage KnobRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(KnobRenderer);
+        usage.textures = priv::getHeapMemoryUsage(m_backgroundTexture)
+                       + priv::getHeapMemoryUsage(m_foregroundTexture);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void KnobRenderer::setImageRotation(float rotation)
     {
         m_imageRotation = rotation;
@@ -33,6 +33,30 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Characters that can be shown in numeric mode, the space is used for all other characters
+    const char numericCharacters[] = "0123456789+-.,:% ";
+    const unsigned char numericSpaceIndex = sizeof(numericCharacters) - 2;
+    const unsigned char numericNoGlyph = 255;
+
+    unsigned char findNumericGlyph(sf::Uint32 character)
+    {
+        if ((character >= '0') && (character <= '9'))
+            return static_cast<unsigned char>(character - '0');
+
+        for (unsigned char i = 10; i < numericSpaceIndex; ++i)
+        {
+            if (static_cast<sf::Uint32>(numericCharacters[i]) == character)
+                return i;
+        }
+
+        return numericSpaceIndex;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,6 +75,71 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Label::Label(const Label& copy) :
+        ClickableWidget        {copy},
+        m_background           {copy.m_background},
+        m_string               {copy.m_string},
+        m_lines                (copy.m_lines),
+        m_textSize             {copy.m_textSize},
+        m_textStyle            {copy.m_textStyle},
+        m_horizontalAlignment  {copy.m_horizontalAlignment},
+        m_verticalAlignment    {copy.m_verticalAlignment},
+        m_autoSize             {copy.m_autoSize},
+        m_maximumTextWidth     {copy.m_maximumTextWidth},
+        m_possibleDoubleClick  {copy.m_possibleDoubleClick},
+        m_numericCharacterCount{copy.m_numericCharacterCount},
+        m_numericGlyphs        (copy.m_numericGlyphs),
+        m_numericCells         (copy.m_numericCells),
+        m_numericVertices      {copy.m_numericVertices},
+        m_numericCellWidth     {copy.m_numericCellWidth},
+        m_numericTextPosition  {copy.m_numericTextPosition}
+    {
+        // The copy isn't known by the TextLayoutBatch that postponed the original, so its text is laid out right away
+        if (copy.m_textLayoutPending)
+            rearrangeText();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Label& Label::operator= (const Label& right)
+    {
+        if (this != &right)
+        {
+            // The text that was waiting to be laid out is replaced
+            if (m_textLayoutPending)
+            {
+                m_textLayoutPending = false;
+                TextLayoutBatch::cancel(this);
+            }
+
+            ClickableWidget::operator=(right);
+
+            m_background            = right.m_background;
+            m_string                = right.m_string;
+            m_lines                 = right.m_lines;
+            m_textSize              = right.m_textSize;
+            m_textStyle             = right.m_textStyle;
+            m_horizontalAlignment   = right.m_horizontalAlignment;
+            m_verticalAlignment     = right.m_verticalAlignment;
+            m_autoSize              = right.m_autoSize;
+            m_maximumTextWidth      = right.m_maximumTextWidth;
+            m_possibleDoubleClick   = right.m_possibleDoubleClick;
+            m_numericCharacterCount = right.m_numericCharacterCount;
+            m_numericGlyphs         = right.m_numericGlyphs;
+            m_numericCells          = right.m_numericCells;
+            m_numericVertices       = right.m_numericVertices;
+            m_numericCellWidth      = right.m_numericCellWidth;
+            m_numericTextPosition   = right.m_numericTextPosition;
+
+            if (right.m_textLayoutPending)
+                rearrangeText();
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Label::Ptr Label::copy(Label::ConstPtr label)
     {
         if (label)
@@ -61,6 +150,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Label::~Label()
+    {
+        if (m_textLayoutPending)
+            TextLayoutBatch::cancel(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::setPosition(const Layout2d& position)
     {
         Widget::setPosition(position);
@@ -74,8 +171,9 @@ namespace tgui
 
             if (m_verticalAlignment != VerticalAlignment::Top)
             {
+                const std::size_t lineCount = (m_numericCharacterCount > 0) ? 1 : m_lines.size();
                 float totalHeight = getSize().y - getRenderer()->getPadding().top - getRenderer()->getPadding().bottom;
-                float totalTextHeight = m_lines.size() * getFont()->getLineSpacing(m_textSize);
+                float totalTextHeight = lineCount * getFont()->getLineSpacing(m_textSize);
 
                 if (m_verticalAlignment == VerticalAlignment::Center)
                     pos.y += (totalHeight - totalTextHeight) / 2.f;
@@ -83,7 +181,18 @@ namespace tgui
                     pos.y += totalHeight - totalTextHeight;
             }
 
-            if (m_horizontalAlignment == HorizontalAlignment::Left)
+            if (m_numericCharacterCount > 0)
+            {
+                float totalWidth = getSize().x - getRenderer()->getPadding().left - getRenderer()->getPadding().right;
+                float textWidth = m_numericCharacterCount * m_numericCellWidth;
+
+                m_numericTextPosition = {pos.x, std::floor(pos.y)};
+                if (m_horizontalAlignment == HorizontalAlignment::Center)
+                    m_numericTextPosition.x = std::round(pos.x + (totalWidth - textWidth) / 2.f);
+                else if (m_horizontalAlignment == HorizontalAlignment::Right)
+                    m_numericTextPosition.x = std::round(pos.x + totalWidth - textWidth);
+            }
+            else if (m_horizontalAlignment == HorizontalAlignment::Left)
             {
                 for (auto& line : m_lines)
                 {
@@ -132,6 +241,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Vector2f Label::getSize() const
+    {
+        // The label is never const when it is pending, the function is only const because the size doesn't change from
+        // the outside: it just gets the value that it would have had without a TextLayoutBatch.
+        if (m_textLayoutPending)
+        {
+            Label* label = const_cast<Label*>(this);
+            const float maxWidth = label->getTextMaxWidth();
+            label->applyTextLayout(priv::wrapText(m_string, maxWidth, *getFont(), m_textSize, (m_textStyle & sf::Text::Bold) != 0), maxWidth);
+        }
+
+        return ClickableWidget::getSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     sf::Vector2f Label::getFullSize() const
     {
         return {getSize().x + getRenderer()->getBorders().left + getRenderer()->getBorders().right,
@@ -150,6 +275,12 @@ namespace tgui
 
     void Label::setText(const sf::String& string)
     {
+        if (m_numericCharacterCount > 0)
+        {
+            updateDigits(string);
+            return;
+        }
+
         m_string = string;
         rearrangeText();
     }
@@ -177,6 +308,10 @@ namespace tgui
     void Label::setHorizontalAlignment(HorizontalAlignment alignment)
     {
         m_horizontalAlignment = alignment;
+
+        if (m_numericCharacterCount > 0)
+            updateNumericCells();
+
         updatePosition();
     }
 
@@ -265,6 +400,38 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Label::setNumericMode(unsigned int characterCount)
+    {
+        if (m_numericCharacterCount == characterCount)
+            return;
+
+        m_numericCharacterCount = characterCount;
+        if (characterCount == 0)
+        {
+            m_numericGlyphs.clear();
+            m_numericCells.clear();
+            m_numericVertices.clear();
+        }
+
+        rearrangeText();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Label::updateDigits(const sf::String& text)
+    {
+        if (m_numericCharacterCount == 0)
+        {
+            setText(text);
+            return;
+        }
+
+        m_string = text;
+        updateNumericCells();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::setOpacity(float opacity)
     {
         Widget::setOpacity(opacity);
@@ -273,6 +440,8 @@ namespace tgui
         for (auto& line : m_lines)
             line.setColor(textColor);
 
+        updateNumericColor();
+
         m_background.setFillColor(calcColorOpacity(getRenderer()->m_backgroundColor, getOpacity()));
     }
 
@@ -320,6 +489,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage Label::getMemoryUsage() const
+    {
+        auto usage = ClickableWidget::getMemoryUsage();
+        usage.widget += sizeof(Label) - sizeof(ClickableWidget);
+
+        usage.text += priv::getHeapMemoryUsage(m_string) + priv::getHeapMemoryUsage(m_lines);
+        usage.text += m_numericGlyphs.capacity() * sizeof(NumericGlyph) + m_numericCells.capacity()
+                    + m_numericVertices.getVertexCount() * sizeof(sf::Vertex);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setBackgroundColor(sf::Color::Transparent);
@@ -351,111 +533,71 @@ namespace tgui
         if (!getFont())
             return;
 
-        // Find the maximum width of one line
-        float maxWidth = 0;
-        if (m_autoSize)
-            maxWidth = m_maximumTextWidth;
-        else if (getSize().x > getRenderer()->getPadding().left + getRenderer()->getPadding().right)
-            maxWidth = getSize().x - getRenderer()->getPadding().left - getRenderer()->getPadding().right;
-
-        m_lines.clear();
-        unsigned int index = 0;
-        unsigned int lineCount = 0;
-        float calculatedLabelWidth = 0;
-        bool bold = (m_textStyle & sf::Text::Bold) != 0;
-        while (index < m_string.getSize())
+        // Numeric mode doesn't wrap the text, it is cheap enough to not be postponed
+        if (m_numericCharacterCount > 0)
         {
-            lineCount++;
-            unsigned int oldIndex = index;
-
-            float width = 0;
-            sf::Uint32 prevChar = 0;
-            for (std::size_t i = index; i < m_string.getSize(); ++i)
-            {
-                float charWidth;
-                sf::Uint32 curChar = m_string[i];
-                if (curChar == '\n')
-                {
-                    index++;
-                    break;
-                }
-                else if (curChar == '\t')
-                    charWidth = static_cast<float>(getFont()->getGlyph(' ', m_textSize, bold).textureRect.width) * 4;
-                else
-                    charWidth = static_cast<float>(getFont()->getGlyph(curChar, m_textSize, bold).textureRect.width);
+            applyNumericLayout();
+            return;
+        }
 
-                float kerning = static_cast<float>(getFont()->getKerning(prevChar, curChar, m_textSize));
-                if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
-                {
-                    if (curChar == '\t')
-                        width += (static_cast<float>(getFont()->getGlyph(' ', m_textSize, bold).advance) * 4) + kerning;
-                    else
-                        width += static_cast<float>(getFont()->getGlyph(curChar, m_textSize, bold).advance) + kerning;
+        // Inside a TextLayoutBatch, labels in a container are rearranged later together with the other labels
+        if (m_parent && TextLayoutBatch::postpone(this))
+        {
+            m_textLayoutPending = true;
+            return;
+        }
 
-                    index++;
-                }
-                else
-                    break;
+        const float maxWidth = getTextMaxWidth();
+        applyTextLayout(priv::wrapText(m_string, maxWidth, *getFont(), m_textSize, (m_textStyle & sf::Text::Bold) != 0), maxWidth);
+    }
 
-                prevChar = curChar;
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            calculatedLabelWidth = std::max(calculatedLabelWidth, width);
+    float Label::getTextMaxWidth() const
+    {
+        // The size is accessed directly, calling getSize here could lay out the text while the width is being calculated
+        const sf::Vector2f size = ClickableWidget::getSize();
 
-            // Every line contains at least one character
-            if (index == oldIndex)
-                index++;
+        if (m_autoSize)
+            return m_maximumTextWidth;
+        else if (size.x > getRenderer()->getPadding().left + getRenderer()->getPadding().right)
+            return size.x - getRenderer()->getPadding().left - getRenderer()->getPadding().right;
+        else
+            return 0;
+    }
 
-            // Implement the word-wrap
-            if (m_string[index-1] != '\n')
-            {
-                unsigned int indexWithoutWordWrap = index;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                if ((index < m_string.getSize()) && (!isWhitespace(m_string[index])))
-                {
-                    unsigned int wordWrapCorrection = 0;
-                    while ((index > oldIndex) && (!isWhitespace(m_string[index - 1])))
-                    {
-                        wordWrapCorrection++;
-                        index--;
-                    }
-
-                    // The word can't be split but there is no other choice, it does not fit on the line
-                    if ((index - oldIndex) <= wordWrapCorrection)
-                        index = indexWithoutWordWrap;
-                }
-            }
+    void Label::applyTextLayout(const priv::TextLayoutResult& layout, float maxWidth)
+    {
+        if (m_textLayoutPending)
+        {
+            m_textLayoutPending = false;
+            TextLayoutBatch::cancel(this);
+        }
 
-            // Add the next line
+        m_lines.clear();
+        m_lines.reserve(layout.lines.size());
+        for (const auto& line : layout.lines)
+        {
             m_lines.emplace_back();
             m_lines.back().setFont(*getFont());
             m_lines.back().setCharacterSize(getTextSize());
             m_lines.back().setStyle(getTextStyle());
             m_lines.back().setColor(calcColorOpacity(getRenderer()->m_textColor, getOpacity()));
 
-            if ((index < m_string.getSize()) && (m_string[index-1] != '\n'))
-                m_lines.back().setString(m_string.substring(oldIndex, index - oldIndex) + "\n");
+            if (line.wrapped)
+                m_lines.back().setString(m_string.substring(line.start, line.length) + "\n");
             else
-                m_lines.back().setString(m_string.substring(oldIndex, index - oldIndex));
-
-            // If the next line starts with just a space, then the space need not be visible
-            if ((index < m_string.getSize()) && (m_string[index] == ' '))
-            {
-                if ((index == 0) || (!isWhitespace(m_string[index-1])))
-                {
-                    // But two or more spaces indicate that it is not a normal text and the spaces should not be ignored
-                    if (((index + 1 < m_string.getSize()) && (!isWhitespace(m_string[index + 1]))) || (index + 1 == m_string.getSize()))
-                        index++;
-                }
-            }
+                m_lines.back().setString(m_string.substring(line.start, line.length));
         }
 
         // There is always at least one line
-        lineCount = std::max(1u, lineCount);
+        const std::size_t lineCount = std::max<std::size_t>(1, layout.lines.size());
 
         if (m_autoSize)
         {
-            m_size = {std::max(calculatedLabelWidth, maxWidth) + getRenderer()->getPadding().left + getRenderer()->getPadding().right,
+            m_size = {std::max(layout.width, maxWidth) + getRenderer()->getPadding().left + getRenderer()->getPadding().right,
                       (lineCount * getFont()->getLineSpacing(m_textSize)) + getRenderer()->getPadding().top + getRenderer()->getPadding().bottom};
 
             m_background.setSize(getSize());
@@ -466,6 +608,128 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Label::applyNumericLayout()
+    {
+        if (m_textLayoutPending)
+        {
+            m_textLayoutPending = false;
+            TextLayoutBatch::cancel(this);
+        }
+
+        m_lines.clear();
+
+        const auto font = getFont();
+        const bool bold = (m_textStyle & sf::Text::Bold) != 0;
+
+        m_numericGlyphs.clear();
+        m_numericCellWidth = 0;
+        for (const char* character = numericCharacters; *character; ++character)
+        {
+            const sf::Glyph& glyph = font->getGlyph(static_cast<sf::Uint32>(*character), m_textSize, bold);
+            m_numericGlyphs.push_back({glyph.bounds, sf::FloatRect{glyph.textureRect}, glyph.advance});
+            m_numericCellWidth = std::max(m_numericCellWidth, glyph.advance);
+        }
+
+        m_numericCells.assign(m_numericCharacterCount, numericNoGlyph);
+        m_numericVertices.resize(m_numericCharacterCount * 6);
+        updateNumericColor();
+        updateNumericCells();
+
+        if (m_autoSize)
+        {
+            m_size = {(m_numericCharacterCount * m_numericCellWidth) + getRenderer()->getPadding().left + getRenderer()->getPadding().right,
+                      getFont()->getLineSpacing(m_textSize) + getRenderer()->getPadding().top + getRenderer()->getPadding().bottom};
+
+            m_background.setSize(getSize());
+        }
+
+        updatePosition();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Label::updateNumericCells()
+    {
+        if (m_numericGlyphs.empty())
+            return;
+
+        // Find out in which cells the text starts, depending on the horizontal alignment
+        const std::size_t length = std::min<std::size_t>(m_string.getSize(), m_numericCharacterCount);
+        std::size_t firstCell = 0;
+        if (m_horizontalAlignment == HorizontalAlignment::Center)
+            firstCell = (m_numericCharacterCount - length) / 2;
+        else if (m_horizontalAlignment == HorizontalAlignment::Right)
+            firstCell = m_numericCharacterCount - length;
+
+        // The baseline is placed at the same height as where sf::Text would put it
+        const float baseline = static_cast<float>(m_textSize);
+        for (std::size_t cell = 0; cell < m_numericCharacterCount; ++cell)
+        {
+            unsigned char glyphIndex = numericSpaceIndex;
+            if ((cell >= firstCell) && (cell < firstCell + length))
+                glyphIndex = findNumericGlyph(m_string[cell - firstCell]);
+
+            if (m_numericCells[cell] == glyphIndex)
+                continue;
+
+            m_numericCells[cell] = glyphIndex;
+
+            // Glyphs are centered inside their cell
+            const NumericGlyph& glyph = m_numericGlyphs[glyphIndex];
+            const float x = std::round(cell * m_numericCellWidth + (m_numericCellWidth - glyph.advance) / 2.f);
+
+            const float left = x + glyph.bounds.left;
+            const float top = baseline + glyph.bounds.top;
+            const float right = left + glyph.bounds.width;
+            const float bottom = top + glyph.bounds.height;
+
+            const float u1 = glyph.textureRect.left;
+            const float v1 = glyph.textureRect.top;
+            const float u2 = glyph.textureRect.left + glyph.textureRect.width;
+            const float v2 = glyph.textureRect.top + glyph.textureRect.height;
+
+            sf::Vertex* quad = &m_numericVertices[cell * 6];
+            quad[0].position = {left, top};     quad[0].texCoords = {u1, v1};
+            quad[1].position = {right, top};    quad[1].texCoords = {u2, v1};
+            quad[2].position = {left, bottom};  quad[2].texCoords = {u1, v2};
+            quad[3].position = {left, bottom};  quad[3].texCoords = {u1, v2};
+            quad[4].position = {right, top};    quad[4].texCoords = {u2, v1};
+            quad[5].position = {right, bottom}; quad[5].texCoords = {u2, v2};
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Label::updateNumericColor()
+    {
+        const sf::Color textColor = calcColorOpacity(getRenderer()->m_textColor, getOpacity());
+        for (std::size_t i = 0; i < m_numericVertices.getVertexCount(); ++i)
+            m_numericVertices[i].color = textColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Label::drawText(sf::RenderTarget& target, const sf::RenderStates& states) const
+    {
+        if (m_numericCharacterCount > 0)
+        {
+            if (m_numericVertices.getVertexCount() == 0)
+                return;
+
+            sf::RenderStates textStates = states;
+            textStates.texture = &getFont()->getTexture(m_textSize);
+            textStates.transform.translate(m_numericTextPosition);
+            target.draw(m_numericVertices, textStates);
+        }
+        else
+        {
+            for (auto& line : m_lines)
+                target.draw(line, states);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         if (m_autoSize)
@@ -475,8 +739,7 @@ namespace tgui
                 target.draw(m_background, states);
 
             // Draw the text
-            for (auto& line : m_lines)
-                target.draw(line, states);
+            drawText(target, states);
         }
         else
         {
@@ -516,8 +779,7 @@ namespace tgui
             glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
 
             // Draw the text
-            for (auto& line : m_lines)
-                target.draw(line, states);
+            drawText(target, states);
 
             // Reset the old clipping area
             glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
@@ -611,6 +873,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage LabelRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(LabelRenderer);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void LabelRenderer::setPadding(const Padding& padding)
     {
         if (padding != getPadding())
@@ -629,6 +900,8 @@ namespace tgui
         sf::Color textColor = calcColorOpacity(m_textColor, m_label->getOpacity());
         for (auto& line : m_label->m_lines)
             line.setColor(textColor);
+
+        m_label->updateNumericColor();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
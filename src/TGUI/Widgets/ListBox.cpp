@@ -79,6 +79,9 @@ namespace tgui
             ListBox temp(right);
             Widget::operator=(right);
 
+            // A pending sort would reorder the items that are being replaced
+            m_sortTask.cancel();
+
             std::swap(m_items,               temp.m_items);
             std::swap(m_itemIds,             temp.m_itemIds);
             std::swap(m_selectedItem,        temp.m_selectedItem);
@@ -203,6 +206,9 @@ namespace tgui
                     m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getLowValue());
             }
 
+            // The result of a pending sort wouldn't include the new item
+            m_sortTask.cancel();
+
             // Create the new item
             Label newItem;
             newItem.setFont(getFont());
@@ -326,6 +332,8 @@ namespace tgui
         if (index >= m_items.size())
             return false;
 
+        m_sortTask.cancel();
+
         // Remove the item
         m_items.erase(m_items.begin() + index);
         m_itemIds.erase(m_itemIds.begin() + index);
@@ -360,6 +368,8 @@ namespace tgui
 
     void ListBox::removeAllItems()
     {
+        m_sortTask.cancel();
+
         // Clear the list, remove all items
         m_items.clear();
         m_itemIds.clear();
@@ -464,6 +474,34 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListBox::sortItems(const std::function<bool(const sf::String&, const sf::String&)>& comparator)
+    {
+        if (!comparator)
+        {
+            m_sortTask.cancel();
+            return;
+        }
+
+        // The labels can't be used on the worker thread, so it gets its own copy of the texts
+        auto texts = std::make_shared<std::vector<sf::String>>();
+        texts->reserve(m_items.size());
+        for (const auto& item : m_items)
+            texts->push_back(item.getText());
+
+        m_sortTask.start(texts->size(), nullptr, [texts, comparator](std::size_t left, std::size_t right){
+            return comparator((*texts)[left], (*texts)[right]);
+        });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::isSortPending() const
+    {
+        return m_sortTask.isPending();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::setScrollbar(Scrollbar::Ptr scrollbar)
     {
         m_scroll = scrollbar;
@@ -674,7 +712,7 @@ namespace tgui
                 {
                     m_callback.text  = "";
                     m_callback.itemId = "";
-                    sendSignal("ItemSelected", "", "", "");
+                    sendSignal("ItemSelected", sf::String{}, sf::String{}, sf::String{});
                 }
             }
         }
@@ -842,7 +880,7 @@ namespace tgui
                     {
                         m_callback.text = "";
                         m_callback.itemId = "";
-                        sendSignal("ItemSelected", "", "", "");
+                        sendSignal("ItemSelected", sf::String{}, sf::String{}, sf::String{});
                     }
                 }
             }
@@ -930,6 +968,53 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListBox::applyItemOrder(const std::vector<std::size_t>& order)
+    {
+        std::vector<Label> items;
+        std::vector<sf::String> itemIds;
+        items.reserve(order.size());
+        itemIds.reserve(order.size());
+
+        int selectedItem = -1;
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            items.push_back(std::move(m_items[order[i]]));
+            itemIds.push_back(std::move(m_itemIds[order[i]]));
+
+            if (static_cast<int>(order[i]) == m_selectedItem)
+                selectedItem = static_cast<int>(i);
+        }
+
+        m_items = std::move(items);
+        m_itemIds = std::move(itemIds);
+        m_selectedItem = selectedItem;
+
+        // A different item is now below the mouse, it will be found again when the mouse moves
+        m_hoveringItem = -1;
+
+        updateItemColors();
+        updatePosition();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MemoryUsage ListBox::getMemoryUsage() const
+    {
+        auto usage = Widget::getMemoryUsage();
+        usage.widget += sizeof(ListBox) - sizeof(Widget);
+
+        // Every item is a complete label with its own renderer and signals
+        usage.widget += m_items.capacity() * sizeof(Label);
+        for (const auto& item : m_items)
+            usage += priv::getEmbeddedMemoryUsage(item);
+
+        usage.text += priv::getHeapMemoryUsage(m_itemIds);
+        usage += priv::getOwnedMemoryUsage(m_scroll);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setBorders({2, 2, 2, 2});
@@ -965,6 +1050,10 @@ namespace tgui
     {
         Widget::update(elapsedTime);
 
+        std::vector<std::size_t> order;
+        if (m_sortTask.takeResult(order))
+            applyItemOrder(order);
+
         // When double-clicking, the second click has to come within 500 milliseconds
         if (m_animationTimeElapsed >= sf::milliseconds(500))
         {
@@ -1231,6 +1320,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage ListBoxRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(ListBoxRenderer);
+        usage.textures = priv::getHeapMemoryUsage(m_backgroundTexture);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBoxRenderer::setBackgroundColor(const Color& backgroundColor)
     {
         m_backgroundColor = backgroundColor;
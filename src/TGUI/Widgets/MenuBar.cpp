@@ -495,6 +495,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage MenuBar::getMemoryUsage() const
+    {
+        auto usage = Widget::getMemoryUsage();
+        usage.widget += sizeof(MenuBar) - sizeof(Widget);
+
+        usage.widget += m_menus.capacity() * sizeof(Menu);
+        for (const auto& menu : m_menus)
+        {
+            usage += priv::getEmbeddedMemoryUsage(menu.text);
+
+            usage.widget += menu.menuItems.capacity() * sizeof(Label);
+            for (const auto& menuItem : menu.menuItems)
+                usage += priv::getEmbeddedMemoryUsage(menuItem);
+        }
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setBackgroundColor({255, 255, 255});
@@ -648,6 +667,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage MenuBarRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(MenuBarRenderer);
+        usage.textures = priv::getHeapMemoryUsage(m_backgroundTexture)
+                       + priv::getHeapMemoryUsage(m_itemBackgroundTexture)
+                       + priv::getHeapMemoryUsage(m_selectedItemBackgroundTexture);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBarRenderer::setBackgroundColor(const Color& backgroundColor)
     {
         m_backgroundColor = backgroundColor;
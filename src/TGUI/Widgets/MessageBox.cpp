@@ -209,6 +209,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage MessageBox::getMemoryUsage() const
+    {
+        auto usage = ChildWindow::getMemoryUsage();
+        usage.widget += sizeof(MessageBox) - sizeof(ChildWindow);
+
+        usage.widget += priv::getHeapMemoryUsage(m_loadedThemeFile)
+                      + priv::getHeapMemoryUsage(m_buttonClassName)
+                      + m_buttons.capacity() * sizeof(Button::Ptr);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MessageBox::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         ChildWindow::reload(primary, secondary, force);
@@ -302,6 +315,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage MessageBoxRenderer::getMemoryUsage() const
+    {
+        auto usage = ChildWindowRenderer::getMemoryUsage();
+        usage.renderer += sizeof(MessageBoxRenderer) - sizeof(ChildWindowRenderer);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MessageBoxRenderer::setTextColor(const Color& color)
     {
         m_messageBox->m_label->setTextColor(color);
@@ -108,6 +108,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Panel::setBackgroundColor(const Color& backgroundColor)
+    {
+        m_backgroundColor = backgroundColor;
+        getRenderer()->m_backgroundGeometry.invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MemoryUsage Panel::getMemoryUsage() const
+    {
+        auto usage = Container::getMemoryUsage();
+        usage.widget += sizeof(Panel) - sizeof(Container);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Panel::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         const sf::View& view = target.getView();
@@ -143,13 +160,12 @@ namespace tgui
         // Set the position
         states.transform.translate(getPosition());
 
-        // Draw the background
-        if (m_backgroundColor != sf::Color::Transparent)
-        {
-            sf::RectangleShape background(getSize());
-            background.setFillColor(calcColorOpacity(m_backgroundColor, getOpacity()));
-            target.draw(background, states);
-        }
+        // Draw the background, it is only recalculated when something changed since the previous frame
+        const auto renderer = getRenderer();
+        if (renderer->m_backgroundGeometry.update(getSize(), 0, getOpacity()))
+            renderer->m_backgroundGeometry.addRect({0, 0}, getSize(), calcColorOpacity(m_backgroundColor, getOpacity()));
+
+        target.draw(renderer->m_backgroundGeometry, states);
 
         // Draw the widgets
         drawWidgetContainer(&target, states);
@@ -158,32 +174,13 @@ namespace tgui
         glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
 
         // Draw the borders around the panel
-        if (getRenderer()->m_borders != Borders{0, 0, 0, 0})
+        if (renderer->m_borderGeometry.update(getSize(), 0, getOpacity()))
         {
-            Borders& borders = getRenderer()->m_borders;
-            sf::Vector2f size = getSize();
-
-            // Draw left border
-            sf::RectangleShape border({borders.left, size.y + borders.top});
-            border.setPosition(-borders.left, -borders.top);
-            border.setFillColor(calcColorOpacity(getRenderer()->m_borderColor, getOpacity()));
-            target.draw(border, states);
-
-            // Draw top border
-            border.setSize({size.x + borders.right, borders.top});
-            border.setPosition(0, -borders.top);
-            target.draw(border, states);
-
-            // Draw right border
-            border.setSize({borders.right, size.y + borders.bottom});
-            border.setPosition(size.x, 0);
-            target.draw(border, states);
-
-            // Draw bottom border
-            border.setSize({size.x + borders.left, borders.bottom});
-            border.setPosition(-borders.left, size.y);
-            target.draw(border, states);
+            if (renderer->m_borders != Borders{0, 0, 0, 0})
+                renderer->m_borderGeometry.addBorders({0, 0}, getSize(), renderer->m_borders, calcColorOpacity(renderer->m_borderColor, getOpacity()));
         }
+
+        target.draw(renderer->m_borderGeometry, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -257,6 +254,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage PanelRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(PanelRenderer)
+                       + priv::getHeapMemoryUsage(m_backgroundGeometry)
+                       + priv::getHeapMemoryUsage(m_borderGeometry);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void PanelRenderer::setBackgroundColor(const Color& color)
     {
         m_panel->setBackgroundColor(color);
@@ -267,6 +275,15 @@ namespace tgui
     void PanelRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+        m_borderGeometry.invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PanelRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+        m_borderGeometry.invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -181,6 +181,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage Picture::getMemoryUsage() const
+    {
+        auto usage = ClickableWidget::getMemoryUsage();
+        usage.widget += sizeof(Picture) - sizeof(ClickableWidget);
+
+        usage.text += priv::getHeapMemoryUsage(m_loadedFilename);
+        usage.textures += priv::getHeapMemoryUsage(m_texture);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Picture::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         target.draw(m_texture, states);
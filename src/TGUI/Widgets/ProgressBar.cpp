@@ -325,6 +325,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage ProgressBar::getMemoryUsage() const
+    {
+        auto usage = ClickableWidget::getMemoryUsage();
+        usage.widget += sizeof(ProgressBar) - sizeof(ClickableWidget);
+
+        usage += priv::getEmbeddedMemoryUsage(m_textBack);
+        usage += priv::getEmbeddedMemoryUsage(m_textFront);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ProgressBar::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setBorders({2, 2, 2, 2});
@@ -497,6 +509,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage ProgressBarRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(ProgressBarRenderer);
+        usage.textures = priv::getHeapMemoryUsage(m_textureBack)
+                       + priv::getHeapMemoryUsage(m_textureFront);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ProgressBarRenderer::setTextColor(const Color& color)
     {
         setTextColorBack(color);
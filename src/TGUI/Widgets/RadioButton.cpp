@@ -268,6 +268,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage RadioButton::getMemoryUsage() const
+    {
+        auto usage = ClickableWidget::getMemoryUsage();
+        usage.widget += sizeof(RadioButton) - sizeof(ClickableWidget);
+
+        usage += priv::getEmbeddedMemoryUsage(m_text);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void RadioButton::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setPadding({3, 3, 3, 3});
@@ -291,7 +302,10 @@ namespace tgui
 
             // The widget can only be focused when there is an image available for this phase
             if (getRenderer()->m_textureFocused.isLoaded())
+            {
                 m_allowFocus = true;
+                focusOrderChanged();
+            }
 
             if (force)
             {
@@ -516,6 +530,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage RadioButtonRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(RadioButtonRenderer);
+        usage.textures = priv::getHeapMemoryUsage(m_textureUnchecked)
+                       + priv::getHeapMemoryUsage(m_textureChecked)
+                       + priv::getHeapMemoryUsage(m_textureUncheckedHover)
+                       + priv::getHeapMemoryUsage(m_textureCheckedHover)
+                       + priv::getHeapMemoryUsage(m_textureFocused);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void RadioButtonRenderer::setTextColor(const Color& color)
     {
         setTextColorNormal(color);
@@ -662,6 +662,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage Scrollbar::getMemoryUsage() const
+    {
+        auto usage = Widget::getMemoryUsage();
+        usage.widget += sizeof(Scrollbar) - sizeof(Widget);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Scrollbar::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setTrackColorNormal({245, 245, 245});
@@ -921,6 +930,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage ScrollbarRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(ScrollbarRenderer);
+        usage.textures = priv::getHeapMemoryUsage(m_textureTrackNormal)
+                       + priv::getHeapMemoryUsage(m_textureTrackHover)
+                       + priv::getHeapMemoryUsage(m_textureThumbNormal)
+                       + priv::getHeapMemoryUsage(m_textureThumbHover)
+                       + priv::getHeapMemoryUsage(m_textureArrowUpNormal)
+                       + priv::getHeapMemoryUsage(m_textureArrowUpHover)
+                       + priv::getHeapMemoryUsage(m_textureArrowDownNormal)
+                       + priv::getHeapMemoryUsage(m_textureArrowDownHover);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ScrollbarRenderer::setTrackColor(const Color& color)
     {
         setTrackColorNormal(color);
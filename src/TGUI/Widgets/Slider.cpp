@@ -398,6 +398,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage Slider::getMemoryUsage() const
+    {
+        auto usage = Widget::getMemoryUsage();
+        usage.widget += sizeof(Slider) - sizeof(Widget);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Slider::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setBorders({2, 2, 2, 2});
@@ -587,6 +596,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage SliderRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(SliderRenderer);
+        usage.textures = priv::getHeapMemoryUsage(m_textureTrackNormal)
+                       + priv::getHeapMemoryUsage(m_textureTrackHover)
+                       + priv::getHeapMemoryUsage(m_textureThumbNormal)
+                       + priv::getHeapMemoryUsage(m_textureThumbHover);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void SliderRenderer::setTrackColor(const Color& color)
     {
         setTrackColorNormal(color);
@@ -297,6 +297,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage SpinButton::getMemoryUsage() const
+    {
+        auto usage = ClickableWidget::getMemoryUsage();
+        usage.widget += sizeof(SpinButton) - sizeof(ClickableWidget);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void SpinButton::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setBorders({2, 2, 2, 2});
@@ -494,6 +503,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage SpinButtonRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(SpinButtonRenderer);
+        usage.textures = priv::getHeapMemoryUsage(m_textureArrowUpNormal)
+                       + priv::getHeapMemoryUsage(m_textureArrowUpHover)
+                       + priv::getHeapMemoryUsage(m_textureArrowDownNormal)
+                       + priv::getHeapMemoryUsage(m_textureArrowDownHover);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void SpinButtonRenderer::setBackgroundColor(const Color& color)
     {
         setBackgroundColorNormal(color);
@@ -491,6 +491,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage Tab::getMemoryUsage() const
+    {
+        auto usage = Widget::getMemoryUsage();
+        usage.widget += sizeof(Tab) - sizeof(Widget);
+
+        // Every tab is a complete label with its own renderer and signals
+        usage.widget += m_tabWidth.capacity() * sizeof(float) + m_tabTexts.capacity() * sizeof(Label);
+        for (const auto& tabText : m_tabTexts)
+            usage += priv::getEmbeddedMemoryUsage(tabText);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Tab::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setBorders({2, 2, 2, 2});
@@ -707,6 +721,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage TabRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(TabRenderer);
+        usage.textures = priv::getHeapMemoryUsage(m_textureNormal)
+                       + priv::getHeapMemoryUsage(m_textureSelected)
+                       + priv::getHeapMemoryUsage(m_texturesNormal)
+                       + priv::getHeapMemoryUsage(m_texturesSelected);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TabRenderer::setTextColor(const Color& color)
     {
         m_textColor = color;
@@ -1080,7 +1080,8 @@ namespace tgui
                 m_caretVisible = true;
                 m_animationTimeElapsed = {};
 
-                m_callback.text = m_text;
+                if (isCallbackBound("TextChanged"))
+                    m_callback.text = m_text;
                 sendSignal("TextChanged", m_text);
                 break;
             }
@@ -1114,7 +1115,8 @@ namespace tgui
                 else // You did select some characters, so remove them
                     deleteSelectedCharacters();
 
-                m_callback.text = m_text;
+                if (isCallbackBound("TextChanged"))
+                    m_callback.text = m_text;
                 sendSignal("TextChanged", m_text);
                 break;
             }
@@ -1168,7 +1170,8 @@ namespace tgui
                         m_selEnd = m_selStart;
                         rearrangeText(true);
 
-                        m_callback.text = m_text;
+                        if (isCallbackBound("TextChanged"))
+                            m_callback.text = m_text;
                         sendSignal("TextChanged", m_text);
                     }
                 }
@@ -1241,7 +1244,8 @@ namespace tgui
         m_caretVisible = true;
         m_animationTimeElapsed = {};
 
-        m_callback.text = m_text;
+        if (isCallbackBound("TextChanged"))
+            m_callback.text = m_text;
         sendSignal("TextChanged", m_text);
     }
 
@@ -1724,6 +1728,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage TextBox::getMemoryUsage() const
+    {
+        auto usage = Widget::getMemoryUsage();
+        usage.widget += sizeof(TextBox) - sizeof(Widget);
+
+        usage.text += priv::getHeapMemoryUsage(m_text)
+                    + priv::getHeapMemoryUsage(m_lines)
+                    + priv::getHeapMemoryUsage(m_textBeforeSelection)
+                    + priv::getHeapMemoryUsage(m_textSelection1)
+                    + priv::getHeapMemoryUsage(m_textSelection2)
+                    + priv::getHeapMemoryUsage(m_textAfterSelection1)
+                    + priv::getHeapMemoryUsage(m_textAfterSelection2);
+
+        usage.widget += m_selectionRects.capacity() * sizeof(sf::FloatRect);
+        usage += priv::getOwnedMemoryUsage(m_scroll);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setBorders(2, 2, 2, 2);
@@ -1973,6 +1997,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MemoryUsage TextBoxRenderer::getMemoryUsage() const
+    {
+        MemoryUsage usage;
+        usage.renderer = sizeof(TextBoxRenderer);
+        usage.textures = priv::getHeapMemoryUsage(m_backgroundTexture);
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBoxRenderer::setBackgroundColor(const Color& color)
     {
         m_backgroundColor = color;
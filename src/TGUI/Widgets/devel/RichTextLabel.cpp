@@ -25,49 +25,36 @@
 
 #include <TGUI/Widgets/devel/RichTextLabel.hpp>
 
+#include <cmath>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace
 {
-    struct Chunk
-    {
-        Chunk()
-        {
-            style = sf::Text::Regular;
-            color = sf::Color::White;
-            endsInNewline = false;
-        }
-
-        sf::String text;
-        unsigned int style;
-        sf::Color color;
-        bool endsInNewline;
-    };
+    // SFML uses the same angle for its italic style
+    const float ItalicShear = 0.208f;
 
-    void newChunk(std::vector<Chunk>& chunks, Chunk*& currentChunk, Chunk& lastChunk)
+    bool isSpace(sf::Uint32 character)
     {
-        chunks.push_back(Chunk());
-        currentChunk = &(chunks[chunks.size() - 1]);
+        return (character == ' ') || (character == '\t') || (character == '\r') || (character == '\n');
+    }
 
-        // only carry information over if currentChunk and lastChunk aren't the same
-        // this only happens for the first chunk, but it causes random errors
-        if (chunks.size() > 2)
-        {
-            currentChunk->style = lastChunk.style;
-            currentChunk->color = lastChunk.color;
-        }
+    bool isFormattingCharacter(sf::Uint32 character)
+    {
+        return (character == '~') || (character == '*') || (character == '_') || (character == '#');
     }
 
-    void processFormatting(Chunk& lastChunk, Chunk* currentChunk, sf::Text::Style style)
+    // Adds two triangles, the texture coordinates are in pixels
+    void addQuad(sf::VertexArray& vertices, const sf::Color& color,
+                 sf::Vector2f topLeft, sf::Vector2f topRight, sf::Vector2f bottomLeft, sf::Vector2f bottomRight,
+                 sf::FloatRect texRect)
     {
-        if ((lastChunk.style & style) != 0)
-        {
-            currentChunk->style ^= style;
-        }
-        else
-        {
-            currentChunk->style |= style;
-        }
+        vertices.append({topLeft, color, {texRect.left, texRect.top}});
+        vertices.append({topRight, color, {texRect.left + texRect.width, texRect.top}});
+        vertices.append({bottomLeft, color, {texRect.left, texRect.top + texRect.height}});
+        vertices.append({bottomLeft, color, {texRect.left, texRect.top + texRect.height}});
+        vertices.append({topRight, color, {texRect.left + texRect.width, texRect.top}});
+        vertices.append({bottomRight, color, {texRect.left + texRect.width, texRect.top + texRect.height}});
     }
 }
 
@@ -119,7 +106,6 @@ namespace tgui
     {
         Widget::setPosition(position);
         m_background.setPosition(getPosition());
-        setText(m_string);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -133,7 +119,7 @@ namespace tgui
     void RichTextLabel::setFont(const Font& font)
     {
         Widget::setFont(font);
-        setText(m_string);
+        relayout();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -142,175 +128,29 @@ namespace tgui
     {
         m_string = string;
 
-        if (!m_font)
-            return;
-
-        m_texts.clear();
-
-        std::vector<Chunk> chunks;
-        chunks.push_back(Chunk());
-
-        Chunk* currentChunk = &(chunks[0]);
-        bool escaped = false;
-
-        for (std::size_t i = 0; i < m_string.getSize(); ++i)
-        {
-            Chunk& lastChunk = *currentChunk;
-
-            switch (m_string[i])
-            {
-                case '~': // italics
-                {
-                    if (escaped)
-                    {
-                        currentChunk->text += m_string[i];
-                        escaped = false;
-                        break;
-                    }
-
-                    newChunk(chunks, currentChunk, lastChunk);
-
-                    processFormatting(lastChunk, currentChunk, sf::Text::Italic);
-
-                    currentChunk->color = lastChunk.color;
-                    break;
-                }
-                case '*': // bold
-                {
-                    if (escaped)
-                    {
-                        currentChunk->text += m_string[i];
-                        escaped = false;
-                        break;
-                    }
-
-                    newChunk(chunks, currentChunk, lastChunk);
-
-                    processFormatting(lastChunk, currentChunk, sf::Text::Bold);
-
-                    currentChunk->color = lastChunk.color;
-                    break;
-                }
-                case '_': // underline
-                {
-                    if (escaped)
-                    {
-                        currentChunk->text += m_string[i];
-                        escaped = false;
-                        break;
-                    }
-
-                    newChunk(chunks, currentChunk, lastChunk);
-
-
-                    processFormatting(lastChunk, currentChunk, sf::Text::Underlined);
-
-                    currentChunk->color = lastChunk.color;
-                    break;
-                }
-                case '#': // color
-                {
-                    if (escaped)
-                    {
-                        currentChunk->text += m_string[i];
-                        escaped = false;
-                        break;
-                    }
-
-                    // seek forward until the next whitespace
-                    std::size_t length = 0;
-                    while (!isspace(m_string[++i]))
-                        ++length;
-
-                    newChunk(chunks, currentChunk, lastChunk);
-                    currentChunk->color = getColor(m_string.substring(i + 1, length));;
-                    break;
-
-                }
-                case '\\': // escape sequence for escaping formatting characters
-                {
-                    if (i < m_string.getSize())
-                    {
-                        switch (m_string[i + 1])
-                        {
-                            case '~':
-                            case '*':
-                            case '_':
-                            case '#':
-                            {
-                                escaped = true;
-                                break;
-                            }
-                            default:
-                                break;
-                        }
-                    }
-
-                    if (!escaped)
-                    {
-                        currentChunk->text += m_string[i];
-                    }
-
-                    break;
-                }
-                case '\n': // make a new chunk in the case of a newline
-                {
-                    currentChunk->endsInNewline = true;
-                    newChunk(chunks, currentChunk, lastChunk);
-                    break;
-                }
-                default:
-                {
-                    escaped = false;
-                    currentChunk->text += m_string[i];
-                    break;
-                }
-            }
-        }
-
-        sf::String totalString = "";
-        for (std::size_t i = 0; i < chunks.size(); ++i)
-        {
-            if (!chunks[i].endsInNewline && chunks[i].text.getSize() == 0)
-            {
-                continue;
-            }
-
-            totalString += chunks[i].text + (chunks[i].endsInNewline ? "\n" : "");
-        }
-
-        sf::Text text;
-        text.setString(totalString);
-        text.setCharacterSize(m_textSize);
-        text.setPosition(getPosition());
-        text.setFont(*m_font);
+        m_runs.clear();
+        m_pendingEscape = false;
+        parseMarkup(m_string);
+        relayout();
+    }
 
-        m_size = {text.getLocalBounds().left + text.getLocalBounds().width, text.getLocalBounds().top + text.getLocalBounds().height};
-        m_background.setSize(getSize());
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::size_t cursor = 0;
-        Chunk* lastChunk = nullptr;
-        for (std::size_t i = 0; i < chunks.size(); ++i)
-        {
-            sf::Text tempText;
-            tempText.setColor(chunks[i].color);
-            tempText.setString(chunks[i].text);
-            tempText.setStyle(chunks[i].style);
-            tempText.setCharacterSize(m_textSize);
-            tempText.setFont(*m_font);
+    void RichTextLabel::appendText(const sf::String& text)
+    {
+        m_string += text;
 
-            tempText.setPosition(text.findCharacterPos(cursor));
+        // When the new text escapes a formatting character with the backslash at the end of the current text, then that
+        // backslash is removed from the last run which was already laid out
+        const bool escapesFirstCharacter = m_pendingEscape && !text.isEmpty() && isFormattingCharacter(text[0]);
 
-            if (lastChunk != nullptr && lastChunk->endsInNewline)
-            {
-                tempText.setPosition(0, tempText.getPosition().y + m_font->getLineSpacing(m_textSize));
-                ++cursor;
-            }
+        const std::size_t firstRun = m_runs.size();
+        parseMarkup(text);
 
-            m_texts.push_back(tempText);
-            cursor += chunks[i].text.getSize();
-            lastChunk = &chunks[i];
-        }
+        if (escapesFirstCharacter)
+            relayout();
+        else if (m_font)
+            layoutRuns(firstRun);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -318,7 +158,7 @@ namespace tgui
     void RichTextLabel::setTextSize(unsigned int size)
     {
         m_textSize = size;
-        setText(m_string);
+        relayout();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -386,13 +226,204 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void RichTextLabel::parseMarkup(const sf::String& markup)
+    {
+        // Every run starts with the style and color of the run before it
+        auto startRun = [this]{
+            Run run{"", sf::Text::Regular, sf::Color::White, false};
+            if (!m_runs.empty())
+            {
+                run.style = m_runs.back().style;
+                run.color = m_runs.back().color;
+            }
+
+            m_runs.push_back(run);
+        };
+
+        // A backslash at the end of the previous markup escapes the first character of this markup
+        bool escaped = false;
+        if (m_pendingEscape && !markup.isEmpty())
+        {
+            m_pendingEscape = false;
+            if (isFormattingCharacter(markup[0]))
+            {
+                m_runs.back().text.erase(m_runs.back().text.getSize() - 1);
+                escaped = true;
+            }
+        }
+
+        startRun();
+
+        for (std::size_t i = 0; i < markup.getSize(); ++i)
+        {
+            const sf::Uint32 character = markup[i];
+            if (escaped)
+            {
+                m_runs.back().text += character;
+                escaped = false;
+                continue;
+            }
+
+            switch (character)
+            {
+                case '~': // italics
+                    startRun();
+                    m_runs.back().style ^= sf::Text::Italic;
+                    break;
+
+                case '*': // bold
+                    startRun();
+                    m_runs.back().style ^= sf::Text::Bold;
+                    break;
+
+                case '_': // underline
+                    startRun();
+                    m_runs.back().style ^= sf::Text::Underlined;
+                    break;
+
+                case '#': // color, the name or hex code ends at the next whitespace which is not part of the text
+                {
+                    std::size_t length = 0;
+                    while ((i + 1 + length < markup.getSize()) && !isSpace(markup[i + 1 + length]))
+                        ++length;
+
+                    startRun();
+                    m_runs.back().color = getColor(markup.substring(i + 1, length));
+
+                    i += length;
+                    if ((i + 1 < markup.getSize()) && (markup[i + 1] != '\n'))
+                        ++i;
+
+                    break;
+                }
+
+                case '\\': // escape sequence for escaping formatting characters
+                {
+                    if (i + 1 == markup.getSize())
+                    {
+                        // Whether this is an escape sequence depends on the text that is appended next
+                        m_runs.back().text += character;
+                        m_pendingEscape = true;
+                    }
+                    else if (isFormattingCharacter(markup[i + 1]))
+                        escaped = true;
+                    else
+                        m_runs.back().text += character;
+
+                    break;
+                }
+
+                case '\n':
+                    m_runs.back().endsInNewline = true;
+                    startRun();
+                    break;
+
+                default:
+                    m_runs.back().text += character;
+                    break;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RichTextLabel::layoutRuns(std::size_t firstRun)
+    {
+        const float lineSpacing = m_font->getLineSpacing(m_textSize);
+        const float underlineOffset = m_font->getUnderlinePosition(m_textSize);
+        const float underlineThickness = m_font->getUnderlineThickness(m_textSize);
+
+        // The font reserves a white square in the top left corner of its texture, which is used to draw the underlines
+        const sf::FloatRect whitePixel{1, 1, 0, 0};
+
+        sf::Vector2f size = getSize();
+
+        for (std::size_t i = firstRun; i < m_runs.size(); ++i)
+        {
+            const Run& run = m_runs[i];
+            const bool bold = (run.style & sf::Text::Bold) != 0;
+            const float italic = (run.style & sf::Text::Italic) ? ItalicShear : 0.f;
+            const float spaceWidth = m_font->getGlyph(' ', m_textSize, bold).advance;
+
+            // The pen is at the top of the line, while the glyphs are placed relative to the baseline
+            const float baseline = m_pen.y + m_textSize;
+            const float runLeft = m_pen.x;
+
+            for (std::size_t j = 0; j < run.text.getSize(); ++j)
+            {
+                const sf::Uint32 character = run.text[j];
+                m_pen.x += m_font->getKerning(m_previousChar, character, m_textSize);
+                m_previousChar = character;
+
+                if ((character == ' ') || (character == '\t'))
+                {
+                    m_pen.x += (character == ' ') ? spaceWidth : spaceWidth * 4;
+                    size.x = std::max(size.x, m_pen.x);
+                    size.y = std::max(size.y, baseline);
+                    continue;
+                }
+
+                const sf::Glyph& glyph = m_font->getGlyph(character, m_textSize, bold);
+                const float left = m_pen.x + glyph.bounds.left;
+                const float right = left + glyph.bounds.width;
+                const float top = glyph.bounds.top;
+                const float bottom = glyph.bounds.top + glyph.bounds.height;
+
+                addQuad(m_vertices, run.color,
+                        {left - italic * top, baseline + top}, {right - italic * top, baseline + top},
+                        {left - italic * bottom, baseline + bottom}, {right - italic * bottom, baseline + bottom},
+                        sf::FloatRect{glyph.textureRect});
+
+                size.x = std::max(size.x, right - italic * top);
+                size.y = std::max(size.y, baseline + bottom);
+                m_pen.x += glyph.advance;
+            }
+
+            if ((run.style & sf::Text::Underlined) && (m_pen.x > runLeft))
+            {
+                const float top = std::floor(baseline + underlineOffset - (underlineThickness / 2) + 0.5f);
+                const float bottom = top + std::floor(underlineThickness + 0.5f);
+                addQuad(m_vertices, run.color, {runLeft, top}, {m_pen.x, top}, {runLeft, bottom}, {m_pen.x, bottom}, whitePixel);
+            }
+
+            if (run.endsInNewline)
+            {
+                m_pen = {0, m_pen.y + lineSpacing};
+                m_previousChar = 0;
+            }
+        }
+
+        m_size = size;
+        m_background.setSize(size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RichTextLabel::relayout()
+    {
+        m_vertices.clear();
+        m_pen = {};
+        m_previousChar = 0;
+        m_size = sf::Vector2f{};
+        m_background.setSize({});
+
+        if (m_font)
+            layoutRuns(0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void RichTextLabel::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         if (m_background.getFillColor() != sf::Color::Transparent)
             target.draw(m_background, states);
 
-        for(std::size_t i = 0; i < m_texts.size(); ++i)
-            target.draw(m_texts[i], states);
+        if (m_font && (m_vertices.getVertexCount() > 0))
+        {
+            states.transform.translate(getPosition());
+            states.texture = &m_font->getTexture(m_textSize);
+            target.draw(m_vertices, states);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,7 +23,20 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <SFML/OpenGL.hpp>
+
 #include <TGUI/Widgets/devel/Table.hpp>
+#include <TGUI/Exception.hpp>
+
+#include <algorithm>
+#include <limits>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const std::size_t NoRow = std::numeric_limits<std::size_t>::max();
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -57,6 +70,7 @@ namespace tgui
         if (m_header)
             m_header->setFont(font);
 
+        updateRowOffsets();
         updateWidgetPositions();
     }
 
@@ -67,6 +81,12 @@ namespace tgui
         m_characterSize = size;
         if (getFont())
             calculateLabelHeight();
+
+        if (m_dataSource)
+        {
+            updateRowOffsets();
+            updateWidgetPositions();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -87,6 +107,9 @@ namespace tgui
 
     bool Table::insert(std::size_t index, const tgui::Widget::Ptr& widget, const sf::String& widgetName)
     {
+        if (m_dataSource)
+            throw Exception{"Rows can't be added to a Table that has a data source."};
+
         auto row = std::dynamic_pointer_cast<TableRow>(widget);
         if (row == nullptr)
         {
@@ -100,12 +123,7 @@ namespace tgui
             row->setRatio(i, m_header->getRatio(i));
         }
 
-        if (m_rowsEvenColor == sf::Color::Transparent)
-            row->setNormalBackgroundColor(m_rowsOddColor);
-        else if (index % 2 == 0)
-            row->setNormalBackgroundColor(m_rowsEvenColor);
-        else
-            row->setNormalBackgroundColor(m_rowsOddColor);
+        row->setNormalBackgroundColor(getRowColor(index));
 
         float customHeight = row->getCustomHeight();
         row->setSize(getSize().x, (customHeight > m_rowHeight) ? customHeight : m_rowHeight);
@@ -193,11 +211,9 @@ namespace tgui
 
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
-            if (i % 2 == 0)
-                std::dynamic_pointer_cast<TableRow>(m_widgets[i])->setNormalBackgroundColor(evenColor);
-            else
-                std::dynamic_pointer_cast<TableRow>(m_widgets[i])->setNormalBackgroundColor(oddColor);
-
+            // With a data source the widgets are reused for different rows, so the color depends on the displayed row
+            const std::size_t row = m_dataSource ? m_slotRows[i] : i;
+            std::dynamic_pointer_cast<TableRow>(m_widgets[i])->setNormalBackgroundColor(getRowColor(row));
             std::dynamic_pointer_cast<TableRow>(m_widgets[i])->setHoverBackgroundColor({255,255,0});
         }
     }
@@ -211,8 +227,183 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Table::setDataSource(const TableDataSource::Ptr& source)
+    {
+        // The rows that were added before are replaced by the rows of the data source
+        BoxLayout::removeAllWidgets();
+        m_slotRows.clear();
+        m_slotColumns = 0;
+        m_scrollOffset = 0;
+
+        // The sort and filter functions belong to the rows of the old data source
+        m_rowOrderTask.cancel();
+        m_rowComparator = nullptr;
+        m_rowFilter = nullptr;
+        m_rowOrder.clear();
+        m_rowOrderUsed = false;
+
+        m_dataSource = source;
+        notifyDataChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TableDataSource::Ptr Table::getDataSource() const
+    {
+        return m_dataSource;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::notifyDataChanged()
+    {
+        if (!m_dataSource)
+            return;
+
+        // The row widgets have to be recreated when the amount of columns changed
+        if (m_dataSource->getColumnCount() != m_slotColumns)
+        {
+            BoxLayout::removeAllWidgets();
+            m_slotRows.clear();
+            m_slotColumns = m_dataSource->getColumnCount();
+        }
+
+        // Every reused row widget has to get its contents from the data source again
+        std::fill(m_slotRows.begin(), m_slotRows.end(), NoRow);
+
+        // The old order remains visible until the rows are sorted and filtered again, except for rows that no longer exist
+        if (m_rowComparator || m_rowFilter)
+        {
+            const std::size_t rowCount = m_dataSource->getRowCount();
+            m_rowOrder.erase(std::remove_if(m_rowOrder.begin(), m_rowOrder.end(), [=](std::size_t row){ return row >= rowCount; }),
+                             m_rowOrder.end());
+
+            updateRowOrder();
+        }
+
+        updateRowOffsets();
+        updateWidgetPositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::setScrollOffset(double offset)
+    {
+        m_scrollOffset = offset;
+        updateWidgetPositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    double Table::getScrollOffset() const
+    {
+        return m_scrollOffset;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    double Table::getContentHeight() const
+    {
+        if (m_dataSource)
+            return getRowOffset(getDisplayedRowCount());
+        else
+            return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Table::getFirstVisibleRow() const
+    {
+        const std::size_t rowCount = getDisplayedRowCount();
+        if (rowCount == 0)
+            return 0;
+
+        if (m_rowOffsets.empty())
+            return std::min(static_cast<std::size_t>(m_scrollOffset / (m_rowHeight + 1)), rowCount - 1);
+
+        const auto it = std::upper_bound(m_rowOffsets.begin(), m_rowOffsets.end(), m_scrollOffset);
+        return std::min(static_cast<std::size_t>(it - m_rowOffsets.begin()) - 1, rowCount - 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::sortRows(const std::function<bool(std::size_t, std::size_t)>& comparator)
+    {
+        m_rowComparator = comparator;
+        updateRowOrder();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::filterRows(const std::function<bool(std::size_t)>& predicate)
+    {
+        m_rowFilter = predicate;
+        updateRowOrder();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Table::isRowOrderPending() const
+    {
+        return m_rowOrderTask.isPending();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Table::getDisplayedRowCount() const
+    {
+        if (!m_dataSource)
+            return 0;
+        else if (m_rowOrderUsed)
+            return m_rowOrder.size();
+        else
+            return m_dataSource->getRowCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Table::getDataRow(std::size_t displayedRow) const
+    {
+        if (m_rowOrderUsed)
+            return m_rowOrder[displayedRow];
+        else
+            return displayedRow;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::mouseWheelMoved(int delta, int x, int y)
+    {
+        if (m_dataSource)
+            setScrollOffset(m_scrollOffset - delta * 3.0 * (m_rowHeight + 1));
+        else
+            BoxLayout::mouseWheelMoved(delta, x, y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::update(sf::Time elapsedTime)
+    {
+        BoxLayout::update(elapsedTime);
+
+        // The new order is only swapped in here, so that the rows never change while the gui is handling an event
+        if (m_rowOrderTask.takeResult(m_rowOrder))
+        {
+            m_rowOrderUsed = true;
+            std::fill(m_slotRows.begin(), m_slotRows.end(), NoRow);
+
+            updateRowOffsets();
+            updateWidgetPositions();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Table::updateWidgetPositions()
     {
+        if (postponeUpdate())
+            return;
+
         if (m_header != nullptr)
         {
             m_header->setPosition(0, 0);
@@ -221,6 +412,12 @@ namespace tgui
             m_headerSeparator.setPosition(0, m_rowHeight);
         }
 
+        if (m_dataSource)
+        {
+            updateVisibleRows();
+            return;
+        }
+
         if (m_widgets.empty())
             return;
 
@@ -242,6 +439,175 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Table::invalidateAbsolutePosition()
+    {
+        BoxLayout::invalidateAbsolutePosition();
+
+        // The header isn't part of m_widgets, so the container doesn't invalidate it
+        if (m_header)
+            m_header->invalidateAbsolutePosition();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::updateRowOrder()
+    {
+        if (!m_dataSource)
+            return;
+
+        if (m_rowComparator || m_rowFilter)
+        {
+            m_rowOrderTask.start(m_dataSource->getRowCount(), m_rowFilter, m_rowComparator);
+            return;
+        }
+
+        // Without sorting and filtering the rows are shown in the order of the data source, which requires no calculation
+        m_rowOrderTask.cancel();
+        if (m_rowOrderUsed)
+        {
+            m_rowOrder.clear();
+            m_rowOrderUsed = false;
+
+            std::fill(m_slotRows.begin(), m_slotRows.end(), NoRow);
+            updateRowOffsets();
+            updateWidgetPositions();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::updateVisibleRows()
+    {
+        const float top = m_header->getSize().y + m_header->getPosition().y + 1.f;
+        const float viewportHeight = std::max(0.f, getSize().y - top);
+        const std::size_t rowCount = getDisplayedRowCount();
+
+        const double maxScrollOffset = std::max(0.0, getContentHeight() - viewportHeight);
+        m_scrollOffset = std::max(0.0, std::min(m_scrollOffset, maxScrollOffset));
+
+        const std::size_t firstRow = getFirstVisibleRow();
+        std::size_t lastRow = firstRow;
+        while ((lastRow < rowCount) && (getRowOffset(lastRow) < m_scrollOffset + viewportHeight))
+            ++lastRow;
+
+        // Create extra row widgets when more rows fit inside the table than before. One spare widget is created because
+        // an additional row becomes partially visible when scrolling to an offset in the middle of a row.
+        if (m_slotRows.size() < lastRow - firstRow)
+        {
+            while (m_slotRows.size() < lastRow - firstRow + 1)
+            {
+                auto row = std::make_shared<TableRow>();
+                for (std::size_t column = 0; column < m_slotColumns; ++column)
+                    row->addItem("", m_normalTextColor);
+
+                for (std::size_t i = 0; i < m_header->getWidgets().size(); ++i)
+                {
+                    row->setFixedSize(i, m_header->getFixedSize(i));
+                    row->setRatio(i, m_header->getRatio(i));
+                }
+
+                // BoxLayout::insert can't be used as it would reposition the rows while they are being created
+                Container::add(row, "");
+                m_widgetsRatio.emplace_back(1.f);
+                m_widgetsFixedSizes.emplace_back(0.f);
+                m_slotRows.push_back(NoRow);
+            }
+
+            // Rows are assigned to the widgets based on the amount of widgets, so all contents have to be refreshed
+            std::fill(m_slotRows.begin(), m_slotRows.end(), NoRow);
+        }
+
+        // Each row always uses the same widget while it remains visible, so scrolling only fills the rows that became visible
+        std::vector<bool> slotUsed(m_slotRows.size(), false);
+        for (std::size_t rowIndex = firstRow; rowIndex < lastRow; ++rowIndex)
+        {
+            const std::size_t slot = rowIndex % m_slotRows.size();
+            auto row = std::static_pointer_cast<TableRow>(m_widgets[slot]);
+            slotUsed[slot] = true;
+
+            if (m_slotRows[slot] != rowIndex)
+            {
+                m_slotRows[slot] = rowIndex;
+                for (std::size_t column = 0; column < m_slotColumns; ++column)
+                    row->setItemText(column, m_dataSource->getCell(getDataRow(rowIndex), column));
+
+                row->setNormalBackgroundColor(getRowColor(rowIndex));
+            }
+
+            const sf::Vector2f size{getSize().x, getRowHeight(rowIndex)};
+            if (row->getSize() != size)
+                row->setSize(size);
+
+            row->setPosition(0, top + static_cast<float>(getRowOffset(rowIndex) - m_scrollOffset));
+            row->show();
+        }
+
+        for (std::size_t slot = 0; slot < m_slotRows.size(); ++slot)
+        {
+            if (!slotUsed[slot])
+                m_widgets[slot]->hide();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::updateRowOffsets()
+    {
+        m_rowOffsets.clear();
+        if (!m_dataSource || !m_dataSource->hasVariableRowHeights())
+            return;
+
+        const std::size_t rowCount = getDisplayedRowCount();
+        m_rowOffsets.reserve(rowCount + 1);
+
+        double offset = 0;
+        for (std::size_t i = 0; i < rowCount; ++i)
+        {
+            m_rowOffsets.push_back(offset);
+            offset += getRowHeight(i) + 1;
+        }
+
+        m_rowOffsets.push_back(offset);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    double Table::getRowOffset(std::size_t row) const
+    {
+        if (m_rowOffsets.empty())
+            return row * (static_cast<double>(m_rowHeight) + 1);
+        else
+            return m_rowOffsets[row];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float Table::getRowHeight(std::size_t row) const
+    {
+        if (m_dataSource && m_dataSource->hasVariableRowHeights())
+        {
+            const float height = m_dataSource->getRowHeight(getDataRow(row));
+            if (height > 0)
+                return height;
+        }
+
+        return m_rowHeight;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Color Table::getRowColor(std::size_t row) const
+    {
+        if (m_rowsEvenColor == sf::Color::Transparent)
+            return m_rowsOddColor;
+        else if (row % 2 == 0)
+            return m_rowsEvenColor;
+        else
+            return m_rowsOddColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Table::calculateLabelHeight()
     {
         auto label = std::make_shared<Label>();
@@ -275,6 +641,36 @@ namespace tgui
 
     void Table::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        const sf::View& view = target.getView();
+
+        // Calculate the scale factor of the view
+        float scaleViewX = target.getSize().x / view.getSize().x;
+        float scaleViewY = target.getSize().y / view.getSize().y;
+
+        // Get the global position
+        sf::Vector2f topLeftPosition = {((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
+                                        ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top)};
+        sf::Vector2f bottomRightPosition = {(getAbsolutePosition().x + getSize().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
+                                            (getAbsolutePosition().y + getSize().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top)};
+
+        // Get the old clipping area
+        GLint scissor[4];
+        glGetIntegerv(GL_SCISSOR_BOX, scissor);
+
+        // Calculate the clipping area
+        GLint scissorLeft = std::max(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
+        GLint scissorTop = std::max(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
+        GLint scissorRight = std::min(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
+        GLint scissorBottom = std::min(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
+
+        if (scissorRight < scissorLeft)
+            scissorRight = scissorLeft;
+        else if (scissorBottom < scissorTop)
+            scissorTop = scissorBottom;
+
+        // Set the clipping area, the last visible row is often only partially inside the table
+        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+
         // Set the position
         states.transform.translate(getPosition());
 
@@ -286,9 +682,12 @@ namespace tgui
             target.draw(background, states);
         }
 
-        // Draw the widgets
-        target.draw(*m_header, states);
+        // Draw the widgets. The header is drawn last because rows can be partially scrolled behind it.
         drawWidgetContainer(&target, states);
+        target.draw(*m_header, states);
+
+        // Reset the old clipping area
+        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
 
 /// TODO
 /*
@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Widgets/devel/TableDataSource.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ColumnTableDataSource::ColumnTableDataSource(std::size_t columnCount) :
+        m_columns(columnCount)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ColumnTableDataSource::reserve(std::size_t rowCount)
+    {
+        for (auto& column : m_columns)
+            column.reserve(rowCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ColumnTableDataSource::addRow(const std::vector<std::string>& cells)
+    {
+        const std::size_t count = std::min(cells.size(), m_columns.size());
+        for (std::size_t i = 0; i < count; ++i)
+            m_columns[i].push_back(cells[i]);
+
+        for (std::size_t i = count; i < m_columns.size(); ++i)
+            m_columns[i].emplace_back();
+
+        m_rowCount++;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ColumnTableDataSource::setCell(std::size_t row, std::size_t column, const std::string& text)
+    {
+        assert(row < m_rowCount && column < m_columns.size());
+        m_columns[column][row] = text;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ColumnTableDataSource::removeAllRows()
+    {
+        for (auto& column : m_columns)
+            column.clear();
+
+        m_rowCount = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ColumnTableDataSource::getRowCount() const
+    {
+        return m_rowCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ColumnTableDataSource::getColumnCount() const
+    {
+        return m_columns.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String ColumnTableDataSource::getCell(std::size_t row, std::size_t column) const
+    {
+        if ((column < m_columns.size()) && (row < m_rowCount))
+            return m_columns[column][row];
+        else
+            return "";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/devel/TableItem.hpp>
+#include <TGUI/Widgets/Label.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -62,6 +63,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TableItem::setText(const sf::String& text)
+    {
+        auto label = std::dynamic_pointer_cast<Label>(m_widget);
+        if (label)
+        {
+            label->setText(text);
+            update();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TableItem::setFont(const Font& font)
     {
         m_widget->setFont(font);
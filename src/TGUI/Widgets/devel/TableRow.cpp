@@ -72,6 +72,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TableRow::setItemText(std::size_t column, const sf::String& text)
+    {
+        if (column < m_widgets.size())
+            std::static_pointer_cast<TableItem>(m_widgets[column])->setText(text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool TableRow::insert(std::size_t index, const tgui::Widget::Ptr& widget, TableItem::HorizontalAlign align, const sf::String& widgetName)
     {
         return HorizontalLayout::insert(index, createItem(widget, align), widgetName);
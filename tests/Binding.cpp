@@ -0,0 +1,197 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+#include <TGUI/Binding.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Knob.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/ProgressBar.hpp>
+#include <TGUI/Widgets/Slider.hpp>
+
+TEST_CASE("[Binding]") {
+    tgui::Bindings bindings;
+
+    SECTION("Observable") {
+        tgui::Observable<int> observable{5};
+        REQUIRE(observable.get() == 5);
+
+        const auto version = observable.getVersion();
+        observable.set(5);
+        REQUIRE(observable.getVersion() == version);
+
+        observable.set(6);
+        REQUIRE(observable.get() == 6);
+        REQUIRE(observable.getVersion() != version);
+    }
+
+    SECTION("Label") {
+        auto label = std::make_shared<tgui::Label>();
+        auto text = std::make_shared<tgui::Observable<sf::String>>("Initial");
+
+        bindings.bindText(label, text);
+        REQUIRE(bindings.getBindingCount() == 1);
+        REQUIRE(label->getText() == "Initial");
+
+        // Only the last change is passed to the widget
+        for (unsigned int i = 0; i < 100; ++i)
+            text->set("Text " + tgui::to_string(i));
+
+        REQUIRE(label->getText() == "Initial");
+        REQUIRE(bindings.apply() == 1);
+        REQUIRE(label->getText() == "Text 99");
+
+        REQUIRE(bindings.apply() == 0);
+        REQUIRE(bindings.getUpdateCount() == 1);
+    }
+
+    SECTION("Unchanged values") {
+        auto label = std::make_shared<tgui::Label>();
+        auto text = std::make_shared<tgui::Observable<sf::String>>("Initial");
+
+        unsigned int textChanges = 0;
+        bindings.bind(label, text, [&](tgui::Label& l, const sf::String& str){ l.setText(str); textChanges++; });
+        REQUIRE(textChanges == 1);
+
+        text->set("Initial");
+        REQUIRE(bindings.apply() == 0);
+
+        // Changing the value back before the next frame doesn't update the widget
+        text->set("Something else");
+        text->set("Initial");
+        REQUIRE(bindings.apply() == 0);
+        REQUIRE(textChanges == 1);
+    }
+
+    SECTION("Values") {
+        auto progressBar = std::make_shared<tgui::ProgressBar>();
+        auto slider = std::make_shared<tgui::Slider>();
+        auto knob = std::make_shared<tgui::Knob>();
+        auto unsignedValue = std::make_shared<tgui::Observable<unsigned int>>(3);
+        auto intValue = std::make_shared<tgui::Observable<int>>(4);
+
+        bindings.bindValue(progressBar, unsignedValue);
+        bindings.bindValue(slider, intValue);
+        bindings.bindValue(knob, intValue);
+        REQUIRE(progressBar->getValue() == 3);
+        REQUIRE(slider->getValue() == 4);
+        REQUIRE(knob->getValue() == 4);
+
+        unsigned int valueChanges = 0;
+        slider->connect("ValueChanged", [&]{ valueChanges++; });
+        for (int i = 0; i < 10; ++i)
+            intValue->set(i);
+
+        REQUIRE(bindings.apply() == 2);
+        REQUIRE(slider->getValue() == 9);
+        REQUIRE(knob->getValue() == 9);
+        REQUIRE(valueChanges == 1);
+        REQUIRE(bindings.getUpdateCount() == 2);
+    }
+
+    SECTION("Custom property") {
+        auto label = std::make_shared<tgui::Label>();
+        auto size = std::make_shared<tgui::Observable<unsigned int>>(20);
+        bindings.bind(label, size, [](tgui::Label& l, unsigned int textSize){ l.setTextSize(textSize); });
+        REQUIRE(label->getTextSize() == 20);
+
+        size->set(30);
+        bindings.apply();
+        REQUIRE(label->getTextSize() == 30);
+    }
+
+    SECTION("Unbind") {
+        auto label1 = std::make_shared<tgui::Label>();
+        auto label2 = std::make_shared<tgui::Label>();
+        auto text = std::make_shared<tgui::Observable<sf::String>>("1");
+        bindings.bindText(label1, text);
+        bindings.bindText(label2, text);
+
+        bindings.unbind(label1.get());
+        REQUIRE(bindings.getBindingCount() == 1);
+
+        text->set("2");
+        bindings.apply();
+        REQUIRE(label1->getText() == "1");
+        REQUIRE(label2->getText() == "2");
+
+        // Bindings of destroyed widgets are removed
+        label2 = nullptr;
+        text->set("3");
+        bindings.apply();
+        REQUIRE(bindings.getBindingCount() == 0);
+
+        bindings.bindText(label1, text);
+        bindings.unbindAll();
+        REQUIRE(bindings.getBindingCount() == 0);
+    }
+
+    SECTION("Unbind from callback") {
+        auto slider1 = std::make_shared<tgui::Slider>();
+        auto slider2 = std::make_shared<tgui::Slider>();
+        auto value = std::make_shared<tgui::Observable<int>>(1);
+        bindings.bindValue(slider1, value);
+        bindings.bindValue(slider2, value);
+
+        // The handler removes the binding that is still being applied
+        unsigned int valueChanges = 0;
+        slider1->connect("ValueChanged", [&]{ valueChanges++; bindings.unbind(slider1.get()); });
+        value->set(2);
+        REQUIRE(bindings.apply() == 2);
+        REQUIRE(valueChanges == 1);
+        REQUIRE(slider1->getValue() == 2);
+        REQUIRE(slider2->getValue() == 2);
+        REQUIRE(bindings.getBindingCount() == 1);
+
+        value->set(3);
+        REQUIRE(bindings.apply() == 1);
+        REQUIRE(slider1->getValue() == 2);
+        REQUIRE(slider2->getValue() == 3);
+
+        // Bindings that weren't applied yet are skipped after unbindAll
+        slider1->disconnectAll();
+        slider2->connect("ValueChanged", [&]{ bindings.unbindAll(); });
+        bindings.bindValue(slider1, value);
+        value->set(4);
+        REQUIRE(bindings.apply() == 1);
+        REQUIRE(slider1->getValue() == 3);
+        REQUIRE(slider2->getValue() == 4);
+        REQUIRE(bindings.getBindingCount() == 0);
+    }
+
+    SECTION("Gui") {
+        tgui::Gui gui;
+        auto label = std::make_shared<tgui::Label>();
+        gui.add(label);
+
+        auto text = std::make_shared<tgui::Observable<sf::String>>();
+        gui.getBindings().bindText(label, text);
+
+        text->set("Frame 1");
+        gui.updateTime(sf::milliseconds(16));
+        REQUIRE(label->getText() == "Frame 1");
+    }
+}
@@ -0,0 +1,154 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+#include <TGUI/CommandQueue.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <thread>
+
+TEST_CASE("[CommandQueue]") {
+    tgui::CommandQueue queue;
+
+    SECTION("Order") {
+        std::vector<int> values;
+        for (int i = 0; i < 5; ++i)
+            queue.post([&values, i]{ values.push_back(i); });
+
+        REQUIRE(queue.getDepth() == 5);
+        REQUIRE(queue.execute() == 5);
+        REQUIRE(values == std::vector<int>({0, 1, 2, 3, 4}));
+        REQUIRE(queue.getDepth() == 0);
+        REQUIRE(queue.getExecutedCount() == 5);
+
+        REQUIRE(queue.execute() == 0);
+    }
+
+    SECTION("Coalescing") {
+        auto label = std::make_shared<tgui::Label>();
+        unsigned int textChanges = 0;
+        for (unsigned int i = 1; i <= 10; ++i)
+        {
+            queue.postUpdate(label, "Text", [&textChanges, i](tgui::Label& l){ l.setText(tgui::to_string(i)); ++textChanges; });
+            queue.postUpdate(label, "TextSize", [i](tgui::Label& l){ l.setTextSize(10 + i); });
+        }
+
+        REQUIRE(queue.getDepth() == 20);
+        REQUIRE(queue.execute() == 2);
+        REQUIRE(textChanges == 1);
+        REQUIRE(label->getText() == "10");
+        REQUIRE(label->getTextSize() == 20);
+        REQUIRE(queue.getCoalescedCount() == 18);
+        REQUIRE(queue.getDepth() == 0);
+
+        // Nothing happens when the widget no longer exists
+        queue.postUpdate(label, "Text", [&textChanges](tgui::Label&){ ++textChanges; });
+        label = nullptr;
+        REQUIRE(queue.execute() == 1);
+        REQUIRE(textChanges == 1);
+    }
+
+    SECTION("Batch size") {
+        queue.setMaxBatchSize(3);
+        REQUIRE(queue.getMaxBatchSize() == 3);
+
+        unsigned int count = 0;
+        for (unsigned int i = 0; i < 10; ++i)
+            queue.post([&count]{ ++count; });
+
+        REQUIRE(queue.execute() == 3);
+        REQUIRE(queue.getDepth() == 7);
+        REQUIRE(queue.execute() == 3);
+        REQUIRE(queue.execute() == 3);
+        REQUIRE(queue.execute() == 1);
+        REQUIRE(count == 10);
+    }
+
+    SECTION("Time budget") {
+        queue.setTimeBudget(sf::milliseconds(5));
+        REQUIRE(queue.getTimeBudget() == sf::milliseconds(5));
+
+        // Each command is slower than the budget, so only one is executed per call
+        for (unsigned int i = 0; i < 3; ++i)
+            queue.post([]{ std::this_thread::sleep_for(std::chrono::milliseconds(6)); });
+
+        REQUIRE(queue.execute() == 1);
+        REQUIRE(queue.getLastDrainDuration() >= sf::milliseconds(5));
+        REQUIRE(queue.getDepth() == 2);
+
+        queue.setTimeBudget(sf::Time::Zero);
+        REQUIRE(queue.execute() == 2);
+        REQUIRE(queue.getMaxDrainDuration() >= sf::milliseconds(10));
+    }
+
+    SECTION("Multiple threads") {
+        queue.setMaxBatchSize(100);
+
+        std::atomic<bool> producing{true};
+        unsigned long long sum = 0;
+        std::vector<std::thread> threads;
+        for (unsigned int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&queue, &sum]{
+                for (unsigned int i = 0; i < 10000; ++i)
+                    queue.post([&sum, i]{ sum += i; });
+            });
+        }
+
+        std::thread consumer{[&queue, &producing]{
+            while (producing)
+                queue.execute();
+        }};
+
+        for (auto& thread : threads)
+            thread.join();
+
+        producing = false;
+        consumer.join();
+
+        while (queue.getDepth() > 0)
+            queue.execute();
+
+        REQUIRE(sum == 4 * (9999ULL * 10000 / 2));
+        REQUIRE(queue.getExecutedCount() == 40000);
+    }
+
+    SECTION("Gui") {
+        tgui::Gui gui;
+        auto label = std::make_shared<tgui::Label>();
+        gui.add(label);
+
+        std::thread thread{[&gui, label]{
+            gui.getCommandQueue().postUpdate(label, "Text", [](tgui::Label& l){ l.setText("Posted"); });
+        }};
+        thread.join();
+
+        REQUIRE(label->getText() == "");
+        gui.updateTime(sf::milliseconds(16));
+        REQUIRE(label->getText() == "Posted");
+        REQUIRE(gui.getCommandQueue().getDepth() == 0);
+    }
+}
@@ -111,6 +111,50 @@ TEST_CASE("[Container]") {
         }
     }
 
+    SECTION("getByPath") {
+        REQUIRE(container->getByPath("w1") == widget1);
+        REQUIRE(container->getByPath("w2.w4") == widget4);
+        REQUIRE(container->getByPath<tgui::EditBox>("w2.w5") == widget5);
+        REQUIRE(container->getByPath("w4") == nullptr);
+        REQUIRE(container->getByPath("w1.w4") == nullptr);
+        REQUIRE(container->getByPath("w2.w0") == nullptr);
+        REQUIRE(container->getByPath("w2.w4.w5") == nullptr);
+
+        container->setNameCacheEnabled();
+        REQUIRE(container->get("w4", true) == widget4);
+        REQUIRE(container->get("w6", true) == nullptr);
+
+        auto widget6 = std::make_shared<tgui::Button>();
+        widget2->add(widget6, "w6");
+        REQUIRE(container->get("w6", true) == widget6);
+
+        widget2->remove(widget4);
+        REQUIRE(container->get("w4", true) == nullptr);
+    }
+
+    SECTION("duplicate names") {
+        auto widget6 = std::make_shared<tgui::Button>();
+        auto widget7 = std::make_shared<tgui::Button>();
+        container->add(widget6, "w1");
+        container->add(widget7, "w1");
+        REQUIRE(container->get("w1") == widget1);
+
+        container->remove(widget1);
+        REQUIRE(container->get("w1") == widget6);
+
+        container->setWidgetName(widget6, "w6");
+        REQUIRE(container->get("w1") == widget7);
+        REQUIRE(container->get("w6") == widget6);
+
+        container->setWidgetName(widget7, "w6");
+        REQUIRE(container->get("w1") == nullptr);
+        REQUIRE(container->get("w6") == widget6);
+
+        widget6->moveToFront();
+        REQUIRE(container->get("w6") == widget7);
+        REQUIRE(container->getWidgetName(widget6) == "w6");
+    }
+
     SECTION("remove") {
         SECTION("remove with correct parameter") {
             REQUIRE(container->getWidgets().size() == 3);
@@ -225,6 +269,79 @@ TEST_CASE("[Container]") {
         REQUIRE(!editBox3->isFocused());
     }
 
+    SECTION("tab order") {
+        // Widgets inside child containers are part of the focus order
+        container->focusWidget(widget3);
+        container->focusNextWidget();
+        REQUIRE(widget1->isFocused());
+        container->focusNextWidget();
+        REQUIRE(widget4->isFocused());
+        REQUIRE(widget2->isFocused());
+        container->focusNextWidget();
+        REQUIRE(widget5->isFocused());
+        REQUIRE(!widget4->isFocused());
+        container->focusNextWidget();
+        REQUIRE(widget3->isFocused());
+        REQUIRE(!widget2->isFocused());
+        REQUIRE(!widget5->isFocused());
+
+        container->focusPreviousWidget();
+        REQUIRE(widget5->isFocused());
+        container->focusPreviousWidget();
+        REQUIRE(widget4->isFocused());
+        container->focusPreviousWidget();
+        REQUIRE(widget1->isFocused());
+        REQUIRE(!widget2->isFocused());
+
+        // Hidden and disabled widgets are skipped
+        widget4->disable();
+        container->focusNextWidget();
+        REQUIRE(widget5->isFocused());
+        widget2->hide();
+        REQUIRE(!widget5->isFocused());
+        container->focusNextWidget();
+        REQUIRE(widget1->isFocused());
+        container->focusNextWidget();
+        REQUIRE(widget3->isFocused());
+        widget2->show();
+        widget4->enable();
+
+        // Tab indices change the order between siblings
+        REQUIRE(widget1->getTabIndex() == 0);
+        widget1->setTabIndex(2);
+        widget5->setTabIndex(-1);
+        REQUIRE(widget1->getTabIndex() == 2);
+        REQUIRE(widget5->getTabIndex() == -1);
+
+        container->unfocusWidgets();
+        container->focusNextWidget();
+        REQUIRE(widget5->isFocused());
+        container->focusNextWidget();
+        REQUIRE(widget4->isFocused());
+        container->focusNextWidget();
+        REQUIRE(widget3->isFocused());
+        container->focusNextWidget();
+        REQUIRE(widget1->isFocused());
+
+        // Changes to the widgets are taken into account
+        auto widget6 = std::make_shared<tgui::EditBox>();
+        widget2->add(widget6);
+        container->focusNextWidget();
+        REQUIRE(widget5->isFocused());
+        container->focusNextWidget();
+        container->focusNextWidget();
+        REQUIRE(widget6->isFocused());
+        widget2->remove(widget6);
+        container->focusWidget(widget1);
+        container->focusPreviousWidget();
+        REQUIRE(widget3->isFocused());
+
+        // Nothing happens when no widget can be focused
+        container->removeAllWidgets();
+        container->focusNextWidget();
+        container->focusPreviousWidget();
+    }
+
     SECTION("setOpacity") {
         REQUIRE(container->getOpacity() == 1);
 
@@ -66,4 +66,25 @@ TEST_CASE("[HorizontalLayout]") {
     REQUIRE(layout->getRatio(4) == 0);
 
     // TODO: Add fixed size tests
+
+    auto batchedLayout = std::make_shared<tgui::HorizontalLayout>();
+    batchedLayout->setSize(800, 100);
+
+    auto button4 = std::make_shared<tgui::Button>();
+    auto button5 = std::make_shared<tgui::Button>();
+    button4->setSize(10, 10);
+    {
+        tgui::Container::UpdateGuard guard{*batchedLayout};
+        REQUIRE(batchedLayout->isUpdating());
+
+        batchedLayout->add(button4);
+        batchedLayout->add(button5);
+        batchedLayout->setRatio(button5, 3);
+        REQUIRE(button4->getFullSize() == sf::Vector2f(10, 10));
+    }
+
+    REQUIRE(!batchedLayout->isUpdating());
+    REQUIRE(button4->getFullSize() == sf::Vector2f(200, 100));
+    REQUIRE(button5->getFullSize() == sf::Vector2f(600, 100));
+    REQUIRE(button5->getPosition() == sf::Vector2f(200, 0));
 }
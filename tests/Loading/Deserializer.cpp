@@ -152,4 +152,47 @@ TEST_CASE("[Deserializer]") {
         tgui::Deserializer::setFunction(tgui::ObjectConverter::Type::Color, oldFunc);
         REQUIRE(tgui::Deserializer::deserialize(Type::Color, "rgb(10, 20, 30)").getColor() == sf::Color(10, 20, 30));
     }
+
+    SECTION("cache") {
+        REQUIRE(!tgui::Deserializer::isCacheEnabled());
+        tgui::Deserializer::setCacheEnabled(true);
+        tgui::Deserializer::clearCache();
+
+        REQUIRE(tgui::Deserializer::deserialize(Type::Color, "(10, 20, 30)").getColor() == sf::Color(10, 20, 30));
+        REQUIRE(tgui::Deserializer::deserialize(Type::Color, "(10, 20, 30)").getColor() == sf::Color(10, 20, 30));
+        REQUIRE(tgui::Deserializer::deserialize(Type::Borders, "(10, 20, 30, 40)").getBorders() == tgui::Borders(10, 20, 30, 40));
+        REQUIRE(tgui::Deserializer::getCacheHits() == 1);
+        REQUIRE(tgui::Deserializer::getCacheMisses() == 2);
+
+        // Changing the function removes the cached values of that type
+        auto oldFunc = tgui::Deserializer::getFunction(Type::Color);
+        tgui::Deserializer::setFunction(Type::Color, [](const std::string&){ return tgui::ObjectConverter{sf::Color::Green}; });
+        REQUIRE(tgui::Deserializer::deserialize(Type::Color, "(10, 20, 30)").getColor() == sf::Color::Green);
+        tgui::Deserializer::setFunction(Type::Color, oldFunc);
+        REQUIRE(tgui::Deserializer::deserialize(Type::Color, "(10, 20, 30)").getColor() == sf::Color(10, 20, 30));
+        REQUIRE(tgui::Deserializer::getCacheHits() == 1);
+        REQUIRE(tgui::Deserializer::getCacheMisses() == 4);
+
+        // The least recently used values are removed when the cache is full
+        tgui::Deserializer::setCacheCapacity(2);
+        REQUIRE(tgui::Deserializer::getCacheCapacity() == 2);
+        tgui::Deserializer::clearCache();
+        tgui::Deserializer::deserialize(Type::Number, "1");
+        tgui::Deserializer::deserialize(Type::Number, "2");
+        tgui::Deserializer::deserialize(Type::Number, "1");
+        tgui::Deserializer::deserialize(Type::Number, "3");
+        REQUIRE(tgui::Deserializer::getCacheHits() == 1);
+        REQUIRE(tgui::Deserializer::deserialize(Type::Number, "1").getNumber() == 1);
+        REQUIRE(tgui::Deserializer::getCacheHits() == 2);
+        REQUIRE(tgui::Deserializer::deserialize(Type::Number, "2").getNumber() == 2);
+        REQUIRE(tgui::Deserializer::getCacheHits() == 2);
+
+        // Errors are not cached
+        REQUIRE_THROWS_AS(tgui::Deserializer::deserialize(Type::Color, "RandomString"), tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::Deserializer::deserialize(Type::Color, "RandomString"), tgui::Exception);
+
+        tgui::Deserializer::setCacheCapacity(1024);
+        tgui::Deserializer::setCacheEnabled(false);
+        tgui::Deserializer::clearCache();
+    }
 }
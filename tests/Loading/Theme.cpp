@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "../catch.hpp"
+#include <fstream>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Widgets/EditBox.hpp>
@@ -35,6 +36,7 @@ namespace tgui
         static auto& getFilename(tgui::Theme::Ptr theme) { return theme->m_filename; }
         static auto& getResourcePath(tgui::Theme::Ptr theme) { return theme->m_resourcePath; }
         static auto& getWidgets(tgui::Theme::Ptr theme) { return theme->m_widgets; }
+        static auto& getClassWidgets(tgui::Theme::Ptr theme) { return theme->m_classWidgets; }
         static auto& getWidgetTypes(tgui::Theme::Ptr theme) { return theme->m_widgetTypes; }
         static auto& getWidgetProperties(tgui::Theme::Ptr theme) { return theme->m_widgetProperties; }
     };
@@ -71,7 +73,7 @@ TEST_CASE("[Theme]") {
             REQUIRE(tgui::ThemeTest::getWidgets(theme).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).begin()->first == "button");
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).begin()->second == "button");
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).begin()->second == tgui::WidgetType{"Button"});
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme).empty());
 
             button = nullptr;
@@ -90,7 +92,7 @@ TEST_CASE("[Theme]") {
             REQUIRE(tgui::ThemeTest::getWidgets(theme).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).begin()->first == "button");
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).begin()->second == "button");
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).begin()->second == tgui::WidgetType{"Button"});
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme).begin()->first == "button");
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme).begin()->second.size() > 0);
@@ -145,7 +147,7 @@ TEST_CASE("[Theme]") {
             REQUIRE(tgui::ThemeTest::getWidgets(theme1).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).begin()->first == "button1");
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).begin()->second == "button");
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).begin()->second == tgui::WidgetType{"Button"});
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme1).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme1).begin()->first == "button1");
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme1).begin()->second.size() == 1);
@@ -162,7 +164,7 @@ TEST_CASE("[Theme]") {
             REQUIRE(tgui::ThemeTest::getWidgets(theme1).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).begin()->first == "button1");
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).begin()->second == "button");
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).begin()->second == tgui::WidgetType{"Button"});
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme1).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme1).begin()->first == "button1");
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme1).begin()->second.size() == 1);
@@ -193,9 +195,9 @@ TEST_CASE("[Theme]") {
             REQUIRE(tgui::ThemeTest::getWidgets(theme)[button2.get()] == "button2");
             REQUIRE(tgui::ThemeTest::getWidgets(theme)[button3.get()] == "button3");
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).size() == 3);
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button1"] == "button");
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button2"] == "button");
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button3"] == "button");
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button1"] == tgui::WidgetType{"Button"});
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button2"] == tgui::WidgetType{"Button"});
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button3"] == tgui::WidgetType{"Button"});
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme).size() == 3);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme)["button1"].size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme)["button2"].size() == 1);
@@ -212,7 +214,10 @@ TEST_CASE("[Theme]") {
             REQUIRE(tgui::ThemeTest::getWidgets(theme)[button1.get()] == "button2");
             REQUIRE(tgui::ThemeTest::getWidgets(theme)[button2.get()] == "button2");
             REQUIRE(tgui::ThemeTest::getWidgets(theme)[button3.get()] == "button3");
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button1"] == "button");
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button1"] == tgui::WidgetType{"Button"});
+            REQUIRE(tgui::ThemeTest::getClassWidgets(theme).size() == 2);
+            REQUIRE(tgui::ThemeTest::getClassWidgets(theme)["button2"].size() == 2);
+            REQUIRE(tgui::ThemeTest::getClassWidgets(theme)["button3"].size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme)["button1"]["textcolor"] == "rgb(255, 0, 0)");
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme)["button2"]["textcolor"] == "rgb(0, 255, 0)");
             REQUIRE(button1->getRenderer()->getProperty("TextColor").getColor() == sf::Color(0, 255, 0));
@@ -234,6 +239,7 @@ TEST_CASE("[Theme]") {
             button2 = nullptr;
             button1 = nullptr;
             REQUIRE(tgui::ThemeTest::getWidgets(theme).size() == 0);
+            REQUIRE(tgui::ThemeTest::getClassWidgets(theme).size() == 0);
         }
 
         SECTION("changing single widget") {
@@ -321,6 +327,59 @@ TEST_CASE("[Theme]") {
         REQUIRE(button1->getRenderer()->getProperty("TextColor").getColor() == sf::Color(0, 255, 0));
         REQUIRE(button2->getRenderer()->getProperty("TextColor").getColor() == sf::Color(0, 0, 255));
         REQUIRE(button3->getRenderer()->getProperty("TextColor").getColor() == sf::Color(0, 0, 255));
+
+        // Properties that were changed on the widget itself are left alone when another property of its class changes
+        button1->getRenderer()->setProperty("BackgroundColorNormal", sf::Color(10, 20, 30));
+        theme->setProperty("button1", "textcolor", sf::Color(255, 255, 0));
+        REQUIRE(button1->getRenderer()->getProperty("TextColor").getColor() == sf::Color(255, 255, 0));
+        REQUIRE(button1->getRenderer()->getProperty("BackgroundColorNormal").getColor() == sf::Color(10, 20, 30));
+        REQUIRE(button2->getRenderer()->getProperty("TextColor").getColor() == sf::Color(0, 0, 255));
+    }
+
+    SECTION("reloadChangedProperties") {
+        std::ofstream file{"ThemeReloadTest.txt"};
+        file << "Button.Button1 { TextColor : rgb(255, 0, 0); BackgroundColorNormal : rgb(10, 10, 10); }" << std::endl;
+        file << "Button.Button2 { TextColor : rgb(0, 255, 0); }" << std::endl;
+        file.close();
+
+        tgui::Theme::Ptr theme = std::make_shared<tgui::Theme>("ThemeReloadTest.txt");
+        tgui::Button::Ptr button1 = theme->load("button1");
+        tgui::Button::Ptr button2 = theme->load("button2");
+        REQUIRE(!theme->reloadChangedProperties());
+
+        // Properties that were changed on the widget stay when they weren't changed in the file
+        button1->getRenderer()->setProperty("BackgroundColorNormal", sf::Color(20, 20, 20));
+        button2->getRenderer()->setProperty("TextColor", sf::Color(30, 30, 30));
+
+        file.open("ThemeReloadTest.txt");
+        file << "Button.Button1 { TextColor : rgb(0, 0, 255); BackgroundColorNormal : rgb(10, 10, 10); }" << std::endl;
+        file << "Button.Button2 { TextColor : rgb(0, 255, 0); }" << std::endl;
+        file.close();
+
+        REQUIRE(theme->reloadChangedProperties());
+        REQUIRE(theme->getProperty("button1", "TextColor") == "rgb(0, 0, 255)");
+        REQUIRE(button1->getRenderer()->getProperty("TextColor").getColor() == sf::Color(0, 0, 255));
+        REQUIRE(button1->getRenderer()->getProperty("BackgroundColorNormal").getColor() == sf::Color(20, 20, 20));
+        REQUIRE(button2->getRenderer()->getProperty("TextColor").getColor() == sf::Color(30, 30, 30));
+
+        // Removing a property reloads the widgets of the class completely
+        file.open("ThemeReloadTest.txt");
+        file << "Button.Button1 { TextColor : rgb(0, 0, 255); }" << std::endl;
+        file << "Button.Button2 { TextColor : rgb(0, 255, 0); }" << std::endl;
+        file.close();
+
+        REQUIRE(theme->reloadChangedProperties());
+        REQUIRE(button1->getRenderer()->getProperty("BackgroundColorNormal").getColor() != sf::Color(20, 20, 20));
+        REQUIRE(button2->getRenderer()->getProperty("TextColor").getColor() == sf::Color(30, 30, 30));
+
+        // Errors in the file leave the theme untouched
+        file.open("ThemeReloadTest.txt");
+        file << "Button.Button1 { TextColor : rgb(255, 255, 0); }" << std::endl;
+        file.close();
+
+        REQUIRE_THROWS_AS(theme->reloadChangedProperties(), tgui::Exception);
+        REQUIRE(theme->getProperty("button1", "TextColor") == "rgb(0, 0, 255)");
+        REQUIRE(button1->getRenderer()->getProperty("TextColor").getColor() == sf::Color(0, 0, 255));
     }
 
     SECTION("clone") {
@@ -351,6 +410,12 @@ TEST_CASE("[Theme]") {
         tgui::Theme::setConstructFunction("CustomWidget", [&](){ count++; return std::make_shared<tgui::EditBox>(); });
         theme->load("CustomWidget");
         REQUIRE(count == 1);
+
+        // The case of the type name doesn't matter when replacing the constructor of a built-in widget
+        tgui::Theme::setConstructFunction("button", [&](){ count++; return std::make_shared<tgui::Button>(); });
+        theme->load("Button");
+        REQUIRE(count == 2);
+        tgui::Theme::setConstructFunction("Button", std::make_shared<tgui::Button>);
     }
 
     SECTION("setThemeLoader") {
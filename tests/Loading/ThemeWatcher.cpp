@@ -0,0 +1,78 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "../catch.hpp"
+#include <TGUI/Loading/ThemeWatcher.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <fstream>
+
+TEST_CASE("[ThemeWatcher]") {
+    std::ofstream file{"ThemeWatcherTest.txt"};
+    file << "Button { TextColor : rgb(255, 0, 0); }" << std::endl;
+    file.close();
+
+    tgui::Theme::Ptr theme = std::make_shared<tgui::Theme>("ThemeWatcherTest.txt");
+    tgui::Button::Ptr button = theme->load("Button");
+
+    tgui::ThemeWatcher watcher;
+    REQUIRE(!watcher.isWatching());
+
+    watcher.watch(theme);
+    REQUIRE(watcher.isWatching());
+    REQUIRE(watcher.poll() == 0);
+
+    SECTION("modified file") {
+        file.open("ThemeWatcherTest.txt");
+        file << "Button { TextColor : rgb(0, 255, 0); BackgroundColorNormal : rgb(10, 20, 30); }" << std::endl;
+        file.close();
+
+        REQUIRE(watcher.poll() == 1);
+        REQUIRE(watcher.getReloadCount() == 1);
+        REQUIRE(button->getRenderer()->getProperty("TextColor").getColor() == sf::Color(0, 255, 0));
+        REQUIRE(button->getRenderer()->getProperty("BackgroundColorNormal").getColor() == sf::Color(10, 20, 30));
+
+        REQUIRE(watcher.poll() == 0);
+        REQUIRE(watcher.getReloadCount() == 1);
+    }
+
+    SECTION("unwatch") {
+        watcher.unwatch(theme);
+        REQUIRE(!watcher.isWatching());
+
+        file.open("ThemeWatcherTest.txt");
+        file << "Button { TextColor : rgb(0, 255, 0); BackgroundColorNormal : rgb(10, 20, 30); }" << std::endl;
+        file.close();
+
+        REQUIRE(watcher.poll() == 0);
+        REQUIRE(button->getRenderer()->getProperty("TextColor").getColor() == sf::Color(255, 0, 0));
+    }
+
+    SECTION("destroyed theme") {
+        button = nullptr;
+        theme = nullptr;
+        REQUIRE(watcher.poll() == 0);
+        REQUIRE(!watcher.isWatching());
+    }
+}
@@ -0,0 +1,103 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "../catch.hpp"
+#include <TGUI/Loading/WidgetLoader.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+TEST_CASE("[WidgetLoader]") {
+    std::string data = "Panel.Hidden {\n"
+                       "    Visible: false;\n"
+                       "    Button.Child1 {}\n"
+                       "    Panel.Inner {\n"
+                       "        Button.Child2 {}\n"
+                       "    }\n"
+                       "}\n"
+                       "Panel.Shown {\n"
+                       "    Button.Child3 {}\n"
+                       "}\n";
+
+    auto parent = std::make_shared<tgui::Panel>();
+
+    SECTION("eager") {
+        tgui::WidgetLoader::resetMaterializedWidgetCount();
+
+        std::stringstream stream{data};
+        tgui::WidgetLoader::load(parent, stream);
+
+        REQUIRE(tgui::WidgetLoader::getMaterializedWidgetCount() == 6);
+        REQUIRE(!parent->get<tgui::Panel>("Hidden")->hasPendingWidgets());
+    }
+
+    SECTION("lazy") {
+        tgui::WidgetLoader::setLazyLoadingEnabled(true);
+        tgui::WidgetLoader::resetMaterializedWidgetCount();
+
+        std::stringstream stream{data};
+        tgui::WidgetLoader::load(parent, stream);
+
+        REQUIRE(tgui::WidgetLoader::getMaterializedWidgetCount() == 3);
+        REQUIRE(parent->getWidgets().size() == 2);
+
+        auto hidden = parent->get<tgui::Panel>("Hidden");
+        REQUIRE(hidden->hasPendingWidgets());
+        REQUIRE(!parent->get<tgui::Panel>("Shown")->hasPendingWidgets());
+
+        SECTION("get") {
+            REQUIRE(parent->get("Child3", true) != nullptr);
+            REQUIRE(hidden->hasPendingWidgets());
+
+            REQUIRE(parent->get("Child2", true) != nullptr);
+            REQUIRE(!hidden->hasPendingWidgets());
+            REQUIRE(tgui::WidgetLoader::getMaterializedWidgetCount() == 6);
+        }
+
+        SECTION("show") {
+            hidden->show();
+            REQUIRE(!hidden->hasPendingWidgets());
+            REQUIRE(hidden->getWidgets().size() == 2);
+            REQUIRE(tgui::WidgetLoader::getMaterializedWidgetCount() == 6);
+        }
+
+        SECTION("LazyLoad property") {
+            parent->removeAllWidgets();
+            std::stringstream stream2{"Panel.Visible {\n"
+                                      "    LazyLoad: true;\n"
+                                      "    Button.Child {}\n"
+                                      "}\n"
+                                      "Panel.Invisible {\n"
+                                      "    Visible: false;\n"
+                                      "    LazyLoad: false;\n"
+                                      "    Button.Child {}\n"
+                                      "}\n"};
+            tgui::WidgetLoader::load(parent, stream2);
+
+            REQUIRE(parent->get<tgui::Panel>("Visible")->hasPendingWidgets());
+            REQUIRE(!parent->get<tgui::Panel>("Invisible")->hasPendingWidgets());
+        }
+
+        tgui::WidgetLoader::setLazyLoadingEnabled(false);
+    }
+}
@@ -0,0 +1,116 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../catch.hpp"
+#include <TGUI/Loading/WidgetSaver.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/ChatBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+TEST_CASE("[WidgetSaver]") {
+    auto parent = std::make_shared<tgui::Panel>();
+
+    auto panel = std::make_shared<tgui::Panel>();
+    panel->setPosition(10, 20);
+    parent->add(panel, "Panel");
+
+    auto button = std::make_shared<tgui::Button>();
+    button->setText("Text");
+    panel->add(button, "Button");
+
+    auto chatBox = std::make_shared<tgui::ChatBox>();
+    chatBox->addLine("L1");
+    chatBox->addLine("L2", sf::Color::Red);
+    parent->add(chatBox);
+
+    SECTION("Emitter") {
+        std::stringstream stream;
+        {
+            tgui::DataIO::Emitter emitter{stream};
+            emitter.beginSection("Section");
+            emitter.setProperty("b", "2");
+            emitter.setProperty("a", "1");
+            emitter.beginSection("Child");
+            emitter.endSection();
+            emitter.beginSection("");
+            emitter.setProperty("c", "3");
+            emitter.endSection();
+            emitter.endSection();
+        }
+
+        REQUIRE(stream.str() == "Section {\n    a: 1;\n    b: 2;\n\n    Child {\n    }\n\n    {\n        c: 3;\n    }\n}\n");
+    }
+
+    SECTION("Same output as node tree") {
+        std::stringstream streamed;
+        tgui::WidgetSaver::save(parent, streamed);
+
+        auto rootNode = std::make_shared<tgui::DataIO::Node>();
+        for (auto& widget : parent->getWidgets())
+            rootNode->children.push_back(tgui::WidgetSaver::getSaveFunction(widget->getWidgetType())(tgui::WidgetConverter{widget}));
+
+        std::stringstream emitted;
+        tgui::DataIO::emit(rootNode, emitted);
+
+        REQUIRE(streamed.str() == emitted.str());
+        REQUIRE(streamed.str().find("Panel.Panel {") == 0);
+        REQUIRE(streamed.str().find("        Button.Button {") != std::string::npos);
+        REQUIRE(streamed.str().find("    Line {") != std::string::npos);
+    }
+
+    SECTION("Custom save functions") {
+        auto oldSaveFunction = tgui::WidgetSaver::getStreamSaveFunction("Button");
+
+        tgui::WidgetSaver::setSaveFunction("Button", [](tgui::WidgetConverter){
+                auto node = std::make_shared<tgui::DataIO::Node>();
+                node->name = "CustomButton";
+                node->propertyValuePairs["Custom"] = std::make_shared<tgui::DataIO::ValueNode>(node.get(), "1");
+                return node;
+            });
+
+        std::ostringstream stream;
+        tgui::WidgetSaver::save(panel, stream);
+        REQUIRE(stream.str() == "CustomButton {\n    Custom: 1;\n}\n");
+
+        tgui::WidgetSaver::setStreamSaveFunction("Button", [](tgui::WidgetConverter, tgui::DataIO::Emitter& emitter){
+                emitter.setProperty("Streamed", "1");
+            });
+
+        stream.str("");
+        tgui::WidgetSaver::save(panel, stream);
+        REQUIRE(stream.str() == "Button.Button {\n    Streamed: 1;\n}\n");
+
+        tgui::WidgetSaver::setStreamSaveFunction("Button", oldSaveFunction);
+    }
+
+    SECTION("Unknown widget type") {
+        auto oldSaveFunction = tgui::WidgetSaver::getStreamSaveFunction("Button");
+        tgui::WidgetSaver::setSaveFunction("Button", nullptr);
+
+        std::ostringstream stream;
+        REQUIRE_THROWS_AS(tgui::WidgetSaver::save(panel, stream), tgui::Exception);
+
+        tgui::WidgetSaver::setStreamSaveFunction("Button", oldSaveFunction);
+    }
+}
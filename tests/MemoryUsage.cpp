@@ -0,0 +1,116 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/ListBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+
+TEST_CASE("[MemoryUsage]") {
+    SECTION("Widget") {
+        auto label = std::make_shared<tgui::Label>();
+        auto usage = label->getMemoryUsage();
+        REQUIRE(usage.widget >= sizeof(tgui::Label));
+        REQUIRE(usage.renderer >= sizeof(tgui::LabelRenderer));
+        REQUIRE(usage.signals > 0);
+        REQUIRE(usage.getTotal() == usage.widget + usage.renderer + usage.text + usage.signals + usage.textures);
+
+        const std::size_t emptyTextUsage = usage.text;
+        label->setText(std::string(1000, 'x'));
+        REQUIRE(label->getMemoryUsage().text >= emptyTextUsage + 1000 * sizeof(sf::Uint32));
+    }
+
+    SECTION("Strings") {
+        // Whether a short string is stored inside the object depends on the standard library, but a long one never is
+        std::string shortString = "x";
+        REQUIRE(tgui::priv::getHeapMemoryUsage(shortString) <= shortString.capacity() + 1);
+
+        std::string longString(1000, 'x');
+        REQUIRE(tgui::priv::getHeapMemoryUsage(longString) == longString.capacity() + 1);
+    }
+
+    SECTION("Signals") {
+        auto button = std::make_shared<tgui::Button>();
+        const std::size_t signalsUsage = button->getMemoryUsage().signals;
+
+        button->connect("Pressed", [](){});
+        REQUIRE(button->getMemoryUsage().signals > signalsUsage);
+    }
+
+    SECTION("Items") {
+        auto listBox = std::make_shared<tgui::ListBox>();
+        const std::size_t emptyUsage = listBox->getMemoryUsage().getTotal();
+
+        for (unsigned int i = 0; i < 100; ++i)
+            listBox->addItem("Item " + tgui::to_string(i), tgui::to_string(i));
+
+        // Every item contains a label
+        REQUIRE(listBox->getMemoryUsage().getTotal() >= emptyUsage + 100 * sizeof(tgui::Label));
+        REQUIRE(listBox->getMemoryUsage().text > 100 * sizeof(sf::Uint32));
+    }
+
+    SECTION("Shared textures") {
+        auto picture1 = std::make_shared<tgui::Picture>("resources/Black.png");
+        const std::size_t textureUsage = picture1->getMemoryUsage().textures;
+        REQUIRE(textureUsage > 0);
+
+        // Both pictures share the same image
+        auto picture2 = std::make_shared<tgui::Picture>("resources/Black.png");
+        REQUIRE(picture1->getMemoryUsage().textures < textureUsage);
+        REQUIRE(picture1->getMemoryUsage().textures == picture2->getMemoryUsage().textures);
+
+        picture2 = nullptr;
+        REQUIRE(picture1->getMemoryUsage().textures == textureUsage);
+    }
+
+    SECTION("Gui") {
+        tgui::Gui gui;
+        REQUIRE(gui.getMemoryUsageByType().empty());
+
+        auto panel = std::make_shared<tgui::Panel>();
+        panel->add(std::make_shared<tgui::Label>());
+        panel->add(std::make_shared<tgui::Label>());
+        gui.add(panel);
+        gui.add(std::make_shared<tgui::Button>());
+
+        auto usageByType = gui.getMemoryUsageByType();
+        REQUIRE(usageByType.size() == 3);
+        REQUIRE(usageByType.count("Panel") == 1);
+        REQUIRE(usageByType.count("Button") == 1);
+        REQUIRE(usageByType["Label"].getTotal() >= 2 * sizeof(tgui::Label));
+
+        std::size_t total = 0;
+        for (const auto& pair : usageByType)
+            total += pair.second.getTotal();
+
+        REQUIRE(gui.getMemoryUsage().getTotal() > total);
+
+        // A simple screen like this should stay well below a megabyte
+        REQUIRE(gui.getMemoryUsage().getTotal() < 1024 * 1024);
+    }
+}
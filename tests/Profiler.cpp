@@ -0,0 +1,112 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Profiler.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <sstream>
+
+TEST_CASE("[Profiler]") {
+    tgui::Profiler::clear();
+
+    SECTION("Zones") {
+        auto button = std::make_shared<tgui::Button>();
+        {
+            tgui::Profiler::Zone outer{"Outer"};
+            tgui::Profiler::Zone inner{"Inner", button.get(), "OkButton"};
+        }
+
+        auto events = tgui::Profiler::getEvents();
+        REQUIRE(events.size() == 2);
+
+        // The inner zone ends first
+        REQUIRE(events[0].name == "Inner");
+        REQUIRE(events[0].widgetType == "Button");
+        REQUIRE(events[0].widgetName == "OkButton");
+        REQUIRE(events[1].name == "Outer");
+        REQUIRE(events[1].widgetType == "");
+        REQUIRE(events[1].start <= events[0].start);
+        REQUIRE(events[1].duration >= events[0].duration);
+        REQUIRE(events[0].threadId == events[1].threadId);
+
+        tgui::Profiler::clear();
+        REQUIRE(tgui::Profiler::getEvents().empty());
+    }
+
+    SECTION("Enabled") {
+        REQUIRE(tgui::Profiler::isEnabled());
+        tgui::Profiler::setEnabled(false);
+        REQUIRE(!tgui::Profiler::isEnabled());
+        {
+            tgui::Profiler::Zone zone{"Zone"};
+        }
+        REQUIRE(tgui::Profiler::getEvents().empty());
+
+        tgui::Profiler::setEnabled(true);
+        {
+            tgui::Profiler::Zone zone{"Zone"};
+        }
+        REQUIRE(tgui::Profiler::getEvents().size() == 1);
+    }
+
+    SECTION("Capacity") {
+        const std::size_t oldCapacity = tgui::Profiler::getCapacity();
+
+        tgui::Profiler::setCapacity(3);
+        REQUIRE(tgui::Profiler::getCapacity() == 4);
+
+        const char* names[] = {"0", "1", "2", "3", "4", "5"};
+        for (const char* name : names)
+            tgui::Profiler::Zone zone{name};
+
+        // Only the newest zones are kept
+        auto events = tgui::Profiler::getEvents();
+        REQUIRE(events.size() == 4);
+        REQUIRE(events[0].name == "2");
+        REQUIRE(events[3].name == "5");
+
+        tgui::Profiler::setCapacity(oldCapacity);
+        REQUIRE(tgui::Profiler::getEvents().empty());
+    }
+
+    SECTION("Chrome trace") {
+        auto button = std::make_shared<tgui::Button>();
+        {
+            tgui::Profiler::Zone zone{"Draw", button.get(), "Say \"hi\""};
+        }
+
+        std::stringstream stream;
+        tgui::Profiler::exportChromeTrace(stream);
+
+        const std::string trace = stream.str();
+        REQUIRE(trace.find("\"traceEvents\":[") != std::string::npos);
+        REQUIRE(trace.find("\"name\":\"Draw\"") != std::string::npos);
+        REQUIRE(trace.find("\"ph\":\"X\"") != std::string::npos);
+        REQUIRE(trace.find("\"type\":\"Button\"") != std::string::npos);
+        REQUIRE(trace.find("\"widget\":\"Say \\\"hi\\\"\"") != std::string::npos);
+    }
+
+    tgui::Profiler::clear();
+}
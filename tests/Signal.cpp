@@ -23,7 +23,9 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Tests.hpp"
+#include <TGUI/Gui.hpp>
 #include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Slider.hpp>
 
 TEST_CASE("[Signal]") {
     tgui::Widget::Ptr widget = std::make_shared<tgui::Button>();
@@ -96,4 +98,94 @@ TEST_CASE("[Signal]") {
         widget->setSize(200, 50);
         REQUIRE(i == 2);
     }
+
+    SECTION("DeliveryPolicy") {
+        tgui::Gui gui;
+        gui.add(widget);
+
+        SECTION("Coalesced") {
+            auto slider = std::make_shared<tgui::Slider>();
+            slider->setSize(200, 20);
+            slider->setMaximum(200);
+            gui.add(slider);
+
+            std::vector<int> coalescedValues;
+            unsigned int immediateCount = 0;
+            slider->connect(tgui::DeliveryPolicy::coalesced(), "ValueChanged", [&](int value){ coalescedValues.push_back(value); });
+            slider->connect("ValueChanged", [&](){ immediateCount++; });
+
+            // Drag the thumb, with several mouse move events per frame
+            slider->leftMousePressed(10, 10);
+            for (unsigned int frame = 0; frame < 5; ++frame)
+            {
+                for (unsigned int step = 0; step < 10; ++step)
+                    slider->mouseMoved(20.f + frame * 30 + step * 3, 10);
+
+                REQUIRE(coalescedValues.size() == frame);
+                gui.updateTime(sf::milliseconds(16));
+                REQUIRE(coalescedValues.size() == frame + 1);
+                REQUIRE(coalescedValues.back() == slider->getValue());
+            }
+            slider->leftMouseReleased(170, 10);
+
+            REQUIRE(immediateCount >= 50);
+
+            // Nothing is delivered in frames where the value didn't change
+            gui.updateTime(sf::milliseconds(16));
+            REQUIRE(coalescedValues.size() == 5);
+        }
+
+        SECTION("RateLimited") {
+            std::vector<sf::Vector2f> positions;
+            widget->connect(tgui::DeliveryPolicy::rateLimited(sf::milliseconds(100)), "PositionChanged",
+                            [&](sf::Vector2f position){ positions.push_back(position); });
+
+            // The first time the function is called immediately
+            widget->setPosition(1, 1);
+            REQUIRE(positions.size() == 1);
+
+            widget->setPosition(2, 2);
+            widget->setPosition(3, 3);
+            gui.updateTime(sf::milliseconds(50));
+            REQUIRE(positions.size() == 1);
+
+            gui.updateTime(sf::milliseconds(60));
+            REQUIRE(positions.size() == 2);
+            REQUIRE(positions.back() == sf::Vector2f(3, 3));
+
+            gui.updateTime(sf::milliseconds(200));
+            REQUIRE(positions.size() == 2);
+
+            widget->setPosition(4, 4);
+            REQUIRE(positions.size() == 3);
+        }
+
+        SECTION("setDeliveryPolicy") {
+            unsigned int count = 0;
+            tgui::Callback lastCallback;
+            const unsigned int id = widget->connectEx("SizeChanged", [&](const tgui::Callback& callback){ count++; lastCallback = callback; });
+            widget->setDeliveryPolicy(id, tgui::DeliveryPolicy::coalesced());
+
+            widget->setSize(100, 20);
+            widget->setSize(120, 30);
+            REQUIRE(count == 0);
+            gui.updateTime(sf::milliseconds(16));
+            REQUIRE(count == 1);
+            REQUIRE(lastCallback.trigger == "SizeChanged");
+            REQUIRE(lastCallback.size == sf::Vector2f(120, 30));
+
+            widget->setDeliveryPolicy(id, tgui::DeliveryPolicy::immediate());
+            widget->setSize(140, 30);
+            REQUIRE(count == 2);
+
+            // Pending calls are dropped when disconnecting
+            widget->setDeliveryPolicy(id, tgui::DeliveryPolicy::coalesced());
+            widget->setSize(160, 30);
+            widget->disconnect(id);
+            gui.updateTime(sf::milliseconds(16));
+            REQUIRE(count == 2);
+
+            REQUIRE_THROWS_AS(widget->setDeliveryPolicy(id, tgui::DeliveryPolicy::coalesced()), tgui::Exception);
+        }
+    }
 }
@@ -0,0 +1,200 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/TextLayout.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+namespace
+{
+    const sf::String texts[] = {
+        "",
+        "Short",
+        "A somewhat longer text that has to be split over multiple lines",
+        "Line 1\nLine 2\n\nLine 4",
+        "Tabs\tand  double  spaces\t\tare kept",
+        "Averyveryverylongwordthatdoesnotfitonthelineatall but is followed by short ones",
+        " leading and trailing spaces "
+    };
+
+    std::vector<tgui::Label::Ptr> createLabels(tgui::Container& container)
+    {
+        std::vector<tgui::Label::Ptr> labels;
+        for (std::size_t i = 0; i < 3 * sizeof(texts) / sizeof(texts[0]); ++i)
+        {
+            auto label = std::make_shared<tgui::Label>();
+            label->setText(texts[i % (sizeof(texts) / sizeof(texts[0]))]);
+            label->setTextSize(static_cast<unsigned int>(12 + 4 * (i % 3)));
+            if (i % 2)
+                label->setMaximumTextWidth(100);
+            else if (i % 3)
+            {
+                label->setSize(120, 60);
+                label->setTextStyle(sf::Text::Bold);
+            }
+
+            container.add(label);
+            labels.push_back(label);
+        }
+
+        return labels;
+    }
+}
+
+TEST_CASE("[TextLayout]") {
+    tgui::Font font{"resources/DroidSansArmenian.ttf"};
+
+    SECTION("wrapText") {
+        auto result = tgui::priv::wrapText("Line 1\nLine 2", 0, *font.getFont(), 18, false);
+        REQUIRE(result.lines.size() == 2);
+        REQUIRE(result.lines[0].start == 0);
+        REQUIRE(result.lines[0].length == 7);
+        REQUIRE(!result.lines[0].wrapped);
+        REQUIRE(result.lines[1].start == 7);
+        REQUIRE(result.lines[1].length == 6);
+        REQUIRE(result.width > 0);
+
+        result = tgui::priv::wrapText("One two three", 1, *font.getFont(), 18, false);
+        REQUIRE(result.lines.size() > 1);
+        REQUIRE(result.lines[0].wrapped);
+        REQUIRE(!result.lines.back().wrapped);
+
+        REQUIRE(tgui::priv::wrapText("", 0, *font.getFont(), 18, false).lines.empty());
+    }
+
+    SECTION("GlyphMetrics") {
+        for (const auto& text : texts)
+        {
+            tgui::priv::GlyphMetrics metrics{*font.getFont(), 20, false};
+            metrics.prepare(text);
+
+            for (const float maxWidth : {0.f, 50.f, 150.f})
+            {
+                const auto expected = tgui::priv::wrapText(text, maxWidth, *font.getFont(), 20, false);
+                const auto result = tgui::priv::wrapText(text, maxWidth, metrics);
+                REQUIRE(result.width == expected.width);
+                REQUIRE(result.lines.size() == expected.lines.size());
+                for (std::size_t i = 0; i < result.lines.size(); ++i)
+                {
+                    REQUIRE(result.lines[i].start == expected.lines[i].start);
+                    REQUIRE(result.lines[i].length == expected.lines[i].length);
+                    REQUIRE(result.lines[i].wrapped == expected.lines[i].wrapped);
+                }
+            }
+        }
+    }
+
+    SECTION("Batch") {
+        REQUIRE(!tgui::TextLayoutBatch::isActive());
+        {
+            tgui::TextLayoutBatch batch;
+            REQUIRE(tgui::TextLayoutBatch::isActive());
+            {
+                tgui::TextLayoutBatch nestedBatch;
+                REQUIRE(tgui::TextLayoutBatch::isActive());
+            }
+            REQUIRE(tgui::TextLayoutBatch::isActive());
+        }
+        REQUIRE(!tgui::TextLayoutBatch::isActive());
+
+        auto threadCount = tgui::TextLayoutBatch::getThreadCount();
+        REQUIRE(threadCount >= 1);
+        tgui::TextLayoutBatch::setThreadCount(3);
+        REQUIRE(tgui::TextLayoutBatch::getThreadCount() == 3);
+        tgui::TextLayoutBatch::setThreadCount(0);
+        REQUIRE(tgui::TextLayoutBatch::getThreadCount() == threadCount);
+    }
+
+    SECTION("Same result as without batch") {
+        auto serialPanel = std::make_shared<tgui::Panel>();
+        auto batchedPanel = std::make_shared<tgui::Panel>();
+        auto serialLabels = createLabels(*serialPanel);
+        auto batchedLabels = createLabels(*batchedPanel);
+
+        for (auto& label : serialLabels)
+            label->setFont(font);
+
+        // Use multiple threads even though there are only a few labels
+        tgui::TextLayoutBatch::setThreadCount(4);
+        batchedPanel->setFont(font);
+        tgui::TextLayoutBatch::setThreadCount(0);
+
+        for (std::size_t i = 0; i < serialLabels.size(); ++i)
+        {
+            REQUIRE(batchedLabels[i]->getSize() == serialLabels[i]->getSize());
+            REQUIRE(batchedLabels[i]->getTextSize() == serialLabels[i]->getTextSize());
+        }
+
+        {
+            tgui::TextLayoutBatch batch;
+            for (auto& label : batchedLabels)
+                label->setTextSize(label->getTextSize() + 2);
+        }
+
+        for (auto& label : serialLabels)
+            label->setTextSize(label->getTextSize() + 2);
+
+        for (std::size_t i = 0; i < serialLabels.size(); ++i)
+            REQUIRE(batchedLabels[i]->getSize() == serialLabels[i]->getSize());
+    }
+
+    SECTION("Size is available inside batch") {
+        auto panel = std::make_shared<tgui::Panel>();
+        auto label = std::make_shared<tgui::Label>();
+        label->setText("Text");
+        panel->add(label);
+
+        auto reference = std::make_shared<tgui::Label>();
+        reference->setText("Text");
+        reference->setFont(font);
+
+        tgui::TextLayoutBatch batch;
+        label->setFont(font);
+        REQUIRE(label->getSize() == reference->getSize());
+
+        label->setText("Other text");
+        reference->setText("Other text");
+        REQUIRE(label->getSize() == reference->getSize());
+
+        // Copies are not part of the batch, so they are laid out immediately. The size is checked without calling
+        // Label::getSize because that function would lay out a pending text.
+        label->setText("Copied text");
+        reference->setText("Copied text");
+        auto copy = tgui::Label::copy(label);
+        REQUIRE(copy->tgui::ClickableWidget::getSize() == reference->getSize());
+
+        tgui::Label assigned;
+        assigned = *label;
+        REQUIRE(assigned.tgui::ClickableWidget::getSize() == reference->getSize());
+
+        // A label that is destroyed before the batch ends is forgotten by the batch
+        auto removedLabel = std::make_shared<tgui::Label>();
+        panel->add(removedLabel);
+        removedLabel->setFont(font);
+        panel->remove(removedLabel);
+        removedLabel = nullptr;
+    }
+}
@@ -0,0 +1,116 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+#include <TGUI/VertexCache.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+TEST_CASE("[VertexCache]") {
+    tgui::priv::VertexCache cache;
+
+    SECTION("Rebuild") {
+        REQUIRE(cache.update({100, 50}, 0, 1));
+        cache.addRect({0, 0}, {100, 50}, sf::Color::Red);
+        REQUIRE(cache.getVertexCount() == 6);
+
+        // Nothing changed, so the geometry is kept
+        REQUIRE(!cache.update({100, 50}, 0, 1));
+        REQUIRE(cache.getVertexCount() == 6);
+
+        REQUIRE(cache.update({100, 60}, 0, 1));
+        REQUIRE(cache.getVertexCount() == 0);
+        REQUIRE(!cache.update({100, 60}, 0, 1));
+
+        REQUIRE(cache.update({100, 60}, 1, 1));
+        REQUIRE(!cache.update({100, 60}, 1, 1));
+
+        REQUIRE(cache.update({100, 60}, 1, 0.5f));
+        REQUIRE(!cache.update({100, 60}, 1, 0.5f));
+
+        cache.invalidate();
+        REQUIRE(cache.update({100, 60}, 1, 0.5f));
+    }
+
+    SECTION("Geometry") {
+        cache.update({100, 50}, 0, 1);
+
+        // Empty and fully transparent rectangles are skipped
+        cache.addRect({0, 0}, {0, 50}, sf::Color::Red);
+        cache.addRect({0, 0}, {100, 50}, sf::Color::Transparent);
+        REQUIRE(cache.getVertexCount() == 0);
+
+        cache.addBorders({0, 0}, {100, 50}, {1, 2, 3, 4}, sf::Color::Blue);
+        REQUIRE(cache.getVertexCount() == 24);
+
+        cache.update({100, 50}, 1, 1);
+        cache.addBorders({0, 0}, {100, 50}, {1, 0, 1, 0}, sf::Color::Blue);
+        REQUIRE(cache.getVertexCount() == 12);
+    }
+
+    SECTION("Renderer properties") {
+        sf::RenderTexture target;
+        target.create(40, 30);
+        tgui::Gui gui{target};
+
+        auto button = std::make_shared<tgui::Button>();
+        button->setPosition(10, 10);
+        button->setSize(20, 10);
+        button->getRenderer()->setBorders({0, 0, 0, 0});
+        button->getRenderer()->setBackgroundColor(sf::Color::Red);
+        gui.add(button);
+
+        auto getPixel = [&](unsigned int x, unsigned int y){
+            target.clear(sf::Color::Black);
+            gui.draw();
+            target.display();
+            return target.getTexture().copyToImage().getPixel(x, y);
+        };
+
+        REQUIRE(getPixel(20, 15) == sf::Color::Red);
+
+        // Changing a property of the renderer updates the retained geometry
+        button->getRenderer()->setBackgroundColor(sf::Color::Green);
+        REQUIRE(getPixel(20, 15) == sf::Color::Green);
+
+        button->getRenderer()->setBorderColor(sf::Color::Blue);
+        REQUIRE(getPixel(9, 15) == sf::Color::Black);
+        button->getRenderer()->setBorders({2, 2, 2, 2});
+        REQUIRE(getPixel(9, 15) == sf::Color::Blue);
+
+        // Moving the widget doesn't require the geometry to be rebuilt, but it is still drawn at the new position
+        button->setPosition(0, 0);
+        REQUIRE(getPixel(5, 5) == sf::Color::Green);
+        REQUIRE(getPixel(25, 15) == sf::Color::Black);
+
+        button->setSize(30, 20);
+        REQUIRE(getPixel(25, 15) == sf::Color::Green);
+
+        button->setOpacity(0);
+        REQUIRE(getPixel(5, 5) == sf::Color::Black);
+    }
+}
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/TGUI.hpp>
+#include <TGUI/Widgets/devel/Table.hpp>
 
 TEST_CASE("[Widget]") {
     tgui::Widget::Ptr widget = std::make_shared<tgui::Button>();
@@ -62,6 +63,63 @@ TEST_CASE("[Widget]") {
         REQUIRE(widget->getParent() == nullptr);
     }
 
+    SECTION("AbsolutePosition") {
+        tgui::Panel::Ptr panel1 = std::make_shared<tgui::Panel>();
+        tgui::Panel::Ptr panel2 = std::make_shared<tgui::Panel>();
+        tgui::ChildWindow::Ptr childWindow = std::make_shared<tgui::ChildWindow>();
+        panel1->setPosition(10, 20);
+        panel2->setPosition(30, 40);
+        widget->setPosition(50, 60);
+
+        panel2->add(widget);
+        panel1->add(panel2);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(90, 120));
+
+        // The position changes when a parent moves
+        panel1->setPosition(100, 200);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(180, 300));
+        panel2->setPosition(0, 0);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(150, 260));
+        widget->setPosition(5, 6);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(105, 206));
+
+        // The position changes when a layout moves the widget
+        widget->setPosition(tgui::bindRight(panel1), 0);
+        panel1->setSize(300, 100);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(500, 200));
+
+        // The position changes when the widget is moved to another parent
+        panel2->remove(widget);
+        REQUIRE(widget->getAbsolutePosition() == widget->getPosition());
+
+        // The child widgets of a child window are placed below the title bar
+        widget->setPosition(5, 6);
+        childWindow->setPosition(100, 200);
+        childWindow->getRenderer()->setBorders({1, 2, 3, 4});
+        childWindow->getRenderer()->setTitleBarHeight(20);
+        childWindow->add(widget);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(106, 228));
+
+        childWindow->getRenderer()->setTitleBarHeight(30);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(106, 238));
+        childWindow->getRenderer()->setBorders({2, 2, 2, 2});
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(107, 238));
+
+        // The header of a table isn't stored with the other widgets of the table but still moves with it
+        tgui::Table::Ptr table = std::make_shared<tgui::Table>();
+        tgui::TableRow::Ptr header = std::make_shared<tgui::TableRow>();
+        header->addItem("Header");
+        table->setHeader(header);
+        table->setPosition(10, 20);
+        panel1->add(table);
+        REQUIRE(header->getAbsolutePosition() == sf::Vector2f(110, 220));
+
+        panel1->setPosition(40, 50);
+        REQUIRE(header->getAbsolutePosition() == sf::Vector2f(50, 70));
+        table->setPosition(0, 0);
+        REQUIRE(header->getAbsolutePosition() == sf::Vector2f(40, 50));
+    }
+
     SECTION("Opacity") {
         REQUIRE(widget->getOpacity() == 1.f);
 
@@ -0,0 +1,108 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/WidgetType.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/CheckBox.hpp>
+#include <sstream>
+
+TEST_CASE("[WidgetType]") {
+    SECTION("Unknown") {
+        tgui::WidgetType type;
+        REQUIRE(type.getId() == 0);
+        REQUIRE(type.getName() == "Unknown");
+        REQUIRE(type == tgui::WidgetType{"Unknown"});
+    }
+
+    SECTION("Interning") {
+        tgui::WidgetType type1{"Button"};
+        tgui::WidgetType type2{std::string{"Button"}};
+        REQUIRE(type1 == type2);
+        REQUIRE(type1.getId() == type2.getId());
+        REQUIRE(&type1.getName() == &type2.getName());
+        REQUIRE(type1.getLowercaseName() == "button");
+
+        REQUIRE(type1 != tgui::WidgetType{"CheckBox"});
+        REQUIRE(type1 != tgui::WidgetType{"button"});
+    }
+
+    SECTION("Custom types") {
+        const unsigned int count = tgui::WidgetType::getTypeCount();
+
+        tgui::WidgetType type{"WidgetTypeTestCustomWidget"};
+        REQUIRE(type.getId() == count);
+        REQUIRE(tgui::WidgetType::getTypeCount() == count + 1);
+
+        REQUIRE(tgui::WidgetType{"WidgetTypeTestCustomWidget"}.getId() == count);
+        REQUIRE(tgui::WidgetType::getTypeCount() == count + 1);
+    }
+
+    SECTION("Lookup by lowercase name") {
+        REQUIRE(tgui::WidgetType::findByLowercaseName("button") == tgui::WidgetType{"Button"});
+        REQUIRE(tgui::WidgetType::findByLowercaseName("progressbar") == tgui::WidgetType{"ProgressBar"});
+
+        // Unknown names are not registered
+        const unsigned int count = tgui::WidgetType::getTypeCount();
+        REQUIRE(tgui::WidgetType::findByLowercaseName("widgettypetestunregistered").getId() == 0);
+        REQUIRE(tgui::WidgetType::getTypeCount() == count);
+    }
+
+    SECTION("String compatibility") {
+        tgui::WidgetType type{"Button"};
+        REQUIRE(type == "Button");
+        REQUIRE("Button" == type);
+        REQUIRE(type == std::string{"Button"});
+        REQUIRE(type != "CheckBox");
+
+        const std::string& name = type;
+        REQUIRE(name == "Button");
+
+        std::stringstream stream;
+        stream << type;
+        REQUIRE(stream.str() == "Button");
+    }
+
+    SECTION("Widgets") {
+        auto button = std::make_shared<tgui::Button>();
+        auto checkBox = std::make_shared<tgui::CheckBox>();
+
+        REQUIRE(button->getType() == tgui::WidgetType{"Button"});
+        REQUIRE(button->getWidgetType() == "Button");
+        REQUIRE(checkBox->getType() == tgui::WidgetType{"CheckBox"});
+        REQUIRE(checkBox->getType() != button->getType());
+
+        // Copies keep their type
+        auto copy = tgui::Button::copy(button);
+        REQUIRE(copy->getType() == button->getType());
+
+        // The type is passed to the callback
+        tgui::WidgetType callbackType;
+        button->connectEx("Pressed", [&](const tgui::Callback& callback){ callbackType = callback.widgetType; });
+        button->leftMousePressed(10, 10);
+        button->leftMouseReleased(10, 10);
+        REQUIRE(callbackType == "Button");
+    }
+}
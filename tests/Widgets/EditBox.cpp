@@ -35,6 +35,22 @@ TEST_CASE("[EditBox]") {
 
         REQUIRE_NOTHROW(editBox->connect("TextChanged", [](sf::String){}));
         REQUIRE_NOTHROW(editBox->connect("ReturnKeyPressed", [](sf::String){}));
+
+        SECTION("TextChanged") {
+            editBox->disconnectAll();
+
+            sf::String receivedText;
+            editBox->connect("TextChanged", [&](const sf::String& text){ receivedText = text; });
+            editBox->textEntered('a');
+            editBox->textEntered('b');
+            REQUIRE(receivedText == "ab");
+
+            sf::String callbackText;
+            editBox->connectEx("TextChanged", [&](const tgui::Callback& callback){ callbackText = callback.text; });
+            editBox->textEntered('c');
+            REQUIRE(receivedText == "abc");
+            REQUIRE(callbackText == "abc");
+        }
     }
 
     SECTION("WidgetType") {
@@ -257,6 +273,78 @@ TEST_CASE("[EditBox]") {
                 REQUIRE(editBox->getText() == "-.");
             }
         }
+
+        SECTION("Hex") {
+            editBox->setInputValidator(tgui::EditBox::Validator::Hex);
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText("09afAF");
+            REQUIRE(editBox->getText() == "09afAF");
+
+            editBox->setText("-5");
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText("0x10");
+            REQUIRE(editBox->getText() == "");
+
+            SECTION("Adding characters") {
+                editBox->setText("1");
+                editBox->textEntered('c');
+                REQUIRE(editBox->getText() == "1c");
+
+                editBox->textEntered('g');
+                REQUIRE(editBox->getText() == "1c");
+            }
+        }
+
+        SECTION("Allowed characters") {
+            editBox->setAllowedCharacters("c-ab");
+            REQUIRE(editBox->getInputValidator() == "[\\-abc]*");
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setAllowedCharacters(L"abcÊ-", 4);
+            REQUIRE(editBox->getInputValidator().substr(0, 6) == "[\\-abc");
+            REQUIRE(editBox->getInputValidator().substr(editBox->getInputValidator().size() - 6) == "]{0,4}");
+            REQUIRE(editBox->getInputValidator() == "[\\-abc\\u00CA]{0,4}");
+
+            editBox->setText(L"a-Ê");
+            REQUIRE(editBox->getText() == L"a-Ê");
+
+            editBox->setText("abcd");
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText("aaaaa");
+            REQUIRE(editBox->getText() == "");
+
+            SECTION("Adding characters") {
+                editBox->setText("ab");
+                editBox->textEntered('x');
+                REQUIRE(editBox->getText() == "ab");
+
+                editBox->textEntered('c');
+                editBox->textEntered('a');
+                REQUIRE(editBox->getText() == "abca");
+
+                editBox->textEntered('a');
+                REQUIRE(editBox->getText() == "abca");
+            }
+        }
+
+        SECTION("Custom regex") {
+            editBox->setInputValidator("[a-z][0-9]*");
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText("a12");
+            REQUIRE(editBox->getText() == "a12");
+
+            SECTION("Adding characters") {
+                editBox->textEntered('3');
+                REQUIRE(editBox->getText() == "a123");
+
+                editBox->textEntered('b');
+                REQUIRE(editBox->getText() == "a123");
+            }
+        }
     }
 
     SECTION("Renderer") {
@@ -434,6 +522,27 @@ TEST_CASE("[EditBox]") {
             REQUIRE_NOTHROW(parent->saveWidgetsToFile("WidgetFileEditBox2.txt"));
             REQUIRE(compareFiles("WidgetFileEditBox1.txt", "WidgetFileEditBox2.txt"));
         }
+
+        SECTION("Allowed characters") {
+            // Characters outside the ascii range have to survive being stored in the file
+            editBox->setAllowedCharacters(L"a\u00CA\u20AC", 3);
+            REQUIRE_NOTHROW(parent->saveWidgetsToFile("WidgetFileEditBox1.txt"));
+
+            parent->removeAllWidgets();
+            REQUIRE_NOTHROW(parent->loadWidgetsFromFile("WidgetFileEditBox1.txt"));
+            REQUIRE(parent->getWidgets().size() == 1);
+
+            auto loadedEditBox = std::dynamic_pointer_cast<tgui::EditBox>(parent->getWidgets()[0]);
+            REQUIRE(loadedEditBox->getInputValidator() == editBox->getInputValidator());
+
+            REQUIRE_NOTHROW(parent->saveWidgetsToFile("WidgetFileEditBox2.txt"));
+            REQUIRE(compareFiles("WidgetFileEditBox1.txt", "WidgetFileEditBox2.txt"));
+
+            loadedEditBox->textEntered(0x20AC);
+            loadedEditBox->textEntered('b');
+            loadedEditBox->textEntered(0xCA);
+            REQUIRE(loadedEditBox->getText() == sf::String{L"\u20AC\u00CA"});
+        }
     }
 
     SECTION("Bug Fixes") {
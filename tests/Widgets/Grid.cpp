@@ -25,6 +25,7 @@
 #include "../Tests.hpp"
 #include <TGUI/Widgets/Grid.hpp>
 #include <TGUI/Widgets/ClickableWidget.hpp>
+#include <functional>
 
 TEST_CASE("[Grid]") {
     tgui::Grid::Ptr grid = std::make_shared<tgui::Grid>();
@@ -33,5 +34,121 @@ TEST_CASE("[Grid]") {
         REQUIRE(grid->getWidgetType() == "Grid");
     }
 
+    SECTION("beginUpdate and endUpdate") {
+        auto createWidgets = []{
+            std::vector<tgui::Widget::Ptr> widgets;
+            for (unsigned int i = 0; i < 6; ++i)
+            {
+                widgets.push_back(std::make_shared<tgui::ClickableWidget>());
+                widgets.back()->setSize(10.f + 10 * i, 50.f - 5 * i);
+            }
+            return widgets;
+        };
+
+        auto widgets = createWidgets();
+        grid->beginUpdate();
+        for (unsigned int i = 0; i < widgets.size(); ++i)
+            grid->addWidget(widgets[i], i / 2, i % 2, {static_cast<float>(i)});
+
+        grid->beginUpdate();
+        grid->endUpdate();
+        REQUIRE(grid->isUpdating());
+        REQUIRE(widgets[5]->getPosition() == sf::Vector2f(0, 0));
+
+        grid->endUpdate();
+        REQUIRE(!grid->isUpdating());
+
+        // The result has to be the same as when the grid is updated after every change
+        auto referenceGrid = std::make_shared<tgui::Grid>();
+        auto referenceWidgets = createWidgets();
+        for (unsigned int i = 0; i < referenceWidgets.size(); ++i)
+            referenceGrid->addWidget(referenceWidgets[i], i / 2, i % 2, {static_cast<float>(i)});
+
+        REQUIRE(grid->getSize() == referenceGrid->getSize());
+        for (unsigned int i = 0; i < widgets.size(); ++i)
+            REQUIRE(widgets[i]->getPosition() == referenceWidgets[i]->getPosition());
+        REQUIRE(widgets[5]->getPosition() != sf::Vector2f(0, 0));
+
+        // Size changes of widgets inside the grid are also postponed
+        {
+            tgui::Container::UpdateGuard guard{*grid};
+            widgets[0]->setSize(100, 100);
+            REQUIRE(widgets[1]->getPosition() == referenceWidgets[1]->getPosition());
+        }
+
+        referenceWidgets[0]->setSize(100, 100);
+        for (unsigned int i = 0; i < widgets.size(); ++i)
+            REQUIRE(widgets[i]->getPosition() == referenceWidgets[i]->getPosition());
+    }
+
+    SECTION("Resizing widgets") {
+        auto createWidgets = []{
+            std::vector<tgui::Widget::Ptr> widgets;
+            for (unsigned int i = 0; i < 9; ++i)
+            {
+                widgets.push_back(std::make_shared<tgui::ClickableWidget>());
+                widgets.back()->setSize(20, 10);
+            }
+            return widgets;
+        };
+
+        auto fillGrid = [](tgui::Grid::Ptr gridToFill, const std::vector<tgui::Widget::Ptr>& widgets){
+            for (unsigned int i = 0; i < widgets.size(); ++i)
+                gridToFill->addWidget(widgets[i], i / 3, i % 3, {1}, tgui::Grid::Alignment::Center);
+        };
+
+        auto widgets = createWidgets();
+        fillGrid(grid, widgets);
+
+        // Only the widgets in the same row or column and the ones after them move
+        const sf::Vector2f firstPosition = widgets[0]->getPosition();
+        const sf::Vector2f thirdPosition = widgets[2]->getPosition();
+        widgets[4]->setSize(40, 30);
+        REQUIRE(widgets[0]->getPosition() == firstPosition);
+        REQUIRE(widgets[2]->getPosition() != thirdPosition);
+
+        // The positions have to be the same as when the grid is filled with widgets that already have their size
+        auto compareWithReference = [&](const std::function<void(std::vector<tgui::Widget::Ptr>&)>& prepare, sf::Vector2f gridSize){
+            auto referenceGrid = std::make_shared<tgui::Grid>();
+            referenceGrid->setSize(gridSize);
+            auto referenceWidgets = createWidgets();
+            prepare(referenceWidgets);
+            fillGrid(referenceGrid, referenceWidgets);
+
+            for (unsigned int i = 0; i < widgets.size(); ++i)
+                REQUIRE(widgets[i]->getPosition() == referenceWidgets[i]->getPosition());
+        };
+
+        compareWithReference([](std::vector<tgui::Widget::Ptr>& ref){ ref[4]->setSize(40, 30); }, {0, 0});
+
+        widgets[4]->setSize(20, 10);
+        compareWithReference([](std::vector<tgui::Widget::Ptr>&){}, {0, 0});
+
+        // Resizing also works when the grid has space left to distribute between the cells
+        grid->setSize(200, 100);
+        widgets[8]->setSize(50, 5);
+        compareWithReference([](std::vector<tgui::Widget::Ptr>& ref){ ref[8]->setSize(50, 5); }, {200, 100});
+
+        widgets[1]->setSize(15, 40);
+        compareWithReference([](std::vector<tgui::Widget::Ptr>& ref){ ref[8]->setSize(50, 5); ref[1]->setSize(15, 40); }, {200, 100});
+
+        // A widget that doesn't change the size of its row or column only moves itself
+        const sf::Vector2f sixthPosition = widgets[6]->getPosition();
+        widgets[7]->setSize(18, 8);
+        REQUIRE(widgets[6]->getPosition() == sixthPosition);
+        compareWithReference([](std::vector<tgui::Widget::Ptr>& ref){ ref[8]->setSize(50, 5); ref[1]->setSize(15, 40); ref[7]->setSize(18, 8); }, {200, 100});
+
+        // Widgets behind a removed widget move to the left
+        grid->remove(widgets[3]);
+        REQUIRE(grid->getWidget(1, 0) == widgets[4]);
+        REQUIRE(grid->getWidget(1, 1) == widgets[5]);
+
+        widgets[5]->setSize(60, 10);
+        REQUIRE(widgets[5]->getPosition().x < widgets[2]->getPosition().x);
+
+        widgets[3]->setSize(100, 100);
+        REQUIRE(grid->getWidget(1, 0) == widgets[4]);
+    }
+
     /// TODO: Loading from and saving to file
 }
@@ -96,6 +96,54 @@ TEST_CASE("[Label]") {
         REQUIRE(label->getMaximumTextWidth() == 300);
     }
 
+    SECTION("NumericMode") {
+        REQUIRE(label->getNumericCharacterCount() == 0);
+
+        label->setText("12");
+        const sf::Vector2f normalSize = label->getSize();
+
+        label->setNumericMode(6);
+        REQUIRE(label->getNumericCharacterCount() == 6);
+        REQUIRE(label->getText() == "12");
+        REQUIRE(label->getSize().x > normalSize.x);
+        REQUIRE(label->getSize().y == normalSize.y);
+
+        // The size doesn't depend on the text and updating the digits doesn't allocate memory
+        const sf::Vector2f numericSize = label->getSize();
+        unsigned int sizeChanges = 0;
+        label->connect("SizeChanged", [&]{ sizeChanges++; });
+
+        label->updateDigits("-3.25");
+        REQUIRE(label->getText() == "-3.25");
+        const auto memoryUsage = label->getMemoryUsage().text;
+        label->updateDigits("99:59");
+        REQUIRE(label->getMemoryUsage().text == memoryUsage);
+
+        label->setText("1");
+        REQUIRE(label->getText() == "1");
+        REQUIRE(label->getSize() == numericSize);
+        REQUIRE(sizeChanges == 0);
+
+        // Characters that don't fit or aren't part of the set are accepted
+        label->updateDigits("abc1234567890");
+        REQUIRE(label->getText() == "abc1234567890");
+        REQUIRE(label->getSize() == numericSize);
+
+        label->setHorizontalAlignment(tgui::Label::HorizontalAlignment::Right);
+        label->setTextSize(30);
+        REQUIRE(label->getSize().y > numericSize.y);
+
+        label->setNumericMode(0);
+        REQUIRE(label->getNumericCharacterCount() == 0);
+        label->setText("12");
+        label->setTextSize(18);
+        REQUIRE(label->getSize() == normalSize);
+
+        // Without numeric mode updateDigits is the same as setText
+        label->updateDigits("34");
+        REQUIRE(label->getText() == "34");
+    }
+
     SECTION("Renderer") {
         auto renderer = label->getRenderer();
 
@@ -181,6 +181,34 @@ TEST_CASE("[ListBox]") {
         REQUIRE(listBox->getSelectedItemIndex() == -1);
     }
     
+    SECTION("sorting items") {
+        listBox->addItem("C", "1");
+        listBox->addItem("A", "2");
+        listBox->addItem("B", "3");
+        listBox->addItem("A", "4");
+        listBox->setSelectedItemById("3");
+
+        // The items are only reordered when the list box is updated
+        listBox->sortItems([](const sf::String& left, const sf::String& right){ return left < right; });
+        REQUIRE(listBox->getItems()[0] == "C");
+
+        tgui::Widget::Ptr widget = listBox;
+        while (listBox->isSortPending())
+            widget->update({});
+
+        REQUIRE(listBox->getItems() == std::vector<sf::String>({"A", "A", "B", "C"}));
+        REQUIRE(listBox->getItemIds() == std::vector<sf::String>({"2", "4", "3", "1"}));
+        REQUIRE(listBox->getSelectedItemId() == "3");
+        REQUIRE(listBox->getSelectedItemIndex() == 2);
+
+        // Adding an item cancels the pending sort
+        listBox->sortItems([](const sf::String& left, const sf::String& right){ return left > right; });
+        listBox->addItem("D", "5");
+        REQUIRE(!listBox->isSortPending());
+        widget->update({});
+        REQUIRE(listBox->getItems() == std::vector<sf::String>({"A", "A", "B", "C", "D"}));
+    }
+
     SECTION("ItemHeight") {
         listBox->setItemHeight(20);
         REQUIRE(listBox->getItemHeight() == 20);
@@ -0,0 +1,106 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "../Tests.hpp"
+#include <TGUI/Widgets/devel/RichTextLabel.hpp>
+
+TEST_CASE("[RichTextLabel]") {
+    auto label = std::make_shared<tgui::RichTextLabel>();
+    label->setFont("resources/DroidSansArmenian.ttf");
+
+    SECTION("WidgetType") {
+        REQUIRE(label->getWidgetType() == "RichTextLabel");
+    }
+
+    SECTION("Text") {
+        REQUIRE(label->getSize() == sf::Vector2f(0, 0));
+
+        label->setText("*Bold*, ~italic~ and #red red");
+        REQUIRE(label->getText() == "*Bold*, ~italic~ and #red red");
+        REQUIRE(label->getSize().x > 0);
+        REQUIRE(label->getSize().y > 0);
+
+        const sf::Vector2f oneLine = label->getSize();
+        label->setText("*Bold*, ~italic~ and #red red\nSecond line");
+        REQUIRE(label->getSize().y > oneLine.y);
+
+        label->setText("");
+        REQUIRE(label->getSize() == sf::Vector2f(0, 0));
+    }
+
+    SECTION("appendText") {
+        const sf::String line1 = "#red *Error:* file not found\n";
+        const sf::String line2 = "_underlined_ \\*not bold\\* ~italic\n";
+        const sf::String line3 = "still italic~ #00ff00 green\n";
+
+        auto reference = std::make_shared<tgui::RichTextLabel>();
+        reference->setFont("resources/DroidSansArmenian.ttf");
+        reference->setText(line1 + line2 + line3);
+
+        label->setText(line1);
+        label->appendText(line2);
+        label->appendText(line3);
+        REQUIRE(label->getText() == reference->getText());
+        REQUIRE(label->getSize() == reference->getSize());
+
+        // A backslash at the end of the text escapes a formatting character at the start of the appended text
+        const sf::String escapeStart = "not \\";
+        const sf::String escapeEnd = "*bold* text";
+        label->setText(escapeStart);
+        reference->setText(escapeStart);
+        REQUIRE(label->getSize() == reference->getSize());
+
+        label->appendText(escapeEnd);
+        reference->setText(escapeStart + escapeEnd);
+        REQUIRE(label->getText() == reference->getText());
+        REQUIRE(label->getSize() == reference->getSize());
+
+        label->setText(escapeStart);
+        label->appendText("\\*also* not bold");
+        reference->setText(escapeStart + "\\*also* not bold");
+        REQUIRE(label->getSize() == reference->getSize());
+
+        // Appending before the font is set lays out the text once the font is known
+        auto withoutFont = std::make_shared<tgui::RichTextLabel>();
+        withoutFont->appendText(line1);
+        withoutFont->appendText(line2 + line3);
+        withoutFont->setFont("resources/DroidSansArmenian.ttf");
+        REQUIRE(withoutFont->getSize() == reference->getSize());
+    }
+
+    SECTION("TextSize") {
+        label->setText("*Bold* text");
+        const sf::Vector2f size = label->getSize();
+
+        label->setTextSize(60);
+        REQUIRE(label->getTextSize() == 60);
+        REQUIRE(label->getSize().x > size.x);
+
+        label->setTextSize(30);
+        REQUIRE(label->getSize() == size);
+        REQUIRE(label->getText() == "*Bold* text");
+    }
+}
@@ -0,0 +1,191 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "../Tests.hpp"
+#include <TGUI/Widgets/devel/Table.hpp>
+
+namespace
+{
+    class AlternatingHeightsDataSource : public tgui::TableDataSource
+    {
+    public:
+        std::size_t getRowCount() const override { return 1000; }
+        std::size_t getColumnCount() const override { return 2; }
+        sf::String getCell(std::size_t row, std::size_t) const override { return tgui::to_string(row); }
+        bool hasVariableRowHeights() const override { return true; }
+        float getRowHeight(std::size_t row) const override { return (row % 2) ? 40.f : 0.f; }
+    };
+
+    sf::String getCellText(const tgui::Widget::Ptr& row, std::size_t column)
+    {
+        auto item = std::static_pointer_cast<tgui::TableItem>(std::static_pointer_cast<tgui::TableRow>(row)->getWidgets()[column]);
+        return std::static_pointer_cast<tgui::Label>(item->getItem())->getText();
+    }
+}
+
+TEST_CASE("[Table]") {
+    auto table = std::make_shared<tgui::Table>();
+
+    // The header and every row are 20 pixels high with a separator of 1 pixel, so exactly 10 rows fit inside the table
+    table->setSize(400, 21 + 10 * 21);
+
+    auto source = std::make_shared<tgui::ColumnTableDataSource>(3);
+    source->reserve(1000);
+    for (std::size_t i = 0; i < 1000; ++i)
+        source->addRow({tgui::to_string(i), "B", "C"});
+
+    SECTION("ColumnTableDataSource") {
+        REQUIRE(source->getRowCount() == 1000);
+        REQUIRE(source->getColumnCount() == 3);
+        REQUIRE(source->getCell(5, 0) == "5");
+        REQUIRE(source->getCell(5, 3) == "");
+        REQUIRE(source->getCell(1000, 0) == "");
+
+        source->addRow({"X"});
+        REQUIRE(source->getRowCount() == 1001);
+        REQUIRE(source->getCell(1000, 0) == "X");
+        REQUIRE(source->getCell(1000, 1) == "");
+
+        source->setCell(1000, 1, "Y");
+        REQUIRE(source->getCell(1000, 1) == "Y");
+
+        source->removeAllRows();
+        REQUIRE(source->getRowCount() == 0);
+        REQUIRE(source->getColumnCount() == 3);
+    }
+
+    SECTION("Only visible rows have widgets") {
+        table->addRow({"1", "2", "3"});
+        table->setDataSource(source);
+        REQUIRE(table->getDataSource() == source);
+        REQUIRE(table->getWidgets().size() == 11);
+        REQUIRE(table->getContentHeight() == 1000 * 21);
+        REQUIRE(table->getFirstVisibleRow() == 0);
+        REQUIRE(getCellText(table->getWidgets()[9], 0) == "9");
+        REQUIRE(!table->getWidgets()[10]->isVisible());
+
+        REQUIRE_THROWS_AS(table->addRow({"1", "2", "3"}), tgui::Exception);
+
+        table->setDataSource(nullptr);
+        REQUIRE(table->getWidgets().empty());
+        table->addRow({"1", "2", "3"});
+        REQUIRE(table->getWidgets().size() == 1);
+    }
+
+    SECTION("Scrolling reuses the widgets") {
+        table->setDataSource(source);
+        const auto widgets = table->getWidgets();
+        auto getRowWidget = [&](std::size_t row){ return widgets[row % widgets.size()]; };
+
+        table->setScrollOffset(21 * 500);
+        REQUIRE(table->getFirstVisibleRow() == 500);
+        REQUIRE(table->getWidgets() == widgets);
+        REQUIRE(getCellText(getRowWidget(500), 0) == "500");
+        REQUIRE(getRowWidget(500)->getPosition() == sf::Vector2f(0, 21));
+        REQUIRE(getCellText(getRowWidget(509), 0) == "509");
+        REQUIRE(!getRowWidget(510)->isVisible());
+
+        // Scrolling into the middle of a row makes one extra row visible
+        table->setScrollOffset(21 * 501 + 5);
+        REQUIRE(table->getWidgets() == widgets);
+        REQUIRE(table->getFirstVisibleRow() == 501);
+        REQUIRE(getCellText(getRowWidget(501), 0) == "501");
+        REQUIRE(getCellText(getRowWidget(511), 0) == "511");
+        REQUIRE(getRowWidget(501)->getPosition() == sf::Vector2f(0, 16));
+        REQUIRE(getRowWidget(511)->isVisible());
+
+        table->setScrollOffset(1e9);
+        REQUIRE(table->getScrollOffset() == 1000 * 21 - 10 * 21);
+        REQUIRE(table->getFirstVisibleRow() == 990);
+
+        table->setScrollOffset(-5);
+        REQUIRE(table->getScrollOffset() == 0);
+
+        source->setCell(0, 0, "Changed");
+        REQUIRE(getCellText(widgets[0], 0) == "0");
+        table->notifyDataChanged();
+        REQUIRE(getCellText(widgets[0], 0) == "Changed");
+    }
+
+    SECTION("Sorting and filtering") {
+        table->setDataSource(source);
+        tgui::Widget::Ptr widget = table;
+        auto waitForRowOrder = [&]{
+            while (table->isRowOrderPending())
+                widget->update({});
+        };
+
+        // The new order is only shown once the table is updated
+        table->sortRows([](std::size_t left, std::size_t right){ return left > right; });
+        REQUIRE(getCellText(table->getWidgets()[0], 0) == "0");
+        waitForRowOrder();
+        REQUIRE(table->getDisplayedRowCount() == 1000);
+        REQUIRE(table->getDataRow(0) == 999);
+        REQUIRE(getCellText(table->getWidgets()[0], 0) == "999");
+
+        // The filtered rows remain sorted
+        table->filterRows([](std::size_t row){ return row % 10 == 0; });
+        waitForRowOrder();
+        REQUIRE(table->getDisplayedRowCount() == 100);
+        REQUIRE(table->getContentHeight() == 100 * 21);
+        REQUIRE(table->getDataRow(0) == 990);
+        REQUIRE(getCellText(table->getWidgets()[1], 0) == "980");
+
+        // Only the result of the newest request is used
+        table->filterRows([](std::size_t row){ return row < 5; });
+        table->filterRows([](std::size_t row){ return row < 500; });
+        waitForRowOrder();
+        REQUIRE(table->getDisplayedRowCount() == 500);
+        REQUIRE(table->getDataRow(0) == 499);
+
+        // Rows are sorted and filtered again when the data changes
+        source->removeAllRows();
+        source->addRow({"X", "B", "C"});
+        source->addRow({"Y", "B", "C"});
+        table->notifyDataChanged();
+        REQUIRE(table->isRowOrderPending());
+        waitForRowOrder();
+        REQUIRE(table->getDisplayedRowCount() == 2);
+        REQUIRE(getCellText(table->getWidgets()[0], 0) == "Y");
+
+        table->sortRows(nullptr);
+        table->filterRows(nullptr);
+        REQUIRE(!table->isRowOrderPending());
+        REQUIRE(table->getDataRow(0) == 0);
+        REQUIRE(getCellText(table->getWidgets()[0], 0) == "X");
+    }
+
+    SECTION("Variable row heights") {
+        table->setDataSource(std::make_shared<AlternatingHeightsDataSource>());
+        REQUIRE(table->getContentHeight() == 500 * (21 + 41));
+        REQUIRE(table->getWidgets().size() == 9);
+
+        table->setScrollOffset(100 * (21 + 41) + 21);
+        REQUIRE(table->getFirstVisibleRow() == 201);
+
+        table->setScrollOffset(100 * (21 + 41) + 20);
+        REQUIRE(table->getFirstVisibleRow() == 200);
+    }
+}